@@ -0,0 +1,141 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exec/analytor.h"
+#include "exprs/function_context.h"
+#include "runtime/mem_pool.h"
+
+namespace starrocks {
+
+// Evaluate MAX and MIN over `ROWS BETWEEN frame_size - 1 PRECEDING AND CURRENT ROW` for every row of one
+// partition, either by re-aggregating the whole frame per row or with the segment tree process.
+class AnalytorBench {
+public:
+    AnalytorBench(int64_t num_rows, int64_t frame_size, bool use_segment_tree)
+            : _num_rows(num_rows),
+              _frame_size(frame_size),
+              _use_segment_tree(use_segment_tree),
+              _analytor(_plan_node, _row_desc, nullptr, false) {}
+
+    void SetUp();
+    void do_bench(benchmark::State& state);
+
+private:
+    void _evaluate_partition();
+
+    const int64_t _num_rows;
+    const int64_t _frame_size;
+    const bool _use_segment_tree;
+
+    TPlanNode _plan_node;
+    RowDescriptor _row_desc;
+    Analytor _analytor;
+    std::unique_ptr<FunctionContext> _ctx;
+};
+
+void AnalytorBench::SetUp() {
+    const auto* max_fn = get_window_function("max", TYPE_INT, TYPE_INT, true, TFunctionBinaryType::BUILTIN, 3);
+    const auto* min_fn = get_window_function("min", TYPE_INT, TYPE_INT, true, TFunctionBinaryType::BUILTIN, 3);
+    _ctx.reset(FunctionContext::create_test_context());
+
+    auto data = Int32Column::create();
+    auto nulls = NullColumn::create();
+    for (int64_t i = 0; i < _num_rows; i++) {
+        data->append(static_cast<int32_t>((i * 7919) % 100003));
+        nulls->append(i % 17 == 0);
+    }
+    ColumnPtr input = NullableColumn::create(std::move(data), std::move(nulls));
+
+    _analytor._agg_functions = {max_fn, min_fn};
+    _analytor._agg_fn_ctxs = {_ctx.get(), _ctx.get()};
+    _analytor._agg_fn_types = {{TypeDescriptor(TYPE_INT), true, true}, {TypeDescriptor(TYPE_INT), true, true}};
+    _analytor._agg_intput_columns = {{input}, {input}};
+    _analytor._is_lead_lag_functions = {false, false};
+    const size_t min_offset =
+            (max_fn->size() + min_fn->alignof_size() - 1) / min_fn->alignof_size() * min_fn->alignof_size();
+    _analytor._agg_states_offsets = {0, min_offset};
+    _analytor._agg_states_total_size = min_offset + min_fn->size();
+    _analytor._max_agg_state_align_size = std::max(max_fn->alignof_size(), min_fn->alignof_size());
+    _analytor._rows_start_offset = 1 - _frame_size;
+    _analytor._rows_end_offset = 0;
+    _analytor._use_segment_tree_process = _use_segment_tree;
+    _analytor._mem_pool = std::make_unique<MemPool>();
+    // The same states as Analytor::open, including the scratch states of the segment tree.
+    _analytor._create_managed_fn_states();
+
+    _analytor._partition.start = 0;
+    _analytor._partition.end = _num_rows;
+    _analytor._partition.is_real = true;
+}
+
+void AnalytorBench::_evaluate_partition() {
+    auto result = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    result->reserve(_num_rows);
+    for (int64_t row = 0; row < _num_rows; row++) {
+        const int64_t frame_start = row + _analytor._rows_start_offset;
+        const int64_t frame_end = row + _analytor._rows_end_offset + 1;
+        _analytor._reset_window_state();
+        if (_use_segment_tree) {
+            _analytor._update_window_batch_with_segment_tree(frame_start, frame_end);
+        } else {
+            _analytor._update_window_batch(_analytor._partition.start, _analytor._partition.end, frame_start,
+                                           frame_end);
+        }
+        _analytor._agg_functions[0]->finalize_to_column(_ctx.get(), _analytor._managed_fn_states[0]->data(),
+                                                        result.get());
+    }
+    benchmark::DoNotOptimize(result->size());
+    if (_use_segment_tree) {
+        _analytor._reset_segment_tree();
+    }
+}
+
+void AnalytorBench::do_bench(benchmark::State& state) {
+    for (auto _ : state) {
+        _evaluate_partition();
+    }
+    state.SetItemsProcessed(state.iterations() * _num_rows);
+}
+
+static void bench_func(benchmark::State& state) {
+    const int64_t num_rows = state.range(0);
+    const int64_t frame_size = state.range(1);
+    const bool use_segment_tree = state.range(2);
+
+    AnalytorBench bench(num_rows, frame_size, use_segment_tree);
+    bench.SetUp();
+    bench.do_bench(state);
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    // num_rows, frame_size, use_segment_tree
+    for (int64_t frame_size : {16, 64, 256, 1024, 4096, 16384}) {
+        b->Args({100000, frame_size, 0});
+        b->Args({100000, frame_size, 1});
+    }
+}
+
+BENCHMARK(bench_func)->Apply(process_args)->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
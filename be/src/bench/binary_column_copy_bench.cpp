@@ -15,6 +15,9 @@
 #include <benchmark/benchmark.h>
 #include <testutil/assert.h>
 
+#include <algorithm>
+#include <numeric>
+
 #include "column/binary_column.h"
 #include "util/random.h"
 
@@ -82,13 +85,34 @@ void BinaryColumnCopyBench::do_bench(benchmark::State& state) {
         }
 
         state.PauseTiming();
-    } else {
+    } else if (_mode == 3) {
         state.ResumeTiming();
 
         for (size_t i = 0; i < _chunk_size; i++) {
             dest_column.append(column->get_slice(i));
         }
 
+        state.PauseTiming();
+    } else if (_mode == 4) {
+        // gather rows in random order, as shuffle does
+        std::vector<uint32_t> indexes(_chunk_size);
+        std::iota(indexes.begin(), indexes.end(), 0);
+        std::shuffle(indexes.begin(), indexes.end(), _rand);
+        state.ResumeTiming();
+
+        dest_column.append_selective(*column, indexes.data(), 0, _chunk_size);
+
+        state.PauseTiming();
+    } else {
+        // keep half of the rows
+        Buffer<uint8_t> filter(_chunk_size);
+        for (size_t i = 0; i < _chunk_size; i++) {
+            filter[i] = _rand() % 2;
+        }
+        state.ResumeTiming();
+
+        column->filter_range(filter, 0, _chunk_size);
+
         state.PauseTiming();
     }
 }
@@ -130,18 +154,26 @@ static void process_args(benchmark::internal::Benchmark* b) {
     b->Args({1, 4096})->Iterations(100);
     b->Args({2, 4096})->Iterations(100);
     b->Args({3, 4096})->Iterations(100);
+    b->Args({4, 4096})->Iterations(100);
+    b->Args({5, 4096})->Iterations(100);
 
     b->Args({1, 40960})->Iterations(100);
     b->Args({2, 40960})->Iterations(100);
     b->Args({3, 40960})->Iterations(100);
+    b->Args({4, 40960})->Iterations(100);
+    b->Args({5, 40960})->Iterations(100);
 
     b->Args({1, 409600})->Iterations(10);
     b->Args({2, 409600})->Iterations(10);
     b->Args({3, 409600})->Iterations(10);
+    b->Args({4, 409600})->Iterations(10);
+    b->Args({5, 409600})->Iterations(10);
 
     b->Args({1, 4096000})->Iterations(10);
     b->Args({2, 4096000})->Iterations(10);
     b->Args({3, 4096000})->Iterations(10);
+    b->Args({4, 4096000})->Iterations(10);
+    b->Args({5, 4096000})->Iterations(10);
 }
 
 BENCHMARK(bench_func)->Apply(process_args);
@@ -159,6 +159,7 @@ struct SortParameters {
     bool low_card = false;
     bool nullable = false;
     int max_buffered_chunks = ChunksSorterTopn::kDefaultBufferedChunks;
+    bool enable_radix_sort = true;
 
     SortParameters() = default;
 
@@ -185,6 +186,12 @@ struct SortParameters {
         params.max_buffered_chunks = max_buffered_chunks;
         return params;
     }
+
+    static SortParameters with_radix_sort(bool enable_radix_sort) {
+        SortParameters params;
+        params.enable_radix_sort = enable_radix_sort;
+        return params;
+    }
 };
 
 static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, LogicalType data_type, int num_chunks,
@@ -192,6 +199,7 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     // state.PauseTiming();
     ChunkSorterBase suite;
     suite.SetUp();
+    config::enable_sort_radix_sort = params.enable_radix_sort;
 
     TypeDescriptor type_desc;
     if (data_type == TYPE_INT) {
@@ -307,6 +315,7 @@ static void do_bench(benchmark::State& state, SortAlgorithm sorter_algo, Logical
     state.SetItemsProcessed(item_processed);
 
     suite.TearDown();
+    config::enable_sort_radix_sort = true;
 }
 
 static void do_heap_merge(benchmark::State& state, int num_runs, bool use_merger = true) {
@@ -462,6 +471,19 @@ static void BM_fullsort_varchar_column_incr(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_VARCHAR, state.range(0), state.range(1));
 }
 
+// Single integer key: radix sort vs comparison sort
+static void BM_fullsort_radix_sort(benchmark::State& state) {
+    do_bench(state, FullSort, TYPE_INT, state.range(0), 1, SortParameters::with_radix_sort(true));
+}
+static void BM_fullsort_radix_sort_disabled(benchmark::State& state) {
+    do_bench(state, FullSort, TYPE_INT, state.range(0), 1, SortParameters::with_radix_sort(false));
+}
+static void BM_fullsort_radix_sort_nullable(benchmark::State& state) {
+    SortParameters params = SortParameters::with_radix_sort(true);
+    params.nullable = true;
+    do_bench(state, FullSort, TYPE_INT, state.range(0), 1, params);
+}
+
 // Low cardinality
 static void BM_fullsort_low_card_colinc(benchmark::State& state) {
     do_bench(state, FullSort, TYPE_INT, state.range(0), state.range(1), SortParameters::with_low_card(true));
@@ -535,6 +557,9 @@ BENCHMARK(BM_fullsort_notnull)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_nullable)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_float_notnull)->Apply(CustomArgsFull);
 BENCHMARK(BM_fullsort_varchar_column_incr)->Apply(CustomArgsFull);
+BENCHMARK(BM_fullsort_radix_sort)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_fullsort_radix_sort_disabled)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_fullsort_radix_sort_nullable)->RangeMultiplier(8)->Range(64, 4096);
 
 // Low-Cardinality Sort
 BENCHMARK(BM_fullsort_low_card_colinc)->Apply(CustomArgsFull);
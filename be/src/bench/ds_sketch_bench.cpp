@@ -0,0 +1,150 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "exprs/agg/aggregate_factory.h"
+#include "exprs/function_context.h"
+#include "runtime/mem_pool.h"
+
+namespace starrocks {
+
+// Compare the KLL sketch aggregates with the t-digest based percentile_approx:
+// building a state from raw values, and merging serialized partial states (the second phase
+// of a distributed aggregation, or a rollup over stored sketches).
+class QuantileSketchBench {
+public:
+    QuantileSketchBench(bool use_kll, size_t num_rows) : _use_kll(use_kll), _num_rows(num_rows) {
+        _ctx.reset(FunctionContext::create_test_context());
+        if (_use_kll) {
+            _func = get_aggregate_function("ds_kll_sketch", TYPE_DOUBLE, TYPE_VARBINARY, false);
+        } else {
+            _func = get_aggregate_function("percentile_approx", TYPE_DOUBLE, TYPE_DOUBLE, false);
+        }
+        CHECK(_func != nullptr);
+
+        std::mt19937_64 rng(0);
+        std::lognormal_distribution<double> dist(0, 1);
+        auto values = DoubleColumn::create();
+        values->reserve(_num_rows);
+        for (size_t i = 0; i < _num_rows; ++i) {
+            values->append(dist(rng));
+        }
+        _values = std::move(values);
+        _rate = ColumnHelper::create_const_column<TYPE_DOUBLE>(0.99, _num_rows);
+    }
+
+    ~QuantileSketchBench() {
+        for (auto state : _states) {
+            _func->destroy(_ctx.get(), state);
+        }
+    }
+
+    AggDataPtr new_state() {
+        AggDataPtr state = _mem_pool.allocate_aligned(_func->size(), _func->alignof_size());
+        _func->create(_ctx.get(), state);
+        _states.push_back(state);
+        return state;
+    }
+
+    void update(AggDataPtr state) {
+        const Column* columns[] = {_values.get(), _rate.get()};
+        _func->update_batch_single_state(_ctx.get(), _num_rows, columns, state);
+    }
+
+    // Serialize |num_partials| states, each built from all the rows.
+    ColumnPtr build_partials(size_t num_partials) {
+        ColumnPtr partials = BinaryColumn::create();
+        for (size_t i = 0; i < num_partials; ++i) {
+            AggDataPtr state = new_state();
+            update(state);
+            _func->serialize_to_column(_ctx.get(), state, partials.get());
+        }
+        return partials;
+    }
+
+    void merge(AggDataPtr state, const ColumnPtr& partials) {
+        _func->merge_batch_single_state(_ctx.get(), state, partials.get(), 0, partials->size());
+    }
+
+    void finalize(AggDataPtr state) {
+        ColumnPtr result;
+        if (_use_kll) {
+            result = BinaryColumn::create();
+        } else {
+            result = DoubleColumn::create();
+        }
+        _func->finalize_to_column(_ctx.get(), state, result.get());
+        benchmark::DoNotOptimize(result);
+    }
+
+private:
+    bool _use_kll;
+    size_t _num_rows;
+    std::unique_ptr<FunctionContext> _ctx;
+    const AggregateFunction* _func = nullptr;
+    ColumnPtr _values;
+    ColumnPtr _rate;
+    MemPool _mem_pool;
+    std::vector<AggDataPtr> _states;
+};
+
+static void BM_QuantileSketch_Update(benchmark::State& state) {
+    bool use_kll = state.range(0);
+    size_t num_rows = state.range(1);
+    QuantileSketchBench bench(use_kll, num_rows);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        AggDataPtr agg_state = bench.new_state();
+        state.ResumeTiming();
+
+        bench.update(agg_state);
+        bench.finalize(agg_state);
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void BM_QuantileSketch_Merge(benchmark::State& state) {
+    bool use_kll = state.range(0);
+    size_t num_partials = state.range(1);
+    QuantileSketchBench bench(use_kll, 4096);
+    ColumnPtr partials = bench.build_partials(num_partials);
+    state.counters["partial_bytes"] = partials->byte_size() / num_partials;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        AggDataPtr agg_state = bench.new_state();
+        state.ResumeTiming();
+
+        bench.merge(agg_state, partials);
+        bench.finalize(agg_state);
+    }
+    state.SetItemsProcessed(state.iterations() * num_partials);
+}
+
+// {use_kll, num_rows}
+BENCHMARK(BM_QuantileSketch_Update)->ArgsProduct({{0, 1}, {4096, 65536, 1 << 20}});
+// {use_kll, num_partials}
+BENCHMARK(BM_QuantileSketch_Merge)->ArgsProduct({{0, 1}, {16, 256}});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "common/config.h"
+#include "exec/join_hash_map.h"
+#include "runtime/memory/huge_page_allocator.h"
+
+namespace starrocks {
+
+// Probe a bucket-chained hash table laid out like JoinHashTableItems (first/next/keys), whose
+// buffers are backed by 4KB pages or by huge pages. The keys are random, so every probe touches
+// random pages of `first`, `next` and the key buffer, and the working set is far beyond the TLB reach.
+class HashTableProbeBench {
+public:
+    // The buffers capture the configs when they are created.
+    explicit HashTableProbeBench(size_t num_rows) {
+        std::mt19937_64 rng(0);
+        _bucket_size = JoinHashMapHelper::calc_bucket_size(num_rows);
+        _first.resize(_bucket_size, 0);
+        _next.resize(num_rows + 1, 0);
+        _keys.resize(num_rows + 1, 0);
+        for (uint32_t i = 1; i <= num_rows; ++i) {
+            _keys[i] = rng();
+            uint32_t bucket = _bucket_of(_keys[i]);
+            _next[i] = _first[bucket];
+            _first[bucket] = i;
+        }
+
+        _probe_keys.resize(PROBE_BATCH);
+        std::uniform_int_distribution<uint32_t> dist(1, num_rows);
+        for (auto& key : _probe_keys) {
+            key = _keys[dist(rng)];
+        }
+    }
+
+    size_t probe() const {
+        size_t matched = 0;
+        for (uint64_t key : _probe_keys) {
+            for (uint32_t index = _first[_bucket_of(key)]; index != 0; index = _next[index]) {
+                matched += _keys[index] == key;
+            }
+        }
+        return matched;
+    }
+
+    static constexpr size_t PROBE_BATCH = 4096;
+
+private:
+    uint32_t _bucket_of(uint64_t key) const { return ((key * 0x9E3779B97F4A7C15ULL) >> 32) & (_bucket_size - 1); }
+
+    uint32_t _bucket_size = 0;
+    JoinHashTableBuffer _first;
+    JoinHashTableBuffer _next;
+    HugePageBuffer<uint64_t, HugePageUsage::JOIN_HASH_TABLE> _keys;
+    std::vector<uint64_t> _probe_keys;
+};
+
+static void BM_HashTableProbe(benchmark::State& state) {
+    bool use_huge_page = state.range(0);
+    size_t num_rows = state.range(1);
+    const bool old_enable = config::enable_huge_page_for_join_hash_table;
+    const int64_t old_min_bytes = config::huge_page_alloc_min_bytes;
+    config::enable_huge_page_for_join_hash_table = use_huge_page;
+    config::huge_page_alloc_min_bytes = HugePageAllocator::HUGE_PAGE_SIZE;
+    HashTableProbeBench bench(num_rows);
+    config::enable_huge_page_for_join_hash_table = old_enable;
+    config::huge_page_alloc_min_bytes = old_min_bytes;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bench.probe());
+    }
+    state.SetItemsProcessed(state.iterations() * HashTableProbeBench::PROBE_BATCH);
+}
+
+// {use_huge_page, num_rows}
+BENCHMARK(BM_HashTableProbe)->ArgsProduct({{0, 1}, {1 << 20, 1 << 24, 1 << 27}});
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -26,6 +26,7 @@
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exprs/like_predicate.h"
 #include "exprs/string_functions.h"
 
 namespace starrocks {
@@ -154,6 +155,74 @@ BENCHMARK(BM_HyperScan_Eval)->Apply(BM_HyperScan_Eval_Arg);
     BM_HyperScan_Eval/100/0/iterations:10000     100563 ns       100588 ns        10000
      */
 
+// OR-chain of `num_patterns` LIKE '%...%' predicates on one column:
+// one scan per pattern and OR the results vs. one multi-pattern scan.
+class MultiPatternLikeBench {
+public:
+    explicit MultiPatternLikeBench(size_t num_patterns) : _num_patterns(num_patterns) {}
+
+    void SetUp() {
+        _column = Bench::create_random_column(TypeDescriptor(TYPE_VARCHAR), _num_rows, false, false, 32);
+        std::vector<std::string> regex_patterns;
+        for (size_t i = 0; i < _num_patterns; i++) {
+            std::string like_pattern = "%k" + std::to_string(i) + "x%";
+            regex_patterns.emplace_back(LikePredicate::convert_like_pattern<true>(Slice(like_pattern), '\\'));
+            auto single_state = LikePredicate::compile_multi_patterns({regex_patterns.back()});
+            ASSERT_TRUE(single_state.ok());
+            _single_states.emplace_back(std::move(single_state.value()));
+        }
+        auto multi_state = LikePredicate::compile_multi_patterns(regex_patterns);
+        ASSERT_TRUE(multi_state.ok());
+        _multi_state = std::move(multi_state.value());
+    }
+
+    StatusOr<ColumnPtr> do_bench(bool multi_pattern) {
+        if (multi_pattern) {
+            return LikePredicate::multi_pattern_match(_multi_state.get(), _column);
+        }
+        ColumnPtr result;
+        for (const auto& single_state : _single_states) {
+            ASSIGN_OR_RETURN(auto matched, LikePredicate::multi_pattern_match(single_state.get(), _column));
+            if (result == nullptr) {
+                result = matched;
+                continue;
+            }
+            auto& result_data = down_cast<BooleanColumn*>(result.get())->get_data();
+            const auto& matched_data = down_cast<BooleanColumn*>(matched.get())->get_data();
+            for (size_t i = 0; i < result_data.size(); i++) {
+                result_data[i] |= matched_data[i];
+            }
+        }
+        return result;
+    }
+
+private:
+    size_t _num_patterns = 0;
+    size_t _num_rows = 4096;
+    ColumnPtr _column;
+    std::vector<std::shared_ptr<LikePredicate::MultiPatternState>> _single_states;
+    std::shared_ptr<LikePredicate::MultiPatternState> _multi_state;
+};
+
+static void BM_HyperScan_MultiPattern_Like(benchmark::State& state) {
+    size_t num_patterns = state.range(0);
+    bool multi_pattern = state.range(1);
+
+    MultiPatternLikeBench bench(num_patterns);
+    bench.SetUp();
+
+    for (auto _ : state) {
+        state.ResumeTiming();
+        auto st = bench.do_bench(multi_pattern);
+        state.PauseTiming();
+        ASSERT_TRUE(st.ok());
+    }
+}
+
+BENCHMARK(BM_HyperScan_MultiPattern_Like)
+        ->ArgsProduct({{2, 10, 50}, {false, true}})
+        ->Iterations(1000);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/admission_policy.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/bit_util.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+std::unique_ptr<AdmissionPolicy> AdmissionPolicy::create(const std::string& name, size_t num_counters) {
+    if (name == "frequency") {
+        return std::make_unique<FrequencyAdmissionPolicy>(num_counters);
+    }
+    LOG_IF(WARNING, !name.empty() && name != "none") << "unknown datacache admission policy: " << name;
+    return nullptr;
+}
+
+FrequencyAdmissionPolicy::FrequencyAdmissionPolicy(size_t num_counters) {
+    size_t width = BitUtil::RoundUpToPowerOfTwo(std::max<size_t>(num_counters, 64));
+    _mask = width - 1;
+    // The sketch is aged after about ten accesses per counter, like the reset interval of TinyLFU.
+    _sample_size = width * 10;
+    _counters.resize(width * kDepth, 0);
+}
+
+void FrequencyAdmissionPolicy::_indexes(const std::string& key, size_t* indexes) const {
+    uint64_t hash = HashUtil::hash64(key.data(), key.size(), 0);
+    uint64_t h1 = hash;
+    uint64_t h2 = (hash >> 32) | 1;
+    for (int i = 0; i < kDepth; i++) {
+        indexes[i] = i * (_mask + 1) + ((h1 + i * h2) & _mask);
+    }
+}
+
+uint32_t FrequencyAdmissionPolicy::_estimate(const size_t* indexes) const {
+    uint32_t count = kMaxCount;
+    for (int i = 0; i < kDepth; i++) {
+        count = std::min<uint32_t>(count, _counters[indexes[i]]);
+    }
+    return count;
+}
+
+void FrequencyAdmissionPolicy::_age() {
+    for (auto& counter : _counters) {
+        counter >>= 1;
+    }
+    _additions /= 2;
+}
+
+bool FrequencyAdmissionPolicy::admit(const std::string& key) {
+    size_t indexes[kDepth];
+    _indexes(key, indexes);
+
+    std::lock_guard<std::mutex> l(_mutex);
+    // conservative update: only the smallest counters are increased
+    uint32_t count = _estimate(indexes);
+    if (count < kMaxCount) {
+        for (int i = 0; i < kDepth; i++) {
+            if (_counters[indexes[i]] == count) {
+                _counters[indexes[i]]++;
+            }
+        }
+        count++;
+    }
+    if (++_additions >= _sample_size) {
+        _age();
+    }
+    return count >= static_cast<uint32_t>(std::max(1, config::datacache_admission_min_frequency));
+}
+
+uint32_t FrequencyAdmissionPolicy::estimate(const std::string& key) {
+    size_t indexes[kDepth];
+    _indexes(key, indexes);
+    std::lock_guard<std::mutex> l(_mutex);
+    return _estimate(indexes);
+}
+
+} // namespace starrocks
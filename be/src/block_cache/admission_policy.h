@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+// Decides whether a block read from remote is worth writing into the block cache.
+class AdmissionPolicy {
+public:
+    virtual ~AdmissionPolicy() = default;
+
+    // Record one access to |key| and return true if it should be written into the cache.
+    virtual bool admit(const std::string& key) = 0;
+
+    // Create the policy configured by `datacache_admission_policy`, or nullptr if every block is admitted.
+    static std::unique_ptr<AdmissionPolicy> create(const std::string& name, size_t num_counters);
+};
+
+// A TinyLFU style policy: the accesses of each key are counted in a count-min sketch, and a key is
+// admitted once it has been seen `datacache_admission_min_frequency` times. All counters are halved
+// periodically, so keys that were popular a long time ago are forgotten.
+class FrequencyAdmissionPolicy final : public AdmissionPolicy {
+public:
+    explicit FrequencyAdmissionPolicy(size_t num_counters);
+
+    bool admit(const std::string& key) override;
+
+    // Estimated number of accesses of |key|, saturated at 15.
+    uint32_t estimate(const std::string& key);
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    void _indexes(const std::string& key, size_t* indexes) const;
+    uint32_t _estimate(const size_t* indexes) const;
+    void _age();
+
+    std::mutex _mutex;
+    size_t _mask = 0;
+    size_t _additions = 0;
+    size_t _sample_size = 0;
+    std::vector<uint8_t> _counters;
+};
+
+} // namespace starrocks
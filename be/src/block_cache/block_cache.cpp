@@ -70,11 +70,19 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(cache_options));
+    _admission_policy =
+            AdmissionPolicy::create(config::datacache_admission_policy, config::datacache_admission_sketch_counters);
     _refresh_quota();
     _initialized.store(true, std::memory_order_relaxed);
     if (_disk_space_monitor) {
         _disk_space_monitor->start();
     }
+    if (config::datacache_warmup_enable && has_disk_cache() && !cache_options.disk_spaces.empty()) {
+        const std::string& dir =
+                cache_options.meta_path.empty() ? cache_options.disk_spaces[0].path : cache_options.meta_path;
+        _warmup = std::make_unique<CacheWarmup>(this, (fs::path(dir) / "warmup_manifest").string());
+        _warmup->start();
+    }
     return Status::OK();
 }
 
@@ -90,6 +98,10 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, const I
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
+    if (_admission_policy != nullptr && (options == nullptr || !options->skip_admission) &&
+        !_admission_policy->admit(block_key)) {
+        return Status::ResourceBusy("block is not admitted by the datacache admission policy");
+    }
     return _kv_cache->write_buffer(block_key, buffer, options);
 }
 
@@ -190,6 +202,9 @@ Status BlockCache::shutdown() {
     if (!_initialized.load(std::memory_order_relaxed)) {
         return Status::OK();
     }
+    if (_warmup) {
+        _warmup->stop();
+    }
     Status st = _kv_cache->shutdown();
     if (_disk_space_monitor) {
         _disk_space_monitor->stop();
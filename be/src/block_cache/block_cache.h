@@ -16,6 +16,8 @@
 
 #include <atomic>
 
+#include "block_cache/admission_policy.h"
+#include "block_cache/cache_warmup.h"
 #include "block_cache/disk_space_monitor.h"
 #include "block_cache/kv_cache.h"
 #include "common/status.h"
@@ -35,7 +37,8 @@ public:
     // Init the block cache instance
     Status init(const CacheOptions& options);
 
-    // Write data buffer to cache, the `offset` must be aligned by block size
+    // Write data buffer to cache, the `offset` must be aligned by block size.
+    // Returns ResourceBusy if the block is rejected by the admission policy.
     Status write_buffer(const CacheKey& cache_key, off_t offset, const IOBuffer& buffer,
                         WriteCacheOptions* options = nullptr);
 
@@ -92,6 +95,12 @@ public:
 
     DataCacheEngineType engine_type();
 
+    // The warm-up job of this cache, nullptr if `datacache_warmup_enable` is off or there is no disk cache.
+    CacheWarmup* warmup() const { return _warmup.get(); }
+
+    // Replace the admission policy for block writes, nullptr admits every block.
+    void set_admission_policy(std::unique_ptr<AdmissionPolicy> policy) { _admission_policy = std::move(policy); }
+
     static const size_t MAX_BLOCK_SIZE;
 
 private:
@@ -103,6 +112,8 @@ private:
     size_t _block_size = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::unique_ptr<DiskSpaceMonitor> _disk_space_monitor;
+    std::unique_ptr<AdmissionPolicy> _admission_policy;
+    std::unique_ptr<CacheWarmup> _warmup;
     std::atomic<bool> _initialized = false;
     std::atomic<size_t> _mem_quota = 0;
     std::atomic<size_t> _disk_quota = 0;
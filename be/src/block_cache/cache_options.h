@@ -62,6 +62,9 @@ struct WriteCacheOptions {
     // It is expressed as a percentage. If evict_probability is 10, it means the probability to evict other data is 10%.
     int32_t evict_probability = 100;
 
+    // Write the value without consulting the admission policy of the block cache.
+    bool skip_admission = false;
+
     struct Stats {
         int64_t write_mem_bytes = 0;
         int64_t write_disk_bytes = 0;
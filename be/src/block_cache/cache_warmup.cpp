@@ -0,0 +1,342 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/cache_warmup.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <charconv>
+
+#include "block_cache/block_cache.h"
+#include "block_cache/datacache_utils.h"
+#include "common/config.h"
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "util/raw_container.h"
+#include "util/thread.h"
+
+namespace starrocks {
+
+// Manifest format, one remote file per line:
+//   <file size>\t<modification time>\t<block offset>:<access count>,...\t<file name>
+// The file name is the last field, so it may contain any character except a newline.
+
+CacheWarmup::CacheWarmup(BlockCache* cache, std::string manifest_path)
+        : _cache(cache), _manifest_path(std::move(manifest_path)) {}
+
+CacheWarmup::~CacheWarmup() {
+    stop();
+}
+
+void CacheWarmup::start() {
+    if (!_is_stopped()) {
+        return;
+    }
+    Status st = load_manifest();
+    LOG_IF(WARNING, !st.ok() && !st.is_not_found())
+            << "fail to load datacache warmup manifest " << _manifest_path << ": " << st;
+    _cancelled.store(false, std::memory_order_release);
+    _stopped.store(false, std::memory_order_release);
+    _thread = std::thread([this] { _run(); });
+    Thread::set_thread_name(_thread, "cache_warmup");
+}
+
+void CacheWarmup::stop() {
+    if (_is_stopped()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> l(_stop_mutex);
+        _cancelled.store(true, std::memory_order_release);
+        _stopped.store(true, std::memory_order_release);
+    }
+    _stop_cv.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    Status st = save_manifest();
+    LOG_IF(WARNING, !st.ok()) << "fail to save datacache warmup manifest " << _manifest_path << ": " << st;
+}
+
+void CacheWarmup::_run() {
+    warmup();
+    while (!_is_stopped()) {
+        {
+            auto interval = std::chrono::seconds(std::max<int64_t>(1, config::datacache_warmup_save_interval_seconds));
+            std::unique_lock<std::mutex> l(_stop_mutex);
+            _stop_cv.wait_for(l, interval, [this] { return _is_stopped(); });
+        }
+        if (_is_stopped()) {
+            break;
+        }
+        Status st = save_manifest();
+        LOG_IF(WARNING, !st.ok()) << "fail to save datacache warmup manifest " << _manifest_path << ": " << st;
+    }
+}
+
+void CacheWarmup::record(const std::string& filename, int64_t file_size, int64_t modification_time,
+                         const std::vector<int64_t>& block_offsets) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto& access = _files[filename];
+    if (access.size != file_size || access.modification_time != modification_time) {
+        // a new version of the file, the blocks of the old one are useless
+        _num_blocks -= access.blocks.size();
+        access.blocks.clear();
+        access.size = file_size;
+        access.modification_time = modification_time;
+    }
+    for (int64_t offset : block_offsets) {
+        auto [iter, inserted] = access.blocks.emplace(offset, 0);
+        iter->second++;
+        _num_blocks += inserted;
+    }
+    // Shrink in batches, so the sort is amortized over many records.
+    auto max_blocks = static_cast<size_t>(std::max<int64_t>(0, config::datacache_warmup_max_blocks));
+    if (_num_blocks > 2 * max_blocks) {
+        _shrink(max_blocks);
+    }
+}
+
+void CacheWarmup::_shrink(size_t max_blocks) {
+    if (_num_blocks <= max_blocks) {
+        return;
+    }
+    std::vector<uint32_t> counts;
+    counts.reserve(_num_blocks);
+    for (const auto& [_, access] : _files) {
+        for (const auto& [_, count] : access.blocks) {
+            counts.push_back(count);
+        }
+    }
+    // keep the blocks with count above the threshold, and those equal to it until max_blocks are kept
+    auto nth = counts.begin() + (counts.size() - max_blocks);
+    std::nth_element(counts.begin(), nth, counts.end());
+    uint32_t threshold = max_blocks == 0 ? UINT32_MAX : *nth;
+    size_t num_above = std::count_if(counts.begin(), counts.end(), [&](uint32_t c) { return c > threshold; });
+    size_t equal_quota = max_blocks - std::min(max_blocks, num_above);
+
+    _num_blocks = 0;
+    for (auto file_iter = _files.begin(); file_iter != _files.end();) {
+        auto& blocks = file_iter->second.blocks;
+        for (auto iter = blocks.begin(); iter != blocks.end();) {
+            if (iter->second > threshold || (iter->second == threshold && equal_quota > 0)) {
+                if (iter->second == threshold) {
+                    equal_quota--;
+                }
+                ++iter;
+            } else {
+                iter = blocks.erase(iter);
+            }
+        }
+        _num_blocks += blocks.size();
+        file_iter = blocks.empty() ? _files.erase(file_iter) : std::next(file_iter);
+    }
+}
+
+Status CacheWarmup::save_manifest() {
+    std::string content;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        _shrink(static_cast<size_t>(std::max<int64_t>(0, config::datacache_warmup_max_blocks)));
+        for (const auto& [filename, access] : _files) {
+            content.append(fmt::format("{}\t{}\t", access.size, access.modification_time));
+            bool first = true;
+            for (const auto& [offset, count] : access.blocks) {
+                content.append(fmt::format("{}{}:{}", first ? "" : ",", offset, count));
+                first = false;
+            }
+            content.append(fmt::format("\t{}\n", filename));
+        }
+    }
+
+    auto fs = FileSystem::Default();
+    std::string tmp_path = _manifest_path + ".tmp";
+    {
+        ASSIGN_OR_RETURN(auto file, fs->new_writable_file(tmp_path));
+        RETURN_IF_ERROR(file->append(content));
+        RETURN_IF_ERROR(file->sync());
+        RETURN_IF_ERROR(file->close());
+    }
+    return fs->rename_file(tmp_path, _manifest_path);
+}
+
+Status CacheWarmup::load_manifest() {
+    auto fs = FileSystem::Default();
+    ASSIGN_OR_RETURN(auto file, fs->new_random_access_file(_manifest_path));
+    ASSIGN_OR_RETURN(auto content, file->read_all());
+
+    auto parse_int = [](std::string_view s, auto* value) {
+        auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), *value);
+        return ec == std::errc() && ptr == s.data() + s.size();
+    };
+
+    // split |s| at the first |delim|, return false if there is none
+    auto next_field = [](std::string_view* s, char delim, std::string_view* field) {
+        auto pos = s->find(delim);
+        if (pos == std::string_view::npos) {
+            return false;
+        }
+        *field = s->substr(0, pos);
+        s->remove_prefix(pos + 1);
+        return true;
+    };
+
+    std::lock_guard<std::mutex> l(_mutex);
+    std::string_view rest(content);
+    while (!rest.empty()) {
+        std::string_view line = rest;
+        if (!next_field(&rest, '\n', &line)) {
+            rest = {};
+        }
+        if (line.empty()) {
+            continue;
+        }
+        std::string_view size_field, mtime_field, blocks_field;
+        std::string_view filename = line;
+        FileAccess access;
+        bool valid = next_field(&filename, '\t', &size_field) && next_field(&filename, '\t', &mtime_field) &&
+                     next_field(&filename, '\t', &blocks_field) && !filename.empty() &&
+                     parse_int(size_field, &access.size) && parse_int(mtime_field, &access.modification_time);
+        while (valid && !blocks_field.empty()) {
+            std::string_view block = blocks_field;
+            if (!next_field(&blocks_field, ',', &block)) {
+                blocks_field = {};
+            }
+            std::string_view offset_field, count_field = block;
+            int64_t offset = 0;
+            uint32_t count = 0;
+            valid = next_field(&count_field, ':', &offset_field) && parse_int(offset_field, &offset) &&
+                    parse_int(count_field, &count);
+            access.blocks.emplace(offset, count);
+        }
+        if (!valid || access.blocks.empty()) {
+            LOG(WARNING) << "skip invalid line in datacache warmup manifest " << _manifest_path << ": " << line;
+            continue;
+        }
+        auto& old_access = _files[std::string(filename)];
+        _num_blocks -= old_access.blocks.size();
+        _num_blocks += access.blocks.size();
+        old_access = std::move(access);
+    }
+    return Status::OK();
+}
+
+void CacheWarmup::warmup() {
+    std::vector<std::pair<std::string, FileAccess>> files;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        files.assign(_files.begin(), _files.end());
+    }
+    int64_t total_blocks = 0;
+    std::vector<std::pair<uint64_t, size_t>> order;
+    for (size_t i = 0; i < files.size(); i++) {
+        uint64_t hits = 0;
+        for (const auto& [_, count] : files[i].second.blocks) {
+            hits += count;
+        }
+        total_blocks += files[i].second.blocks.size();
+        order.emplace_back(hits, i);
+    }
+    _total_blocks.store(total_blocks);
+    // the hottest files first
+    std::sort(order.begin(), order.end(), std::greater<>());
+
+    for (const auto& [_, i] : order) {
+        if (_cancelled.load(std::memory_order_acquire)) {
+            break;
+        }
+        Status st = _warmup_file(files[i].first, files[i].second);
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to warm up datacache for " << files[i].first << ": " << st;
+        }
+    }
+    LOG(INFO) << "datacache warmup finished, total blocks: " << total_blocks << ", cached: " << _cached_blocks.load()
+              << ", loaded: " << _loaded_blocks.load() << ", failed: " << _failed_blocks.load();
+}
+
+Status CacheWarmup::_warmup_file(const std::string& filename, const FileAccess& access) {
+    const int64_t block_size = _cache->block_size();
+    const std::string cache_key = DataCacheUtils::get_cache_key(filename, access.size, access.modification_time);
+
+    std::vector<int64_t> missing_blocks;
+    for (const auto& [offset, _] : access.blocks) {
+        IOBuffer buffer;
+        if (_cache->read_buffer(cache_key, offset, 1, &buffer).ok()) {
+            _cached_blocks++;
+        } else {
+            missing_blocks.push_back(offset);
+        }
+    }
+    if (missing_blocks.empty()) {
+        return Status::OK();
+    }
+    std::sort(missing_blocks.begin(), missing_blocks.end());
+
+    auto read_blocks = [&]() -> Status {
+        ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(filename));
+        ASSIGN_OR_RETURN(auto file_size, fs->get_file_size(filename));
+        if (static_cast<int64_t>(file_size) != access.size) {
+            return Status::NotFound(fmt::format("file size changed from {} to {}", access.size, file_size));
+        }
+        ASSIGN_OR_RETURN(auto file, fs->new_random_access_file(filename));
+        file->set_size(file_size);
+
+        std::string data;
+        for (int64_t offset : missing_blocks) {
+            if (_cancelled.load(std::memory_order_acquire)) {
+                return Status::Cancelled("datacache warmup is stopped");
+            }
+            int64_t size = std::min(block_size, access.size - offset);
+            if (offset % block_size != 0 || size <= 0) {
+                _failed_blocks++;
+                continue;
+            }
+            raw::stl_string_resize_uninitialized(&data, size);
+            RETURN_IF_ERROR(file->read_at_fully(offset, data.data(), size));
+            WriteCacheOptions options;
+            options.skip_admission = true;
+            Status st = _cache->write_buffer(cache_key, offset, size, data.data(), &options);
+            if (st.ok() || st.is_already_exist()) {
+                _loaded_blocks++;
+            } else {
+                _failed_blocks++;
+            }
+        }
+        return Status::OK();
+    };
+
+    int64_t done_before = _loaded_blocks + _failed_blocks;
+    Status st = read_blocks();
+    if (!st.ok()) {
+        // count the blocks which are not handled because of the error as failed
+        int64_t done = _loaded_blocks + _failed_blocks - done_before;
+        _failed_blocks += static_cast<int64_t>(missing_blocks.size()) - done;
+    }
+    return st;
+}
+
+CacheWarmup::Progress CacheWarmup::progress() const {
+    return {.total_blocks = _total_blocks.load(),
+            .cached_blocks = _cached_blocks.load(),
+            .loaded_blocks = _loaded_blocks.load(),
+            .failed_blocks = _failed_blocks.load()};
+}
+
+size_t CacheWarmup::num_blocks() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _num_blocks;
+}
+
+} // namespace starrocks
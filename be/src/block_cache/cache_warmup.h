@@ -0,0 +1,107 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+class BlockCache;
+
+// Tracks the most accessed datacache blocks and saves them to a local manifest periodically.
+// After a restart, the blocks in the manifest that are missing from the cache are read from
+// the remote files again in background, so the cache does not need to be rebuilt by queries.
+//
+// The files are reopened with the default FSOptions, i.e. the credentials of BE, since the credentials of
+// external catalogs are never persisted. So only the files which scans open without a catalog's own cloud
+// configuration are recorded (HdfsScannerParams::enable_datacache_warmup_record), the other ones are not
+// warmed up.
+class CacheWarmup {
+public:
+    struct Progress {
+        int64_t total_blocks = 0;
+        // blocks that are still in the cache and need no reload
+        int64_t cached_blocks = 0;
+        int64_t loaded_blocks = 0;
+        int64_t failed_blocks = 0;
+    };
+
+    CacheWarmup(BlockCache* cache, std::string manifest_path);
+    ~CacheWarmup();
+
+    // Load the manifest and start the background thread which warms up the cache and
+    // saves the manifest every `datacache_warmup_save_interval_seconds`.
+    void start();
+
+    // Stop the background thread and save the manifest.
+    void stop();
+
+    // Record one access of the blocks at |block_offsets| of |filename|.
+    void record(const std::string& filename, int64_t file_size, int64_t modification_time,
+                const std::vector<int64_t>& block_offsets);
+
+    Status save_manifest();
+    Status load_manifest();
+
+    // Read the blocks of the loaded manifest which are missing from the cache.
+    void warmup();
+
+    Progress progress() const;
+
+    size_t num_blocks() const;
+
+private:
+    struct FileAccess {
+        int64_t size = 0;
+        int64_t modification_time = 0;
+        // block offset -> access count
+        std::unordered_map<int64_t, uint32_t> blocks;
+    };
+
+    void _run();
+    bool _is_stopped() const { return _stopped.load(std::memory_order_acquire); }
+    // Drop the least accessed blocks until at most |max_blocks| are left. Requires |_mutex|.
+    void _shrink(size_t max_blocks);
+    Status _warmup_file(const std::string& filename, const FileAccess& access);
+
+    BlockCache* _cache;
+    std::string _manifest_path;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, FileAccess> _files;
+    size_t _num_blocks = 0;
+
+    std::atomic<bool> _stopped = true;
+    // interrupts a running warm-up, only set by stop()
+    std::atomic<bool> _cancelled = false;
+    std::mutex _stop_mutex;
+    std::condition_variable _stop_cv;
+    std::thread _thread;
+
+    std::atomic<int64_t> _total_blocks = 0;
+    std::atomic<int64_t> _cached_blocks = 0;
+    std::atomic<int64_t> _loaded_blocks = 0;
+    std::atomic<int64_t> _failed_blocks = 0;
+};
+
+} // namespace starrocks
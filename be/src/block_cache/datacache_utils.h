@@ -22,6 +22,10 @@ namespace starrocks {
 class DataCacheUtils {
 public:
     static void set_metrics_from_thrift(TDataCacheMetrics& t_metrics, const DataCacheMetrics& metrics);
+
+    // The cache key of a remote file. The modification time, or the file size if the modification
+    // time is unknown, distinguishes the versions of a file.
+    static std::string get_cache_key(const std::string& filename, int64_t file_size, int64_t modification_time);
 };
 
 } // namespace starrocks
\ No newline at end of file
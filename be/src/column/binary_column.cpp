@@ -30,6 +30,65 @@
 
 namespace starrocks {
 
+namespace {
+
+// offsets[i] += offsets[i - 1] for i in [1, n], i.e. turn the string sizes in offsets[1..n] into the end offsets.
+template <typename T>
+void prefix_sum_offsets(T* offsets, size_t n) {
+    size_t i = 1;
+#ifdef __SSE2__
+    if constexpr (sizeof(T) == 4) {
+        __m128i carry = _mm_set1_epi32(offsets[0]);
+        for (; i + 4 <= n + 1; i += 4) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(offsets + i));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi32(x, carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(offsets + i), x);
+            carry = _mm_shuffle_epi32(x, 0xFF);
+        }
+    } else if constexpr (sizeof(T) == 8) {
+        __m128i carry = _mm_set1_epi64x(offsets[0]);
+        for (; i + 2 <= n + 1; i += 2) {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(offsets + i));
+            x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi64(x, carry);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(offsets + i), x);
+            carry = _mm_unpackhi_epi64(x, x);
+        }
+    }
+#endif
+    for (; i <= n; i++) {
+        offsets[i] += offsets[i - 1];
+    }
+}
+
+// Strings of at most SHORT_STRING_SIZE bytes are copied by one fixed-width load and store, which may
+// read and write past the end of the string. It is safe for Bytes, whose allocation has 16 bytes of
+// padding beyond its size, as long as the strings are copied in the order of their destination offsets,
+// so that the garbage written past one string is overwritten by the next one.
+constexpr size_t SHORT_STRING_SIZE = 16;
+
+ALWAYS_INLINE inline void copy_string(uint8_t* __restrict dst, const uint8_t* __restrict src, size_t size) {
+    if (size <= SHORT_STRING_SIZE) {
+        memcpy(dst, src, SHORT_STRING_SIZE);
+    } else {
+        strings::memcpy_inlined(dst, src, size);
+    }
+}
+
+// Move a string to a lower address of the same Bytes. The fixed-width copy is used only if it cannot
+// overwrite the bytes not moved yet, which are all at or after src.
+ALWAYS_INLINE inline void move_string(uint8_t* dst, const uint8_t* src, size_t size) {
+    if (size <= SHORT_STRING_SIZE && src >= dst + SHORT_STRING_SIZE) {
+        memcpy(dst, src, SHORT_STRING_SIZE);
+    } else {
+        memmove(dst, src, size);
+    }
+}
+
+} // namespace
+
 template <typename T>
 void BinaryColumnBase<T>::check_or_die() const {
     CHECK_EQ(_bytes.size(), _offsets.back());
@@ -67,23 +126,26 @@ void BinaryColumnBase<T>::append_selective(const Column& src, const uint32_t* in
     const auto& src_bytes = src_column.get_bytes();
 
     size_t cur_row_count = _offsets.size() - 1;
-    size_t cur_byte_size = _bytes.size();
 
+    // Gather the string sizes, and then compute the output offsets by prefix sum.
     _offsets.resize(cur_row_count + size + 1);
+    T* dest_offsets = _offsets.data() + cur_row_count;
     for (size_t i = 0; i < size; i++) {
         uint32_t row_idx = indexes[from + i];
-        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
-        _offsets[cur_row_count + i + 1] = _offsets[cur_row_count + i] + str_size;
-        cur_byte_size += str_size;
+        dest_offsets[i + 1] = src_offsets[row_idx + 1] - src_offsets[row_idx];
     }
-    _bytes.resize(cur_byte_size);
+    prefix_sum_offsets(dest_offsets, size);
+    _bytes.resize(dest_offsets[size]);
 
-    auto* dest_bytes = _bytes.data();
-    for (size_t i = 0; i < size; i++) {
-        uint32_t row_idx = indexes[from + i];
-        T str_size = src_offsets[row_idx + 1] - src_offsets[row_idx];
-        strings::memcpy_inlined(dest_bytes + _offsets[cur_row_count + i], src_bytes.data() + src_offsets[row_idx],
-                                str_size);
+    // Both _bytes and src_bytes are non-empty if any string is non-empty, so their padding can be accessed.
+    if (dest_offsets[size] > dest_offsets[0]) {
+        auto* dest_bytes = _bytes.data();
+        const auto* src_data = src_bytes.data();
+        for (size_t i = 0; i < size; i++) {
+            uint32_t row_idx = indexes[from + i];
+            copy_string(dest_bytes + dest_offsets[i], src_data + src_offsets[row_idx],
+                        dest_offsets[i + 1] - dest_offsets[i]);
+        }
     }
 
     _slices_cache = false;
@@ -466,7 +528,7 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
 
                 T size = _offsets[start_offset + i + 1] - _offsets[start_offset + i];
                 // copy date
-                memmove(data + _offsets[result_offset], data + _offsets[start_offset + i], size);
+                move_string(data + _offsets[result_offset], data + _offsets[start_offset + i], size);
 
                 // set offsets
                 _offsets[result_offset + 1] = _offsets[result_offset] + size;
@@ -484,7 +546,7 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
             DCHECK_GE(_offsets[i + 1], _offsets[i]);
             T size = _offsets[i + 1] - _offsets[i];
             // copy data
-            memmove(data + _offsets[result_offset], data + _offsets[i], size);
+            move_string(data + _offsets[result_offset], data + _offsets[i], size);
 
             // set offsets
             _offsets[result_offset + 1] = _offsets[result_offset] + size;
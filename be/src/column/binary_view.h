@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "util/slice.h"
+#include "util/unaligned_access.h"
+
+namespace starrocks {
+
+// A 16-byte view of a string with an inline prefix, laid out as
+//
+//   | size (4B) | prefix (4B) | the rest of the string, zero padded (8B) |  if size <= INLINE_SIZE
+//   | size (4B) | prefix (4B) | pointer to the whole string (8B)         |  otherwise
+//
+// The size and the prefix decide most comparisons without touching the referenced data, so the
+// views are used where the same strings are compared many times, e.g. the sort keys and the keys
+// of the join hash table, while BinaryColumn stays the storage of the strings.
+// A view never owns the referenced data, and must not outlive the column it is created from.
+class BinaryView {
+public:
+    static constexpr uint32_t PREFIX_SIZE = 4;
+    static constexpr uint32_t INLINE_SIZE = 12;
+
+    BinaryView() : _size(0), _prefix{}, _ptr(nullptr) {}
+
+    // Implicit, so that a view can be assigned from the slices of a BinaryColumn.
+    BinaryView(const Slice& s) : _size(static_cast<uint32_t>(s.size)) {
+        if (_size <= INLINE_SIZE) {
+            memset(_inline_data(), 0, INLINE_SIZE);
+            if (_size > 0) {
+                memcpy(_inline_data(), s.data, _size);
+            }
+        } else {
+            memcpy(_prefix, s.data, PREFIX_SIZE);
+            _ptr = s.data;
+        }
+    }
+
+    uint32_t size() const { return _size; }
+    bool is_inlined() const { return _size <= INLINE_SIZE; }
+    const char* data() const { return is_inlined() ? _inline_data() : _ptr; }
+    Slice to_slice() const { return {data(), _size}; }
+
+    // Return a negative value, zero or a positive value like Slice::compare().
+    int compare(const BinaryView& rhs) const {
+        // Bytes beyond the size are zero, so comparing the prefixes in big endian gives the order
+        // of the first PREFIX_SIZE bytes, and a shorter string never compares greater by them.
+        uint32_t lhs_prefix = __builtin_bswap32(unaligned_load<uint32_t>(_prefix));
+        uint32_t rhs_prefix = __builtin_bswap32(unaligned_load<uint32_t>(rhs._prefix));
+        if (lhs_prefix != rhs_prefix) {
+            return lhs_prefix < rhs_prefix ? -1 : 1;
+        }
+        if (is_inlined() && rhs.is_inlined()) {
+            uint64_t lhs_rest = __builtin_bswap64(unaligned_load<uint64_t>(_rest));
+            uint64_t rhs_rest = __builtin_bswap64(unaligned_load<uint64_t>(rhs._rest));
+            if (lhs_rest != rhs_rest) {
+                return lhs_rest < rhs_rest ? -1 : 1;
+            }
+            return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+        }
+        if (_size <= PREFIX_SIZE || rhs._size <= PREFIX_SIZE) {
+            // One string is a prefix of the other one.
+            return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+        }
+        return memcompare(data() + PREFIX_SIZE, _size - PREFIX_SIZE, rhs.data() + PREFIX_SIZE,
+                          rhs._size - PREFIX_SIZE);
+    }
+
+    bool operator==(const BinaryView& rhs) const {
+        // The size and the prefix are compared at once.
+        if (unaligned_load<uint64_t>(this) != unaligned_load<uint64_t>(&rhs)) {
+            return false;
+        }
+        if (is_inlined()) {
+            return unaligned_load<uint64_t>(_rest) == unaligned_load<uint64_t>(rhs._rest);
+        }
+        return memequal(_ptr + PREFIX_SIZE, _size - PREFIX_SIZE, rhs._ptr + PREFIX_SIZE, _size - PREFIX_SIZE);
+    }
+    bool operator!=(const BinaryView& rhs) const { return !(*this == rhs); }
+    bool operator<(const BinaryView& rhs) const { return compare(rhs) < 0; }
+
+private:
+    // The inlined string starts at the prefix.
+    char* _inline_data() { return reinterpret_cast<char*>(this) + sizeof(uint32_t); }
+    const char* _inline_data() const { return reinterpret_cast<const char*>(this) + sizeof(uint32_t); }
+
+    uint32_t _size;
+    char _prefix[PREFIX_SIZE];
+    union {
+        char _rest[INLINE_SIZE - PREFIX_SIZE];
+        const char* _ptr;
+    };
+};
+
+static_assert(sizeof(BinaryView) == 16, "BinaryView must be 16 bytes");
+
+} // namespace starrocks
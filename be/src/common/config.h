@@ -227,6 +227,10 @@ CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// Whether full sort on a single INT/BIGINT/DATE/DATETIME key could use LSD radix sort.
+CONF_mBool(enable_sort_radix_sort, "true");
+// The minimum rows of a partial sorted run to use radix sort, comparison sort is faster for small runs.
+CONF_mInt64(sort_radix_sort_min_rows, "65536");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
@@ -303,6 +307,20 @@ CONF_Int32(cumulative_compaction_num_threads_per_disk, "1");
 // when candidate num reach this value, the condidate with lowest score will be dropped.
 CONF_mInt64(max_compaction_candidate_num, "40960");
 
+// Weight of the read amplification observed by queries when ranking compaction candidates.
+// A candidate's score is multiplied by (1 + weight * read_amp_score), where read_amp_score is the
+// number of rows a compaction is expected to save per byte of the candidate's input rowsets. 0 disables the boost.
+// Only the compaction of local tablets is affected, cloud native tablets are compacted as scheduled by FE.
+CONF_mDouble(compaction_read_amp_score_weight, "1.0");
+// Number of rows that reading one extra segment is treated as costing when estimating read_amp_score.
+CONF_mInt64(compaction_read_amp_segment_cost_rows, "4096");
+// Upper bound of the factor (1 + weight * read_amp_score), so that the read amplification can only reorder
+// candidates of similar compaction scores.
+CONF_mDouble(compaction_read_amp_max_score_factor, "4.0");
+// The read statistics behind read_amp_score are halved every this many seconds, so that the scans of a
+// while ago weigh less than the recent ones on tablets which are not compacted. <= 0 disables the decay.
+CONF_mInt64(compaction_read_amp_decay_interval_sec, "3600");
+
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
 
@@ -349,6 +367,12 @@ CONF_mBool(enable_rowset_verify, "false");
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
 
+// If enabled, compaction of duplicate key tablets links input segments whose sort key range does not
+// overlap any other input segment into the output rowset instead of rewriting them.
+CONF_mBool(enable_compaction_segment_reuse, "true");
+// Only input segments at least this large are linked, smaller ones are still merged to reduce the segment count.
+CONF_mInt64(compaction_segment_reuse_min_bytes, "268435456");
+
 CONF_Bool(enable_event_based_compaction_framework, "true");
 
 CONF_Bool(enable_size_tiered_compaction_strategy, "true");
@@ -418,6 +442,11 @@ CONF_mInt64(streaming_load_max_mb, "102400");
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 CONF_mInt64(streaming_load_max_batch_size_mb, "100");
+// A JSON array loaded with strip_outer_array=true and without json_root is streamed to the scanner,
+// which parses the elements window by window, so it's not limited by streaming_load_max_batch_size_mb.
+CONF_mBool(enable_streaming_load_json_array, "true");
+// The minimum bytes of complete JSON array elements parsed in one window.
+CONF_mInt64(streaming_load_json_array_window_bytes, "4194304");
 // The alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -467,6 +496,18 @@ CONF_Bool(use_mmap_allocate_chunk, "false");
 // acquire more free memory which can not be used by other modules
 CONF_Int64(chunk_reserved_bytes_limit, "2147483648");
 
+// Back the large and randomly accessed buffers of some operators with 2MB huge pages to reduce TLB misses:
+// the bucket arrays of join hash tables, the aggregation hash maps and the sort permutation of full sort.
+// Only the buffers of at least huge_page_alloc_min_bytes are affected, and only the buffers created after
+// the config is changed.
+CONF_mBool(enable_huge_page_for_join_hash_table, "false");
+CONF_mBool(enable_huge_page_for_agg_hash_map, "false");
+CONF_mBool(enable_huge_page_for_sort_buffer, "false");
+CONF_mInt64(huge_page_alloc_min_bytes, "33554432");
+// Try the explicit huge pages reserved in the hugetlbfs pool (vm.nr_hugepages) first,
+// and fall back to transparent huge pages when the pool is exhausted.
+CONF_mBool(huge_page_alloc_use_hugetlb, "false");
+
 // for pprof
 CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
 
@@ -507,6 +548,10 @@ CONF_Int32(memory_max_alignment, "16");
 
 // write buffer size before flush
 CONF_mInt64(write_buffer_size, "104857600");
+// Whether a memtable checks if the loaded rows come in the order of the sort key, e.g. the files
+// written sorted and bucketed by Spark, and skips the sort and the aggregation of them if so.
+// A memtable falls back to sort the rows once it finds any row out of order.
+CONF_mBool(enable_memtable_sorted_input_fast_path, "false");
 
 // Following 2 configs limit the memory consumption of load process on a Backend.
 // eg: memory limit to 80% of mem limit config but up to 100GB(default)
@@ -761,11 +806,22 @@ CONF_Int64(pipeline_scan_queue_mode, "0");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_scan_queue_level_time_slice_base_ns, "100000000");
 CONF_Double(pipeline_scan_queue_ratio_of_adjacent_queue, "1.5");
+// Partition the pipeline and scan executor threads by NUMA node, and run the drivers and scan tasks of
+// a fragment instance on the threads of one node, so the memory they allocate stays node-local.
+// Only takes effect on machines with more than one NUMA node.
+CONF_Bool(enable_pipeline_numa_aware_scheduling, "false");
 
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Evaluate MIN/MAX/ANY_VALUE over bounded ROWS frames with a tree of partial aggregate states, so each row
+// merges O(fanout * log(frame)) states instead of re-aggregating the whole frame. Off by default until it is
+// measured on more workloads, see be/src/bench/analytor_bench.cpp.
+CONF_Bool(pipeline_analytic_enable_segment_tree_process, "false");
+// Frames smaller than this are cheaper to re-aggregate directly.
+CONF_Int32(pipeline_analytic_segment_tree_min_frame_size, "64");
+CONF_Int32(pipeline_analytic_segment_tree_fanout, "16");
 CONF_Int32(pipline_limit_max_delivery, "4096");
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
@@ -829,6 +885,10 @@ CONF_Strings(s3_compatible_fs_list, "s3n://, s3a://, s3://, oss://, cos://, cosn
 
 // Lake
 CONF_mBool(io_coalesce_lake_read_enable, "false");
+// Number of bytes read from the end of a lake segment file when opening it. The footer and the
+// short key index page are usually both within this range, so they are fetched by one request.
+// Set to 0 to read only the footer.
+CONF_mInt64(lake_segment_open_prefetch_tail_bytes, "65536");
 
 // orc reader
 CONF_Bool(enable_orc_late_materialization, "true");
@@ -848,10 +908,18 @@ CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
 CONF_mBool(parquet_statistics_process_more_filter_enable, "true");
+// prune row groups by the split block bloom filters of column chunks with `col = x` and `col in (...)` predicates
+CONF_mBool(parquet_reader_bloom_filter_enable, "true");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Read the coalesced io ranges of the following parquet row groups and orc streams in background,
+// so that the network transfer overlaps with decoding.
+CONF_mBool(io_prefetch_enable, "true");
+// The max bytes of the prefetched but not yet consumed data of one file.
+CONF_mInt64(io_prefetch_max_buffer_bytes, "67108864");
+CONF_Int32(io_prefetch_thread_num, "32");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -1078,6 +1146,24 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// The admission policy for blocks read from remote. "none" writes every block into datacache,
+// "frequency" writes a block only after it has been read `datacache_admission_min_frequency` times.
+CONF_String(datacache_admission_policy, "none");
+CONF_mInt32(datacache_admission_min_frequency, "2");
+// Number of counters in each row of the frequency sketch used by the "frequency" admission policy.
+CONF_Int64(datacache_admission_sketch_counters, "1048576");
+// Reads not larger than this are usually metadata such as footers and page indexes. Their blocks
+// skip the admission policy and are always written into datacache.
+CONF_mInt64(datacache_admission_small_read_bytes, "65536");
+// Record the most accessed datacache blocks to a manifest in the datacache meta path (or the first
+// disk path), and reload the ones missing from the cache in background after a restart.
+CONF_Bool(datacache_warmup_enable, "false");
+CONF_mInt64(datacache_warmup_save_interval_seconds, "600");
+// The maximum number of blocks kept in the warm-up manifest.
+CONF_mInt64(datacache_warmup_max_blocks, "100000");
+// Stop populating datacache from a file once more than this many bytes of it have been read
+// sequentially from remote, so large scans do not evict the hot data. 0 means no limit.
+CONF_mInt64(datacache_sequential_scan_bypass_bytes, "0");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1204,10 +1290,16 @@ CONF_String(rocksdb_db_options_string, "create_if_missing=true;create_missing_co
 
 // limit local exchange buffer's memory size per driver
 CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
+// Spread the rows of heavy group-by keys across the drivers of the local shuffle before an aggregation whose
+// output is merged by another aggregation on the same keys (marked by FE), instead of sending them to one driver.
+CONF_mBool(enable_local_shuffle_spread_heavy_keys, "false");
 // only used for test. default: 128M
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// In the AUTO streaming pre-aggregation mode, only pre-aggregate the rows of the heavy-hitter group-by keys
+// found by a frequency sketch, and stream the other rows through.
+CONF_mBool(enable_streaming_agg_heavy_hitter_preaggregation, "false");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1235,6 +1327,29 @@ CONF_mInt32(primary_key_limit_size, "128");
 // used for control the max memory cost when batch get pk index in each tablet
 CONF_mInt64(primary_key_batch_get_index_memory_limit, "104857600"); // 100MB
 
+// Memory budget of the row cache of primary key tables, which caches the rows read by point lookup
+// queries. 0 means disabled.
+CONF_mInt64(primary_key_row_cache_capacity, "0");
+
+// Dump the in-memory primary index of a tablet to a snapshot file at apply time, so that the index can be restored
+// from the snapshot after restart instead of scanning primary keys of all rowsets. Only rowsets applied after the
+// snapshot are scanned.
+CONF_mBool(enable_primary_index_snapshot, "false");
+// Min interval between two snapshots of the primary index of a tablet.
+CONF_mInt64(primary_index_snapshot_interval_sec, "600");
+// Only primary indexes with more rows than this value are dumped.
+CONF_mInt64(primary_index_snapshot_min_rows, "1000000");
+// Number of threads writing snapshots of primary indexes to files.
+CONF_Int32(primary_index_snapshot_worker_count, "1");
+
+// Number of threads to upsert a segment into the in-memory primary index during apply, keys are split by the
+// submaps of index so that threads never touch the same submap. At most 16, 1 means sequential upsert.
+// Tablets with persistent index still upsert sequentially: the l0 of persistent index has a single shard per
+// key length, so there is nothing to split the keys of a segment by.
+CONF_mInt32(primary_index_parallel_upsert_num_threads, "8");
+// Segments with fewer rows than this value are upserted sequentially.
+CONF_mInt64(primary_index_parallel_upsert_min_rows, "65536");
+
 // If your sort key cardinality is very high,
 // You could enable this config to speed up the point lookup query,
 // otherwise, StarRocks will use zone map for one column filter
@@ -1287,6 +1402,24 @@ CONF_mInt32(json_flat_internal_column_min_limit, "5");
 // the maximum number of extracted JSON sub-field
 CONF_mInt32(json_flat_column_max, "20");
 
+// build page/segment zone maps on the flattened scalar sub-columns, so that predicates like
+// `get_json_int(c, '$.a') > 10` can prune segments and pages
+CONF_mBool(enable_json_flat_zone_map, "true");
+
+// build bloom filter indexes on the flattened scalar sub-columns, used by equality predicates
+CONF_mBool(enable_json_flat_bloom_filter, "false");
+
+// prefer the json paths which are frequently read when deciding what to flatten, so that compaction
+// converges the flat schema of segments in a tablet to the hot paths
+CONF_mBool(enable_json_flat_hot_paths, "true");
+
+// a json path is hot if it accounts for at least this fraction of all the json path reads of a tablet
+CONF_mDouble(json_flat_hot_path_min_ratio, "0.05");
+
+// The json path read counts of a column are halved every this many seconds, so that the paths which are no longer
+// read stop being hot. <= 0 disables the decay.
+CONF_mInt64(json_flat_hot_path_decay_interval_sec, "3600");
+
 // Allowable intervals for continuous generation of pk dumps
 // Disable when pk_dump_interval_seconds <= 0
 CONF_mInt64(pk_dump_interval_seconds, "3600"); // 1 hour
@@ -1309,6 +1442,10 @@ CONF_mBool(enable_light_pk_compaction_publish, "true");
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
 
+// An OR-chain of at least this many LIKE/REGEXP predicates with constant patterns on the same column
+// is evaluated by one multi-pattern hyperscan scan. Set to 0 to disable it.
+CONF_mInt32(like_multi_pattern_min_predicates, "3");
+
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
 CONF_mInt64(arrow_read_batch_size, "4096");
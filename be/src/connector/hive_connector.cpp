@@ -412,6 +412,11 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.shared_buffered_direct_io_count =
                 ADD_CHILD_COUNTER(_runtime_profile, "DirectIOCount", TUnit::UNIT, prefix);
         _profile.shared_buffered_direct_io_timer = ADD_CHILD_TIMER(_runtime_profile, "DirectIOTime", prefix);
+        _profile.shared_buffered_prefetch_hit_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchHitBytes", TUnit::BYTES, prefix);
+        _profile.shared_buffered_prefetch_wasted_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchWastedBytes", TUnit::BYTES, prefix);
+        _profile.shared_buffered_prefetch_wait_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchWaitTime", prefix);
     }
 
     if (_use_datacache) {
@@ -438,6 +443,10 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheWriteFailCounter", TUnit::UNIT, prefix);
         _profile.datacache_write_fail_bytes =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheWriteFailBytes", TUnit::BYTES, prefix);
+        _profile.datacache_skip_write_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheSkipWriteCounter", TUnit::UNIT, prefix);
+        _profile.datacache_skip_write_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheSkipWriteBytes", TUnit::BYTES, prefix);
         _profile.datacache_read_block_buffer_counter =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferCounter", TUnit::UNIT, prefix);
         _profile.datacache_read_block_buffer_bytes =
@@ -488,6 +497,12 @@ void HiveDataSource::_init_rf_counters() {
     }
 }
 
+// Whether the files are opened with the cloud configuration of the catalog rather than the one of BE.
+static bool has_own_credentials(const TCloudConfiguration& cloud_configuration) {
+    return (cloud_configuration.__isset.cloud_type && cloud_configuration.cloud_type != TCloudType::DEFAULT) ||
+           !cloud_configuration.cloud_properties_v2.empty() || !cloud_configuration.cloud_properties.empty();
+}
+
 Status HiveDataSource::_init_scanner(RuntimeState* state) {
     SCOPED_TIMER(_profile.open_file_timer);
 
@@ -567,6 +582,10 @@ Status HiveDataSource::_init_scanner(RuntimeState* state) {
     scanner_params.enable_datacache_async_populate_mode = _enable_datacache_aync_populate_mode;
     scanner_params.enable_datacache_io_adaptor = _enable_datacache_io_adaptor;
     scanner_params.datacache_evict_probability = _datacache_evict_probability;
+    // The warm-up reopens the files with the default FSOptions, so skip the files read with the credentials
+    // of the catalog, which are not persisted.
+    scanner_params.enable_datacache_warmup_record =
+            !hdfs_scan_node.__isset.cloud_configuration || !has_own_credentials(hdfs_scan_node.cloud_configuration);
     scanner_params.can_use_any_column = _can_use_any_column;
     scanner_params.can_use_min_max_count_opt = _can_use_min_max_count_opt;
     scanner_params.use_file_metacache = _use_file_metacache;
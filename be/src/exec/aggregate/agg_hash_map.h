@@ -30,6 +30,7 @@
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/mem_pool.h"
+#include "runtime/memory/huge_page_allocator.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
@@ -41,47 +42,54 @@ const constexpr int32_t prefetch_threhold = 8192;
 
 using AggDataPtr = uint8_t*;
 
+// The hash maps of a large aggregation are probed randomly, so large ones are backed by huge pages if enabled.
+template <typename K>
+using AggHashMapAllocator = HugePageStlAllocator<phmap::priv::Pair<const K, AggDataPtr>, HugePageUsage::AGG_HASH_MAP>;
+
+template <typename K, typename Hash, typename Eq = phmap::priv::hash_default_eq<K>>
+using AggFlatHashMap = phmap::flat_hash_map<K, AggDataPtr, Hash, Eq, AggHashMapAllocator<K>>;
+
 // =====================
 // one level agg hash map
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
-using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashMap = AggFlatHashMap<int16_t, StdHashWithSeed<int16_t, seed>>;
 template <PhmapSeed seed>
-using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggHashMap = AggFlatHashMap<int32_t, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
-using Int64AggHashMap = phmap::flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
+using Int64AggHashMap = AggFlatHashMap<int64_t, StdHashWithSeed<int64_t, seed>>;
 template <PhmapSeed seed>
-using Int128AggHashMap = phmap::flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
+using Int128AggHashMap = AggFlatHashMap<int128_t, Hash128WithSeed<seed>>;
 template <PhmapSeed seed>
-using DateAggHashMap = phmap::flat_hash_map<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>>;
+using DateAggHashMap = AggFlatHashMap<DateValue, StdHashWithSeed<DateValue, seed>>;
 template <PhmapSeed seed>
-using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
+using TimeStampAggHashMap = AggFlatHashMap<TimestampValue, StdHashWithSeed<TimestampValue, seed>>;
 template <PhmapSeed seed>
-using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
+using SliceAggHashMap = AggFlatHashMap<Slice, SliceHashWithSeed<seed>, SliceEqual>;
 
 // ==================
 // one level fixed size slice hash map
 template <PhmapSeed seed>
-using FixedSize4SliceAggHashMap = phmap::flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+using FixedSize4SliceAggHashMap = AggFlatHashMap<SliceKey4, FixedSizeSliceKeyHash<SliceKey4, seed>>;
 template <PhmapSeed seed>
-using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+using FixedSize8SliceAggHashMap = AggFlatHashMap<SliceKey8, FixedSizeSliceKeyHash<SliceKey8, seed>>;
 template <PhmapSeed seed>
-using FixedSize16SliceAggHashMap =
-        phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+using FixedSize16SliceAggHashMap = AggFlatHashMap<SliceKey16, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
 // =====================
 // two level agg hash map
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>,
+                                      phmap::priv::hash_default_eq<int32_t>, AggHashMapAllocator<int32_t>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
 static constexpr uint8_t PHMAPN = 4;
 template <PhmapSeed seed>
-using SliceAggTwoLevelHashMap =
-        phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
-                                      phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
+using SliceAggTwoLevelHashMap = phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
+                                                              AggHashMapAllocator<Slice>, PHMAPN>;
 
 // This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
 static constexpr size_t AGG_HASH_MAP_DEFAULT_PREFETCH_DIST = 16;
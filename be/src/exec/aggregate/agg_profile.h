@@ -31,6 +31,9 @@ struct AggStatistics {
         input_row_count = ADD_COUNTER(runtime_profile, "InputRowCount", TUnit::UNIT);
         hash_table_size = ADD_COUNTER(runtime_profile, "HashTableSize", TUnit::UNIT);
         pass_through_row_count = ADD_COUNTER(runtime_profile, "PassThroughRowCount", TUnit::UNIT);
+        preagg_row_count = ADD_COUNTER(runtime_profile, "PreAggRowCount", TUnit::UNIT);
+        preagg_reduced_row_count = ADD_COUNTER(runtime_profile, "PreAggReducedRowCount", TUnit::UNIT);
+        heavy_hitter_row_count = ADD_COUNTER(runtime_profile, "HeavyHitterRowCount", TUnit::UNIT);
         rows_returned_counter = ADD_COUNTER(runtime_profile, "RowsReturned", TUnit::UNIT);
         state_destroy_timer = ADD_TIMER(runtime_profile, "StateDestroy");
         allocate_state_timer = ADD_TIMER(runtime_profile, "StateAllocate");
@@ -61,6 +64,12 @@ struct AggStatistics {
     RuntimeProfile::Counter* group_by_append_timer{};
     // hash streaming aggregate pass through rows
     RuntimeProfile::Counter* pass_through_row_count{};
+    // hash streaming aggregate rows aggregated into the hash table
+    RuntimeProfile::Counter* preagg_row_count{};
+    // hash streaming aggregate rows merged into existing groups, i.e. the rows removed by pre-aggregation
+    RuntimeProfile::Counter* preagg_reduced_row_count{};
+    // hash streaming aggregate rows pre-aggregated as heavy hitters
+    RuntimeProfile::Counter* heavy_hitter_row_count{};
     // timer for get input from hash table
     RuntimeProfile::Counter* expr_compute_timer{};
     // timer for result input from hash table
@@ -204,14 +204,21 @@ pipeline::OpFactories DistinctBlockingNode::decompose_to_pipeline(pipeline::Pipe
             _tnode.agg_node.__isset.use_per_bucket_optimize && _tnode.agg_node.use_per_bucket_optimize;
     bool could_local_shuffle = context->could_local_shuffle(ops_with_sink);
 
-    auto try_interpolate_local_shuffle = [this, context](auto& ops) {
-        return context->maybe_interpolate_local_shuffle_exchange(runtime_state(), id(), ops, [this]() {
-            std::vector<ExprContext*> group_by_expr_ctxs;
-            WARN_IF_ERROR(Expr::create_expr_trees(_pool, _tnode.agg_node.grouping_exprs, &group_by_expr_ctxs,
-                                                  runtime_state(), true),
-                          "create grouping expr failed");
-            return group_by_expr_ctxs;
-        });
+    // Set by FE only if the output is merged by another aggregation on the same grouping keys, so the rows of
+    // one key could be spread across the drivers when the key is heavy.
+    const bool spread_heavy_keys =
+            _tnode.agg_node.__isset.local_shuffle_spread_heavy_keys && _tnode.agg_node.local_shuffle_spread_heavy_keys;
+    auto try_interpolate_local_shuffle = [this, context, spread_heavy_keys](auto& ops) {
+        return context->maybe_interpolate_local_shuffle_exchange(
+                runtime_state(), id(), ops,
+                [this]() {
+                    std::vector<ExprContext*> group_by_expr_ctxs;
+                    WARN_IF_ERROR(Expr::create_expr_trees(_pool, _tnode.agg_node.grouping_exprs, &group_by_expr_ctxs,
+                                                          runtime_state(), true),
+                                  "create grouping expr failed");
+                    return group_by_expr_ctxs;
+                },
+                spread_heavy_keys);
     };
 
     // Local shuffle does not guarantee orderliness, so sorted streaming agg should not be introduced
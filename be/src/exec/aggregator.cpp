@@ -33,6 +33,8 @@
 #include "runtime/descriptors.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
+#include "util/defer_op.h"
+#include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -71,6 +73,65 @@ bool AggrAutoContext::is_low_reduction(const size_t agg_count, const size_t chun
     return agg_count <= LowReduction * chunk_size;
 }
 
+size_t AggrHeavyHitterContext::select_heavy_rows(const Columns& key_columns, size_t num_rows,
+                                                 std::vector<uint8_t>* selection) {
+    hash_values.assign(num_rows, HashUtil::FNV_SEED);
+    for (const auto& column : key_columns) {
+        column->fnv_hash(hash_values.data(), 0, num_rows);
+    }
+
+    const uint32_t min_count = std::max<uint64_t>(MinHeavyCount, sketch.total() / HeavyShareInverse);
+    selection->resize(num_rows);
+    size_t num_heavy_rows = 0;
+    for (size_t i = 0; i < num_rows; ++i) {
+        (*selection)[i] = sketch.add(hash_values[i]) >= min_count;
+        num_heavy_rows += (*selection)[i];
+    }
+    return num_heavy_rows;
+}
+
+void AggrHeavyHitterContext::finish_chunk(size_t num_rows, size_t num_heavy_rows, size_t ht_allocated_bytes) {
+    window_chunks++;
+    window_rows += num_rows;
+    window_heavy_rows += num_heavy_rows;
+    if (window_chunks < WindowChunks) {
+        return;
+    }
+
+    const auto prev_mode = mode;
+    const double heavy_ratio = window_rows == 0 ? 0 : window_heavy_rows * 1.0 / window_rows;
+    if (ht_allocated_bytes >= AggrAutoContext::MaxHtSize) {
+        mode = AggrHeavyHitterMode::SELECTIVE_PREAGG;
+    } else if (heavy_ratio >= HighHeavyRatio) {
+        mode = AggrHeavyHitterMode::PREAGG;
+    } else if (heavy_ratio < LowHeavyRatio) {
+        mode = AggrHeavyHitterMode::PASS_THROUGH;
+    } else {
+        mode = AggrHeavyHitterMode::SPLIT;
+    }
+    VLOG_ROW << "heavy hitter agg: heavy ratio " << heavy_ratio << " " << get_mode_string(prev_mode) << " -> "
+             << get_mode_string(mode);
+
+    sketch.decay();
+    window_chunks = 0;
+    window_rows = 0;
+    window_heavy_rows = 0;
+}
+
+std::string AggrHeavyHitterContext::get_mode_string(AggrHeavyHitterMode mode) {
+    switch (mode) {
+    case AggrHeavyHitterMode::SPLIT:
+        return "SPLIT";
+    case AggrHeavyHitterMode::PASS_THROUGH:
+        return "PASS_THROUGH";
+    case AggrHeavyHitterMode::PREAGG:
+        return "PREAGG";
+    case AggrHeavyHitterMode::SELECTIVE_PREAGG:
+        return "SELECTIVE_PREAGG";
+    }
+    return "UNKNOWN";
+}
+
 Status init_udaf_context(int64_t fid, const std::string& url, const std::string& checksum, const std::string& symbol,
                          FunctionContext* context);
 
@@ -1351,6 +1412,38 @@ void Aggregator::build_hash_map_with_selection(size_t chunk_size) {
     });
 }
 
+void Aggregator::build_hash_map_with_selected_rows(size_t chunk_size, const std::vector<uint8_t>& selection,
+                                                   size_t num_selected_rows) {
+    DCHECK_EQ(chunk_size, selection.size());
+    std::vector<uint32_t> indexes;
+    indexes.reserve(num_selected_rows);
+    for (uint32_t i = 0; i < chunk_size; ++i) {
+        if (selection[i]) {
+            indexes.push_back(i);
+        }
+    }
+
+    // The hash map is built with the selected keys only, and the whole group by columns are restored afterwards
+    // for the unselected rows to be streamed.
+    Columns group_by_columns = _group_by_columns;
+    for (auto& column : _group_by_columns) {
+        auto selected = column->clone_empty();
+        selected->append_selective(*column, indexes.data(), 0, indexes.size());
+        column = std::move(selected);
+    }
+    DeferOp restore([&]() { _group_by_columns = std::move(group_by_columns); });
+    build_hash_map(indexes.size());
+
+    // Scatter the states to the positions of their rows, backwards as indexes[i] >= i.
+    for (size_t i = indexes.size(); i > 0; --i) {
+        _tmp_agg_states[indexes[i - 1]] = _tmp_agg_states[i - 1];
+    }
+    _streaming_selection.resize(chunk_size);
+    for (size_t i = 0; i < chunk_size; ++i) {
+        _streaming_selection[i] = !selection[i];
+    }
+}
+
 // When meets not found group keys, mark the first pos into `_streaming_selection` and insert into the hashmap
 // so the following group keys(same as the first not found group keys) are not marked as non-founded.
 // This can be used for stream mv so no need to find multi times for the same non-found group keys.
@@ -43,6 +43,7 @@
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/count_min_sketch.h"
 #include "util/defer_op.h"
 
 namespace starrocks {
@@ -183,6 +184,44 @@ struct AggrAutoContext {
     size_t continuous_limit = 100;
 };
 
+enum class AggrHeavyHitterMode { SPLIT, PASS_THROUGH, PREAGG, SELECTIVE_PREAGG };
+
+// Pre-aggregate only the rows of the heavy-hitter group-by keys in the AUTO streaming pre-aggregation mode,
+// if config::enable_streaming_agg_heavy_hitter_preaggregation is on.
+//
+// The frequencies of the keys are estimated by a count-min sketch over their hash values. A row is heavy
+// once its key takes at least 1/HeavyShareInverse of the recent rows, and the heavy rows are aggregated
+// into the hash table, which holds few keys. The other rows, mostly the long tail of rare keys, are streamed
+// through without touching the hash table.
+//
+// The mode is re-evaluated at the end of each window of WindowChunks chunks, by the ratio of heavy rows
+// in the window: SPLIT the chunks into heavy and other rows, stream all the rows (PASS_THROUGH) if few of them
+// are heavy, aggregate all the rows (PREAGG) if most of them are heavy, or aggregate only the rows of the keys
+// already in the hash table (SELECTIVE_PREAGG) if the hash table is too large. The sketch decays per window.
+struct AggrHeavyHitterContext {
+    static constexpr size_t WindowChunks = 16;
+    static constexpr uint32_t HeavyShareInverse = 1024;
+    static constexpr uint32_t MinHeavyCount = 16;
+    static constexpr double LowHeavyRatio = 0.05;
+    static constexpr double HighHeavyRatio = 0.9;
+
+    // Set selection[i] to 1 if the i-th row is heavy by the hash values of key_columns,
+    // and return the number of heavy rows.
+    size_t select_heavy_rows(const Columns& key_columns, size_t num_rows, std::vector<uint8_t>* selection);
+    // Account a chunk to the current window, and decide the mode of the next window at the end of the window.
+    void finish_chunk(size_t num_rows, size_t num_heavy_rows, size_t ht_allocated_bytes);
+
+    static std::string get_mode_string(AggrHeavyHitterMode mode);
+
+    AggrHeavyHitterMode mode = AggrHeavyHitterMode::SPLIT;
+    CountMinSketch sketch;
+    std::vector<uint32_t> hash_values;
+    std::vector<uint8_t> selection;
+    size_t window_chunks = 0;
+    size_t window_rows = 0;
+    size_t window_heavy_rows = 0;
+};
+
 struct StreamingHtMinReductionEntry {
     int min_ht_mem;
     double streaming_ht_min_reduction;
@@ -306,6 +345,7 @@ public:
     const AggHashSetVariant& hash_set_variant() { return _hash_set_variant; }
     std::any& it_hash() { return _it_hash; }
     const std::vector<uint8_t>& streaming_selection() { return _streaming_selection; }
+    const Columns& group_by_columns() const { return _group_by_columns; }
     RuntimeProfile::Counter* agg_compute_timer() { return _agg_stat->agg_compute_timer; }
     RuntimeProfile::Counter* agg_expr_timer() { return _agg_stat->agg_function_compute_timer; }
     RuntimeProfile::Counter* streaming_timer() { return _agg_stat->streaming_timer; }
@@ -313,6 +353,9 @@ public:
     RuntimeProfile::Counter* rows_returned_counter() { return _agg_stat->rows_returned_counter; }
     RuntimeProfile::Counter* hash_table_size() { return _agg_stat->hash_table_size; }
     RuntimeProfile::Counter* pass_through_row_count() { return _agg_stat->pass_through_row_count; }
+    RuntimeProfile::Counter* preagg_row_count() { return _agg_stat->preagg_row_count; }
+    RuntimeProfile::Counter* preagg_reduced_row_count() { return _agg_stat->preagg_reduced_row_count; }
+    RuntimeProfile::Counter* heavy_hitter_row_count() { return _agg_stat->heavy_hitter_row_count; }
 
     void sink_complete() { _is_sink_complete.store(true, std::memory_order_release); }
 
@@ -503,6 +546,10 @@ public:
     void build_hash_map(size_t chunk_size, bool agg_group_by_with_limit = false);
     void build_hash_map(size_t chunk_size, std::atomic<int64_t>& shared_limit_countdown, bool agg_group_by_with_limit);
     void build_hash_map_with_selection(size_t chunk_size);
+    // Build the hash map only with the rows whose selection is 1, and set _streaming_selection to 0 for them,
+    // so that they can be aggregated by compute_batch_agg_states_with_selection and the others streamed.
+    void build_hash_map_with_selected_rows(size_t chunk_size, const std::vector<uint8_t>& selection,
+                                           size_t num_selected_rows);
     void build_hash_map_with_selection_and_allocation(size_t chunk_size, bool agg_group_by_with_limit = false);
     [[nodiscard]] Status convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk,
                                                    bool* use_intermediate_as_output = nullptr);
@@ -21,6 +21,8 @@
 #include "column/chunk.h"
 #include "exec/pipeline/analysis/analytic_sink_operator.h"
 #include "exec/pipeline/analysis/analytic_source_operator.h"
+#include "exec/pipeline/analysis/spillable_analytic_sink_operator.h"
+#include "exec/pipeline/analysis/spillable_analytic_source_operator.h"
 #include "exec/pipeline/hash_partition_context.h"
 #include "exec/pipeline/hash_partition_sink_operator.h"
 #include "exec/pipeline/hash_partition_source_operator.h"
@@ -133,14 +135,26 @@ pipeline::OpFactories AnalyticNode::decompose_to_pipeline(pipeline::PipelineBuil
             degree_of_parallelism, _tnode, child(0)->row_desc(), _result_tuple_desc, _use_hash_based_partition);
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
 
-    ops_with_sink.emplace_back(
-            std::make_shared<AnalyticSinkOperatorFactory>(context->next_operator_id(), id(), _tnode, analytor_factory));
+    const bool enable_spill = runtime_state()->enable_spill() && runtime_state()->enable_analytic_spill();
+    if (enable_spill) {
+        ops_with_sink.emplace_back(std::make_shared<SpillableAnalyticSinkOperatorFactory>(
+                context->next_operator_id(), id(), _tnode, analytor_factory));
+    } else {
+        ops_with_sink.emplace_back(std::make_shared<AnalyticSinkOperatorFactory>(context->next_operator_id(), id(),
+                                                                                 _tnode, analytor_factory));
+    }
     this->init_runtime_filter_for_operator(ops_with_sink.back().get(), context, rc_rf_probe_collector);
     context->add_pipeline(ops_with_sink);
 
     OpFactories ops_with_source;
-    auto source_op =
-            std::make_shared<AnalyticSourceOperatorFactory>(context->next_operator_id(), id(), analytor_factory);
+    SourceOperatorFactoryPtr source_op;
+    if (enable_spill) {
+        source_op = std::make_shared<SpillableAnalyticSourceOperatorFactory>(context->next_operator_id(), id(),
+                                                                             analytor_factory);
+    } else {
+        source_op =
+                std::make_shared<AnalyticSourceOperatorFactory>(context->next_operator_id(), id(), analytor_factory);
+    }
     source_op->set_skewed(is_skewed);
     this->init_runtime_filter_for_operator(source_op.get(), context, rc_rf_probe_collector);
     context->inherit_upstream_source_properties(source_op.get(), upstream_source_op);
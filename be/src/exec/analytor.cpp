@@ -107,6 +107,9 @@ Analytor::Analytor(const TPlanNode& tnode, const RowDescriptor& child_row_desc,
         if (config::pipeline_analytic_enable_removable_cumulative_process) {
             _use_removable_cumulative_process = (window.__isset.window_start && window.__isset.window_end);
         }
+        if (config::pipeline_analytic_enable_segment_tree_process) {
+            _use_segment_tree_process = (window.__isset.window_start && window.__isset.window_end);
+        }
         _is_unbounded_preceding = !window.__isset.window_start;
     }
 }
@@ -170,6 +173,14 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
             _use_removable_cumulative_process = false;
         }
 
+        // Segment tree process requires that partial states can be serialized and merged, and the
+        // intermediate type must be identical to the return type.
+        if (!(fn.name.function_name == "min" || fn.name.function_name == "max" ||
+              fn.name.function_name == "any_value") ||
+            fn.ignore_nulls) {
+            _use_segment_tree_process = false;
+        }
+
         bool is_input_nullable = false;
         if (fn.name.function_name == "count" || fn.name.function_name == "row_number" ||
             fn.name.function_name == "rank" || fn.name.function_name == "dense_rank" ||
@@ -242,6 +253,12 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
         _is_lead_lag_functions[i] = (_agg_functions[i]->get_name() == "lead-lag");
     }
 
+    if (_use_segment_tree_process) {
+        const int64_t frame_size = _rows_end_offset - _rows_start_offset + 1;
+        _use_segment_tree_process = config::pipeline_analytic_segment_tree_fanout >= 2 &&
+                                    frame_size >= config::pipeline_analytic_segment_tree_min_frame_size;
+    }
+
     // Compute agg state total size and offsets.
     for (int i = 0; i < agg_size; ++i) {
         _agg_states_offsets[i] = _agg_states_total_size;
@@ -332,8 +349,7 @@ Status Analytor::open(RuntimeState* state) {
                 RETURN_IF_ERROR(st);
             }
         }
-        AggDataPtr agg_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
-        _managed_fn_states.emplace_back(std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, agg_states, this));
+        _create_managed_fn_states();
         return Status::OK();
     };
 
@@ -347,6 +363,17 @@ Status Analytor::open(RuntimeState* state) {
     return Status::OK();
 }
 
+void Analytor::_create_managed_fn_states() {
+    AggDataPtr agg_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
+    _managed_fn_states.emplace_back(std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, agg_states, this));
+    if (_use_segment_tree_process) {
+        // Scratch states used to build the nodes of segment tree.
+        AggDataPtr node_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
+        _managed_fn_states.emplace_back(std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, node_states, this));
+        _init_segment_tree();
+    }
+}
+
 void Analytor::close(RuntimeState* state) {
     if (_is_closed) {
         return;
@@ -399,6 +426,18 @@ Status Analytor::finish_process(RuntimeState* state) {
     return Status::OK();
 }
 
+Status Analytor::offload_input_chunks(InputChunkOffloader offloader) {
+    DCHECK(_input_chunk_offloader == nullptr);
+    _input_chunk_offloader = std::move(offloader);
+    for (size_t i = _output_chunk_index; i < _input_chunks.size(); ++i) {
+        RETURN_IF_ERROR(_input_chunk_offloader(_input_chunks[i]));
+        _input_chunks[i].reset();
+    }
+    _offloadable_bytes = 0;
+    _first_offloaded_chunk_index.store(_output_chunk_index, std::memory_order_release);
+    return Status::OK();
+}
+
 std::string Analytor::debug_string() const {
     std::stringstream ss;
     ss << std::boolalpha;
@@ -421,8 +460,13 @@ Status Analytor::_prepare_processing_mode(RuntimeState* state, RuntimeProfile* r
     _process_impl = &Analytor::_materializing_process;
     std::stringstream process_mode;
     process_mode << (_need_partition_materializing ? "Materializing/" : "Streaming/");
-    process_mode << (_use_removable_cumulative_process ? "RemovableCumulative"
-                                                       : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition"));
+    if (_use_removable_cumulative_process) {
+        process_mode << "RemovableCumulative";
+    } else if (_use_segment_tree_process) {
+        process_mode << "SegmentTree";
+    } else {
+        process_mode << (_is_unbounded_preceding ? "Cumulative" : "ByDefinition");
+    }
     runtime_profile->add_info_string("ProcessMode", process_mode.str());
     if (!_tnode.analytic_node.__isset.window) {
         _materializing_process_impl = &Analytor::_materializing_process_for_unbounded_frame;
@@ -614,7 +658,13 @@ Status Analytor::_add_chunk(const ChunkPtr& chunk) {
 
     _input_chunk_first_row_positions.emplace_back(_input_rows);
     _input_rows += chunk_size;
-    _input_chunks.emplace_back(chunk);
+    if (_input_chunk_offloader != nullptr) {
+        RETURN_IF_ERROR(_input_chunk_offloader(chunk));
+        _input_chunks.emplace_back(nullptr);
+    } else {
+        _offloadable_bytes += chunk->memory_usage();
+        _input_chunks.emplace_back(chunk);
+    }
     COUNTER_ADD(_peak_buffered_rows, chunk_size);
 
     return Status::OK();
@@ -812,6 +862,9 @@ Status Analytor::_streaming_process_for_sliding_frame(RuntimeState* state) {
 
             if (_use_removable_cumulative_process) {
                 _update_window_batch_removable_cumulatively();
+            } else if (_use_segment_tree_process) {
+                _reset_window_state();
+                _update_window_batch_with_segment_tree(frame.start, frame.end);
             } else {
                 // Update agg state in batch manner for each row.
                 _reset_window_state();
@@ -909,6 +962,15 @@ void Analytor::_materializing_process_for_sliding_frame(RuntimeState* state) {
         while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
             _update_window_batch_removable_cumulatively();
 
+            _get_window_function_result(_window_result_position(), _window_result_position() + 1);
+            _update_current_row_position(1);
+        }
+    } else if (_use_segment_tree_process) {
+        while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
+            _reset_window_state();
+            const FrameRange range = _get_frame_range();
+            _update_window_batch_with_segment_tree(range.start, range.end);
+
             _get_window_function_result(_window_result_position(), _window_result_position() + 1);
             _update_current_row_position(1);
         }
@@ -951,6 +1013,19 @@ void Analytor::_update_window_batch(int64_t partition_start, int64_t partition_e
     }
 }
 
+void Analytor::_update_window_batch_for_states(AggDataPtr states, int64_t frame_start, int64_t frame_end) {
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        size_t column_size = _agg_intput_columns[i].size();
+        const Column* data_columns[column_size];
+        for (size_t j = 0; j < column_size; j++) {
+            data_columns[j] = _agg_intput_columns[i][j].get();
+        }
+        _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], states + _agg_states_offsets[i],
+                                                                data_columns, _partition.start, _partition.end,
+                                                                frame_start, frame_end);
+    }
+}
+
 void Analytor::_update_window_batch_removable_cumulatively() {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         const Column* agg_column = _agg_intput_columns[i][0].get();
@@ -961,8 +1036,147 @@ void Analytor::_update_window_batch_removable_cumulatively() {
     }
 }
 
+void Analytor::_init_segment_tree() {
+    const int64_t fanout = config::pipeline_analytic_segment_tree_fanout;
+    const int64_t frame_size = _rows_end_offset - _rows_start_offset + 1;
+    _segment_tree_levels.clear();
+    // A node larger than the frame can never be fully covered by a frame.
+    for (int64_t node_size = fanout; node_size <= frame_size; node_size *= fanout) {
+        auto& level = _segment_tree_levels.emplace_back();
+        level.node_size = node_size;
+        for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+            // The intermediate type of MIN/MAX/ANY_VALUE is the same as its return type, and the function is
+            // always wrapped by nullable aggregate function.
+            level.nodes.emplace_back(ColumnHelper::create_column(_agg_fn_types[i].result_type, true));
+        }
+    }
+}
+
+void Analytor::_reset_segment_tree() {
+    for (auto& level : _segment_tree_levels) {
+        level.first_node = 0;
+        for (auto& column : level.nodes) {
+            column->resize(0);
+        }
+    }
+}
+
+void Analytor::_update_window_batch_with_segment_tree(int64_t frame_start, int64_t frame_end) {
+    // All positions below are relative to the partition start, they are stable even if the buffered rows
+    // before the frame are removed, since the partition start is shifted together.
+    int64_t lo = std::max<int64_t>(frame_start, _partition.start) - _partition.start;
+    int64_t hi = std::min<int64_t>(frame_end, _partition.end) - _partition.start;
+    if (lo >= hi) {
+        return;
+    }
+
+    // Frame start never moves backward, so nodes starting before `lo` are useless from now on.
+    // Only drop them when they occupy more than half of the column to amortize the cost of shifting.
+    for (auto& level : _segment_tree_levels) {
+        const int64_t min_node = (lo + level.node_size - 1) / level.node_size;
+        const int64_t num_nodes = level.nodes[0]->size();
+        const int64_t num_useless = min_node - level.first_node;
+        if (num_useless <= 0) {
+            continue;
+        }
+        if (num_useless >= num_nodes) {
+            for (auto& column : level.nodes) {
+                column->resize(0);
+            }
+            level.first_node = min_node;
+        } else if (num_useless * 2 >= num_nodes) {
+            for (auto& column : level.nodes) {
+                column->remove_first_n_values(num_useless);
+            }
+            level.first_node += num_useless;
+        }
+    }
+
+    AggDataPtr states = _managed_fn_states[0]->mutable_data();
+    size_t level = 0;
+    // Climb up while the remaining range still contains a whole node of the next level, merging the
+    // unaligned head and tail of the current level on the way.
+    while (level < _segment_tree_levels.size()) {
+        const int64_t next_size = _segment_tree_levels[level].node_size;
+        const int64_t aligned_lo = (lo + next_size - 1) / next_size * next_size;
+        const int64_t aligned_hi = hi / next_size * next_size;
+        if (aligned_lo >= aligned_hi) {
+            break;
+        }
+        _merge_segment_tree_units(level, lo, aligned_lo, states);
+        _merge_segment_tree_units(level, aligned_hi, hi, states);
+        lo = aligned_lo;
+        hi = aligned_hi;
+        ++level;
+    }
+    _merge_segment_tree_units(level, lo, hi, states);
+}
+
+void Analytor::_merge_segment_tree_units(size_t level, int64_t from, int64_t to, AggDataPtr states) {
+    if (from >= to) {
+        return;
+    }
+    if (level == 0) {
+        _update_window_batch_for_states(states, _partition.start + from, _partition.start + to);
+        return;
+    }
+
+    auto& tree_level = _segment_tree_levels[level - 1];
+    const int64_t node_start = from / tree_level.node_size;
+    const int64_t node_end = to / tree_level.node_size;
+    _build_segment_tree_nodes(level, node_end);
+    DCHECK_GE(node_start, tree_level.first_node);
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        _agg_functions[i]->merge_batch_single_state(_agg_fn_ctxs[i], states + _agg_states_offsets[i],
+                                                    tree_level.nodes[i].get(), node_start - tree_level.first_node,
+                                                    node_end - node_start);
+    }
+}
+
+void Analytor::_build_segment_tree_nodes(size_t level, int64_t node_end) {
+    auto& tree_level = _segment_tree_levels[level - 1];
+    int64_t node = tree_level.end_node();
+    if (node >= node_end) {
+        return;
+    }
+    // Node size of the first level is exactly the fanout.
+    const int64_t fanout = _segment_tree_levels[0].node_size;
+    if (level > 1) {
+        _build_segment_tree_nodes(level - 1, node_end * fanout);
+    }
+
+    AggDataPtr node_states = _managed_fn_states[1]->mutable_data();
+    for (; node < node_end; ++node) {
+        for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+            _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], node_states + _agg_states_offsets[i]);
+        }
+        if (level == 1) {
+            const int64_t start = _partition.start + node * tree_level.node_size;
+            _update_window_batch_for_states(node_states, start, start + tree_level.node_size);
+        } else {
+            const auto& child_level = _segment_tree_levels[level - 2];
+            DCHECK_GE(node * fanout, child_level.first_node);
+            for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                _agg_functions[i]->merge_batch_single_state(_agg_fn_ctxs[i], node_states + _agg_states_offsets[i],
+                                                            child_level.nodes[i].get(),
+                                                            node * fanout - child_level.first_node, fanout);
+            }
+        }
+        for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+            _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], node_states + _agg_states_offsets[i],
+                                                   tree_level.nodes[i].get());
+        }
+    }
+}
+
 Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
     ChunkPtr output_chunk = std::move(_input_chunks[_output_chunk_index]);
+    if (output_chunk == nullptr) {
+        // The input chunk has been offloaded, only output the results of window functions.
+        output_chunk = std::make_shared<Chunk>();
+    } else {
+        _offloadable_bytes -= output_chunk->memory_usage();
+    }
     for (size_t i = 0; i < _result_window_columns.size(); i++) {
         output_chunk->append_column(_result_window_columns[i], _result_tuple_desc->slots()[i]->id());
     }
@@ -989,6 +1203,9 @@ void Analytor::_reset_state_for_next_partition() {
     _partition.start = _partition.end;
     _current_row_position = _partition.start;
     _reset_window_state();
+    if (_use_segment_tree_process) {
+        _reset_segment_tree();
+    }
     DCHECK_GE(_current_row_position, 0);
 }
 
@@ -14,11 +14,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <queue>
 #include <string>
 
 #include "column/chunk.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/spill/spill_fwd.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/expr.h"
 #include "gen_cpp/Types_types.h"
@@ -45,6 +48,7 @@ using Analytors = std::vector<AnalytorPtr>;
 // it contains common data struct and algorithm of analysis
 class Analytor final : public pipeline::ContextWithDependency {
     friend class ManagedFunctionStates;
+    friend class AnalytorBench;
 
     // [start, end)
     struct FrameRange {
@@ -137,6 +141,24 @@ public:
 
     std::string debug_string() const;
 
+    // Spill support, the spiller is shared by the spillable sink and source operators.
+    const std::shared_ptr<spill::Spiller>& spiller() const { return _spiller; }
+    void set_spiller(std::shared_ptr<spill::Spiller> spiller) { _spiller = std::move(spiller); }
+
+    using InputChunkOffloader = std::function<Status(const ChunkPtr&)>;
+    // Hand the buffered input chunks that have not been output yet, and all the upcoming input chunks, over to
+    // `offloader` instead of keeping them in memory. Only the columns required by window functions, partition
+    // and order by exprs stay in memory. The output chunk of an offloaded input chunk contains only the window
+    // function results, and must be stitched with the input chunks given back in the same order.
+    Status offload_input_chunks(InputChunkOffloader offloader);
+    // Index of the first output chunk whose input chunk is offloaded, -1 if nothing is offloaded.
+    int64_t first_offloaded_chunk_index() const {
+        return _first_offloaded_chunk_index.load(std::memory_order_acquire);
+    }
+    bool is_offloading_input_chunks() const { return first_offloaded_chunk_index() >= 0; }
+    // Memory usage of the buffered input chunks that could be offloaded.
+    size_t offloadable_bytes() const { return _offloadable_bytes; }
+
 private:
     Status _prepare_processing_mode(RuntimeState* state, RuntimeProfile* runtime_profile);
     Status _evaluate_const_columns(int i);
@@ -193,6 +215,21 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    // Update `states` with rows [frame_start, frame_end) of the current partition, the frame must be normalized.
+    void _update_window_batch_for_states(AggDataPtr states, int64_t frame_start, int64_t frame_end);
+
+    // Segment tree process, used for non-invertible aggregates (MIN/MAX/ANY_VALUE) over bounded ROWS frames.
+    // Level l of the tree keeps the serialized partial states of consecutive blocks of fanout^l rows of the
+    // current partition, so a frame of k rows is covered by O(fanout * log(k)) blocks instead of k rows.
+    void _init_segment_tree();
+    void _reset_segment_tree();
+    // Allocate the window states, and the scratch states and levels of the segment tree if it is used.
+    void _create_managed_fn_states();
+    void _update_window_batch_with_segment_tree(int64_t frame_start, int64_t frame_end);
+    // Merge the units of `level` (rows for level 0) covering partition-relative rows [from, to) into `states`.
+    void _merge_segment_tree_units(size_t level, int64_t from, int64_t to, AggDataPtr states);
+    // Make sure that the nodes of `level` (>= 1) are built up to `node_end` (exclusive).
+    void _build_segment_tree_nodes(size_t level, int64_t node_end);
 
     Status _output_result_chunk(ChunkPtr* chunk);
 
@@ -211,7 +248,14 @@ private:
         return _input_chunk_first_row_positions[_output_chunk_index];
     }
     bool _is_current_chunk_finished_eval() const { return _window_result_position() >= _current_chunk_size(); }
-    size_t _current_chunk_size() const { return _input_chunks[_output_chunk_index]->num_rows(); }
+    // Input chunk may have been offloaded, so its size is derived from the row positions.
+    size_t _current_chunk_size() const {
+        const int64_t next_position =
+                static_cast<size_t>(_output_chunk_index + 1) < _input_chunk_first_row_positions.size()
+                        ? _input_chunk_first_row_positions[_output_chunk_index + 1]
+                        : _input_rows;
+        return next_position - _input_chunk_first_row_positions[_output_chunk_index];
+    }
     int64_t _get_global_position(int64_t local_position) const { return _removed_from_buffer_rows + local_position; }
     int64_t _window_result_position() const {
         return _get_global_position(_current_row_position) - _first_global_position_of_current_chunk();
@@ -290,6 +334,21 @@ private:
     // Any of these conditions is satisfied, the materializing processing is required.
     bool _need_partition_materializing = false;
     bool _use_removable_cumulative_process = false;
+    bool _use_segment_tree_process = false;
+
+    struct SegmentTreeLevel {
+        // Number of partition rows covered by one node.
+        int64_t node_size = 0;
+        // Index of the node stored in the first row of `nodes`. Nodes starting before the current frame are
+        // never needed again because the frame only moves forward, they are dropped lazily.
+        int64_t first_node = 0;
+        // Serialized partial states, one column per window function.
+        Columns nodes;
+
+        int64_t end_node() const { return first_node + static_cast<int64_t>(nodes[0]->size()); }
+    };
+    // _segment_tree_levels[l] holds the nodes of tree level l + 1, level 0 is the input rows themselves.
+    std::vector<SegmentTreeLevel> _segment_tree_levels;
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
     bool _should_set_partition_size = false;
@@ -318,6 +377,12 @@ private:
     int64_t _input_rows = 0;
     bool _input_eos = false;
 
+    // Spill related structures, see offload_input_chunks.
+    std::shared_ptr<spill::Spiller> _spiller;
+    InputChunkOffloader _input_chunk_offloader;
+    std::atomic<int64_t> _first_offloaded_chunk_index = -1;
+    size_t _offloadable_bytes = 0;
+
     // Temporary output related structures
     Columns _result_window_columns;
 
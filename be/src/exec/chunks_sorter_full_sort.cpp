@@ -14,13 +14,16 @@
 
 #include "chunks_sorter_full_sort.h"
 
+#include "common/config.h"
 #include "exec/sorting/merge.h"
+#include "exec/sorting/radix_sort.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/memory/huge_page_allocator.h"
 #include "runtime/runtime_state.h"
 #include "util/stopwatch.hpp"
 
@@ -46,6 +49,12 @@ void ChunksSorterFullSort::setup_runtime(RuntimeState* state, RuntimeProfile* pr
     _runtime_profile->add_info_string("MaxBufferedRows", strings::Substitute("$0", max_buffered_rows));
     _runtime_profile->add_info_string("MaxBufferedBytes", strings::Substitute("$0", max_buffered_bytes));
     _profiler = _object_pool->add(new ChunksSorterFullSortProfiler(profile, parent_mem_tracker));
+    if (_sort_exprs->size() == 1) {
+        LogicalType type = (*_sort_exprs)[0]->root()->type().type;
+        if (radix_sort_supported(type)) {
+            _radix_sort_type = type;
+        }
+    }
 }
 
 Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk) {
@@ -76,7 +85,30 @@ static void reserve_memory(Column* dst_col, const std::vector<ChunkPtr>& src_chu
     binary_dst_col->get_bytes().reserve(total_num_bytes);
 }
 
-static void concat_chunks(ChunkPtr& dst_chunk, const std::vector<ChunkPtr>& src_chunks, size_t num_rows) {
+// The accumulated chunk is gathered in the sorted order, i.e. randomly, so its large buffers are backed
+// by huge pages if enabled. It must be done before the buffers are filled.
+static void advise_huge_pages(Column* data_col, size_t huge_page_min_bytes) {
+    uint8_t* data = nullptr;
+    size_t bytes = 0;
+    if (data_col->is_binary()) {
+        auto& buffer = down_cast<BinaryColumn*>(data_col)->get_bytes();
+        data = buffer.data();
+        bytes = buffer.capacity();
+    } else if (data_col->is_large_binary()) {
+        auto& buffer = down_cast<LargeBinaryColumn*>(data_col)->get_bytes();
+        data = buffer.data();
+        bytes = buffer.capacity();
+    } else if (data_col->is_numeric() || data_col->is_decimal() || data_col->is_date() || data_col->is_timestamp()) {
+        data = data_col->mutable_raw_data();
+        bytes = data_col->capacity() * data_col->type_size();
+    }
+    if (bytes >= huge_page_min_bytes) {
+        HugePageAllocator::advise(data, bytes);
+    }
+}
+
+static void concat_chunks(ChunkPtr& dst_chunk, const std::vector<ChunkPtr>& src_chunks, size_t num_rows,
+                          size_t huge_page_min_bytes) {
     DCHECK(!src_chunks.empty());
     // Columns like FixedLengthColumn have already reserved memory when invoke Chunk::clone_empty(num_rows).
     dst_chunk = src_chunks.front()->clone_empty(num_rows);
@@ -90,6 +122,7 @@ static void concat_chunks(ChunkPtr& dst_chunk, const std::vector<ChunkPtr>& src_
         } else if (dst_col->is_large_binary()) {
             reserve_memory<LargeBinaryColumn>(dst_data_col, src_chunks, i);
         }
+        advise_huge_pages(dst_data_col, huge_page_min_bytes);
     }
     for (const auto& src_chk : src_chunks) {
         dst_chunk->append(*src_chk);
@@ -104,15 +137,20 @@ Status ChunksSorterFullSort::_partial_sort(RuntimeState* state, bool done) {
     if (done || reach_limit) {
         _max_num_rows = std::max<int>(_max_num_rows, _staging_unsorted_rows);
         _profiler->input_required_memory->update(_staging_unsorted_bytes);
-        concat_chunks(_unsorted_chunk, _staging_unsorted_chunks, _staging_unsorted_rows);
+        const size_t huge_page_min_bytes = HugePageAllocator::min_bytes(HugePageUsage::SORT_BUFFER);
+        concat_chunks(_unsorted_chunk, _staging_unsorted_chunks, _staging_unsorted_rows, huge_page_min_bytes);
         _staging_unsorted_chunks.clear();
         RETURN_IF_ERROR(_unsorted_chunk->upgrade_if_overflow());
 
         SCOPED_TIMER(_sort_timer);
         DataSegment segment(_sort_exprs, _unsorted_chunk);
         _sort_permutation.resize(0);
-        RETURN_IF_ERROR(
-                sort_and_tie_columns(state->cancelled_ref(), segment.order_by_columns, _sort_desc, &_sort_permutation));
+        if (_staging_unsorted_rows * sizeof(PermutationItem) >= huge_page_min_bytes) {
+            _sort_permutation.reserve(_staging_unsorted_rows);
+            HugePageAllocator::advise(_sort_permutation.data(),
+                                      _sort_permutation.capacity() * sizeof(PermutationItem));
+        }
+        RETURN_IF_ERROR(_sort_unsorted_chunk(state, segment.order_by_columns));
         auto sorted_chunk = _unsorted_chunk->clone_empty_with_slot(_unsorted_chunk->num_rows());
         materialize_by_permutation(sorted_chunk.get(), {_unsorted_chunk}, _sort_permutation);
         RETURN_IF_ERROR(sorted_chunk->upgrade_if_overflow());
@@ -127,6 +165,18 @@ Status ChunksSorterFullSort::_partial_sort(RuntimeState* state, bool done) {
     return Status::OK();
 }
 
+// Large runs on a single integer-like key are sorted by radix sort, others by column-wise comparison sort
+Status ChunksSorterFullSort::_sort_unsorted_chunk(RuntimeState* state, const Columns& order_by_columns) {
+    const size_t num_rows = _unsorted_chunk->num_rows();
+    if (_radix_sort_type != TYPE_UNKNOWN && config::enable_sort_radix_sort &&
+        num_rows >= config::sort_radix_sort_min_rows && !order_by_columns[0]->is_constant()) {
+        COUNTER_UPDATE(_profiler->num_radix_sorted_runs, 1);
+        return radix_sort_column(state->cancelled_ref(), order_by_columns[0], _radix_sort_type,
+                                 _sort_desc.get_column_desc(0), &_sort_permutation);
+    }
+    return sort_and_tie_columns(state->cancelled_ref(), order_by_columns, _sort_desc, &_sort_permutation);
+}
+
 Status ChunksSorterFullSort::_merge_sorted(RuntimeState* state) {
     SCOPED_TIMER(_merge_timer);
     _profiler->num_sorted_runs->set((int64_t)_sorted_chunks.size());
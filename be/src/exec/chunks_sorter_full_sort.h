@@ -26,11 +26,13 @@ struct ChunksSorterFullSortProfiler {
             : profile(runtime_profile) {
         input_required_memory = ADD_COUNTER(profile, "InputRequiredMemory", TUnit::BYTES);
         num_sorted_runs = ADD_COUNTER(profile, "NumSortedRuns", TUnit::UNIT);
+        num_radix_sorted_runs = ADD_COUNTER(profile, "NumRadixSortedRuns", TUnit::UNIT);
     }
 
     RuntimeProfile* profile{};
     RuntimeProfile::Counter* input_required_memory = nullptr;
     RuntimeProfile::Counter* num_sorted_runs = nullptr;
+    RuntimeProfile::Counter* num_radix_sorted_runs = nullptr;
 };
 class ChunksSorterFullSort : public ChunksSorter {
 public:
@@ -67,6 +69,7 @@ private:
     [[nodiscard]] Status _merge_unsorted(RuntimeState* state, const ChunkPtr& chunk);
     [[nodiscard]] Status _partial_sort(RuntimeState* state, bool done);
     [[nodiscard]] Status _merge_sorted(RuntimeState* state);
+    [[nodiscard]] Status _sort_unsorted_chunk(RuntimeState* state, const Columns& order_by_columns);
     void _split_late_and_early_chunks();
     void _assign_ordinals();
     template <typename T>
@@ -89,6 +92,8 @@ protected:
     MemTracker* _parent_mem_tracker = nullptr;
     std::unique_ptr<ObjectPool> _object_pool = nullptr;
     ChunksSorterFullSortProfiler* _profiler = nullptr;
+    // The type of the single order-by column if it could be sorted by radix sort, otherwise TYPE_UNKNOWN
+    LogicalType _radix_sort_type = TYPE_UNKNOWN;
 
     // TODO: further tunning the buffer parameter
     const size_t max_buffered_rows;  // Max buffer 1024000 rows
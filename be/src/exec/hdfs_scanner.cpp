@@ -19,6 +19,7 @@
 #include "fs/hdfs/fs_hdfs.h"
 #include "io/compressed_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "util/compression/compression_utils.h"
 #include "util/compression/stream_compression.h"
 
@@ -227,6 +228,19 @@ Status HdfsScanner::open_random_access_file() {
             .max_dist_size = config::io_coalesce_read_max_distance_size,
             .max_buffer_size = config::io_coalesce_read_max_buffer_size};
     _shared_buffered_input_stream->set_coalesce_options(options);
+    // datacache reads through shared buffered stream itself, so prefetch is only used without datacache.
+    // prefetch reads from another stream of the file, since the reads of raw stream are not thread safe.
+    // the stream is opened by the first prefetch.
+    ThreadPool* prefetch_pool = ExecEnv::GetInstance()->io_prefetch_pool();
+    if (config::io_prefetch_enable && !_scanner_params.use_datacache && prefetch_pool != nullptr) {
+        auto opener = [fs = _scanner_params.fs, path = _scanner_params.path,
+                       file_size]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+            ASSIGN_OR_RETURN(std::unique_ptr<RandomAccessFile> prefetch_file, fs->new_random_access_file(path));
+            prefetch_file->set_size(file_size);
+            return prefetch_file->stream();
+        };
+        _shared_buffered_input_stream->set_prefetch_stream(prefetch_pool, std::move(opener));
+    }
     input_stream = _shared_buffered_input_stream;
 
     // input_stream = CacheInputStream(input_stream)
@@ -237,6 +251,7 @@ Status HdfsScanner::open_random_access_file() {
         _cache_input_stream->set_enable_async_populate_mode(_scanner_params.enable_datacache_async_populate_mode);
         _cache_input_stream->set_enable_cache_io_adaptor(_scanner_params.enable_datacache_io_adaptor);
         _cache_input_stream->set_enable_block_buffer(config::datacache_block_buffer_enable);
+        _cache_input_stream->set_enable_warmup_record(_scanner_params.enable_datacache_warmup_record);
         _shared_buffered_input_stream->set_align_size(_cache_input_stream->get_align_size());
         input_stream = _cache_input_stream;
     }
@@ -364,6 +379,8 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_write_timer, stats.write_cache_ns);
         COUNTER_UPDATE(profile->datacache_write_fail_counter, stats.write_cache_fail_count);
         COUNTER_UPDATE(profile->datacache_write_fail_bytes, stats.write_cache_fail_bytes);
+        COUNTER_UPDATE(profile->datacache_skip_write_counter, stats.skip_write_cache_count);
+        COUNTER_UPDATE(profile->datacache_skip_write_bytes, stats.skip_write_cache_bytes);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_counter, stats.read_block_buffer_count);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_bytes, stats.read_block_buffer_bytes);
 
@@ -386,6 +403,12 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->shared_buffered_direct_io_count, _shared_buffered_input_stream->direct_io_count());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_bytes, _shared_buffered_input_stream->direct_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_timer, _shared_buffered_input_stream->direct_io_timer());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_hit_bytes,
+                       _shared_buffered_input_stream->prefetch_hit_bytes());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_wasted_bytes,
+                       _shared_buffered_input_stream->prefetch_wasted_bytes());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_wait_timer,
+                       _shared_buffered_input_stream->prefetch_wait_timer());
     }
 
     {
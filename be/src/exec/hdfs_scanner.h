@@ -82,6 +82,10 @@ struct HdfsScanStats {
     // page index
     int64_t rows_before_page_index = 0;
     int64_t page_index_ns = 0;
+    // bloom filter
+    int64_t bloom_filter_skip_groups = 0;
+    int64_t bloom_filter_skip_rows = 0;
+    int64_t bloom_filter_read_ns = 0;
 
     // late materialize round-by-round
     int64_t group_min_round_cost = 0;
@@ -128,6 +132,8 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* datacache_write_timer = nullptr;
     RuntimeProfile::Counter* datacache_write_fail_counter = nullptr;
     RuntimeProfile::Counter* datacache_write_fail_bytes = nullptr;
+    RuntimeProfile::Counter* datacache_skip_write_counter = nullptr;
+    RuntimeProfile::Counter* datacache_skip_write_bytes = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_counter = nullptr;
     RuntimeProfile::Counter* datacache_read_block_buffer_bytes = nullptr;
 
@@ -138,6 +144,9 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* shared_buffered_direct_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_timer = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_hit_bytes = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_wasted_bytes = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_wait_timer = nullptr;
 
     RuntimeProfile::Counter* app_io_bytes_read_counter = nullptr;
     RuntimeProfile::Counter* app_io_timer = nullptr;
@@ -216,6 +225,9 @@ struct HdfsScannerParams {
     bool enable_datacache_async_populate_mode = false;
     bool enable_datacache_io_adaptor = false;
     int32_t datacache_evict_probability = 0;
+    // whether the blocks read from datacache are recorded for the warm-up after restart. Only the files which
+    // the warm-up can reopen with the credentials of BE are recorded, not those read with a catalog's own ones.
+    bool enable_datacache_warmup_record = false;
 
     std::atomic<int32_t>* lazy_column_coalesce_counter;
     bool can_use_any_column = false;
@@ -81,6 +81,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     // page index
     RuntimeProfile::Counter* rows_before_page_index = nullptr;
     RuntimeProfile::Counter* page_index_timer = nullptr;
+    // bloom filter
+    RuntimeProfile::Counter* bloom_filter_skip_groups = nullptr;
+    RuntimeProfile::Counter* bloom_filter_skip_rows = nullptr;
+    RuntimeProfile::Counter* bloom_filter_read_timer = nullptr;
 
     RuntimeProfile* root = profile->runtime_profile;
     ADD_COUNTER(root, kParquetProfileSectionPrefix, TUnit::NONE);
@@ -121,6 +125,10 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
             kParquetProfileSectionPrefix);
     rows_before_page_index = ADD_CHILD_COUNTER(root, "RowsBeforePageIndex", TUnit::UNIT, kParquetProfileSectionPrefix);
     page_index_timer = ADD_CHILD_TIMER(root, "PageIndexTime", kParquetProfileSectionPrefix);
+    bloom_filter_skip_groups =
+            ADD_CHILD_COUNTER(root, "BloomFilterSkipGroups", TUnit::UNIT, kParquetProfileSectionPrefix);
+    bloom_filter_skip_rows = ADD_CHILD_COUNTER(root, "BloomFilterSkipRows", TUnit::UNIT, kParquetProfileSectionPrefix);
+    bloom_filter_read_timer = ADD_CHILD_TIMER(root, "BloomFilterReadTime", kParquetProfileSectionPrefix);
 
     COUNTER_UPDATE(request_bytes_read, _app_stats.request_bytes_read);
     COUNTER_UPDATE(request_bytes_read_uncompressed, _app_stats.request_bytes_read_uncompressed);
@@ -146,6 +154,9 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
     do_update_iceberg_v2_counter(root, kParquetProfileSectionPrefix);
     COUNTER_UPDATE(rows_before_page_index, _app_stats.rows_before_page_index);
     COUNTER_UPDATE(page_index_timer, _app_stats.page_index_ns);
+    COUNTER_UPDATE(bloom_filter_skip_groups, _app_stats.bloom_filter_skip_groups);
+    COUNTER_UPDATE(bloom_filter_skip_rows, _app_stats.bloom_filter_skip_rows);
+    COUNTER_UPDATE(bloom_filter_read_timer, _app_stats.bloom_filter_read_ns);
 }
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
@@ -534,6 +534,7 @@ int64_t JoinHashTable::mem_usage() const {
         usage += _table_items->build_key_column->memory_usage();
     }
     usage += _table_items->build_slice.size() * sizeof(Slice);
+    usage += _table_items->build_key_views.size() * sizeof(BinaryView);
     return usage;
 }
 
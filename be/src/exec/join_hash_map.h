@@ -24,10 +24,12 @@
 #include <cstdint>
 #include <set>
 
+#include "column/binary_view.h"
 #include "column/chunk.h"
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "runtime/memory/huge_page_allocator.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -97,6 +99,8 @@ struct HashTableSlotDescriptor {
     bool need_lazy_materialize = false;
 };
 
+using JoinHashTableBuffer = HugePageBuffer<uint32_t, HugePageUsage::JOIN_HASH_TABLE>;
+
 struct JoinHashTableItems {
     //TODO: memory continues problem?
     ChunkPtr build_chunk = nullptr;
@@ -110,9 +114,12 @@ struct JoinHashTableItems {
     // the list of keys in a bucket.
     // A paper (https://dare.uva.nl/search?identifier=5ccbb60a-38b8-4eeb-858a-e7735dd37487) talks
     // about the bucket-chained hash table of this kind.
-    Buffer<uint32_t> first;
-    Buffer<uint32_t> next;
+    // Both are probed randomly, so large ones are backed by huge pages if enabled.
+    JoinHashTableBuffer first;
+    JoinHashTableBuffer next;
     Buffer<Slice> build_slice;
+    // The views of the build keys of a one-string-key join, probed together with "next".
+    Buffer<BinaryView> build_key_views;
     ColumnPtr build_key_column = nullptr;
     uint32_t bucket_size = 0;
     uint32_t row_count = 0; // real row count
@@ -137,7 +144,7 @@ struct JoinHashTableItems {
 
     void calculate_ht_info(size_t key_bytes) {
         if (used_buckets == 0) { // to avoid redo
-            used_buckets = SIMD::count_nonzero(first);
+            used_buckets = first.size() - SIMD::count_zero(first.data(), first.size());
             keys_per_bucket = used_buckets == 0 ? 0 : row_count * 1.0 / used_buckets;
             size_t probe_bytes = key_bytes + row_count * sizeof(uint32_t);
             // cache miss is serious when
@@ -163,6 +170,7 @@ struct HashTableProbeState {
     Buffer<uint32_t> buckets;
     Buffer<uint32_t> next;
     Buffer<Slice> probe_slice;
+    Buffer<BinaryView> probe_key_views;
     Buffer<uint8_t>* null_array = nullptr;
     ColumnPtr probe_key_column;
     const Columns* key_columns = nullptr;
@@ -235,6 +243,7 @@ struct HashTableProbeState {
               buckets(rhs.buckets),
               next(rhs.next),
               probe_slice(rhs.probe_slice),
+              probe_key_views(rhs.probe_key_views),
               null_array(rhs.null_array),
               probe_key_column(rhs.probe_key_column == nullptr ? nullptr : rhs.probe_key_column->clone()),
               key_columns(rhs.key_columns),
@@ -381,16 +390,25 @@ public:
     }
 };
 
+// The string keys are compared as BinaryView, whose inlined size and prefix reject most of
+// the mismatched keys in the bucket chains without dereferencing the build keys.
+template <LogicalType LT>
+using JoinKeyType = std::conditional_t<lt_is_string<LT>, BinaryView, typename RunTimeTypeTraits<LT>::CppType>;
+
 template <LogicalType LT>
 class JoinBuildFunc {
 public:
     using CppType = typename RunTimeTypeTraits<LT>::CppType;
     using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
+    using KeyType = JoinKeyType<LT>;
 
     static void prepare(RuntimeState* runtime, JoinHashTableItems* table_items);
-    static const Buffer<CppType>& get_key_data(const JoinHashTableItems& table_items);
+    static const Buffer<KeyType>& get_key_data(const JoinHashTableItems& table_items);
     static void construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                      HashTableProbeState* probe_state);
+
+private:
+    static const Buffer<CppType>& _get_key_column_data(const JoinHashTableItems& table_items);
 };
 
 template <LogicalType LT>
@@ -449,11 +467,15 @@ class JoinProbeFunc {
 public:
     using CppType = typename RunTimeTypeTraits<LT>::CppType;
     using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
+    using KeyType = JoinKeyType<LT>;
 
     static void prepare(RuntimeState* state, HashTableProbeState* probe_state) {}
     static void lookup_init(const JoinHashTableItems& table_items, HashTableProbeState* probe_state);
-    static const Buffer<CppType>& get_key_data(const HashTableProbeState& probe_state);
-    static bool equal(const CppType& x, const CppType& y) { return x == y; }
+    static const Buffer<KeyType>& get_key_data(const HashTableProbeState& probe_state);
+    static bool equal(const KeyType& x, const KeyType& y) { return x == y; }
+
+private:
+    static const Buffer<CppType>& _get_key_column_data(const HashTableProbeState& probe_state);
 };
 
 template <LogicalType LT>
@@ -655,6 +677,9 @@ template <LogicalType LT, class BuildFunc, class ProbeFunc>
 class JoinHashMap {
 public:
     using CppType = typename RunTimeTypeTraits<LT>::CppType;
+    // The keys compared in the bucket chains, which are not CppType for the string keys.
+    using BuildKeyData = std::decay_t<decltype(BuildFunc::get_key_data(std::declval<const JoinHashTableItems&>()))>;
+    using ProbeKeyData = std::decay_t<decltype(ProbeFunc::get_key_data(std::declval<const HashTableProbeState&>()))>;
 
     explicit JoinHashMap(JoinHashTableItems* table_items, HashTableProbeState* probe_state)
             : _table_items(table_items), _probe_state(probe_state) {}
@@ -694,102 +719,102 @@ private:
     void _search_ht_remain(RuntimeState* state);
 
     template <bool first_probe>
-    void _search_ht_impl(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& data);
+    void _search_ht_impl(RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& data);
 
     // for one key inner join
     template <bool first_probe>
-    void _probe_from_ht(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_from_ht(RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
 
-    HashTableProbeState::ProbeCoroutine _probe_from_ht(RuntimeState* state, const Buffer<CppType>& build_data,
-                                                       const Buffer<CppType>& probe_data);
+    HashTableProbeState::ProbeCoroutine _probe_from_ht(RuntimeState* state, const BuildKeyData& build_data,
+                                                       const ProbeKeyData& probe_data);
 
     template <bool first_probe>
-    void _probe_coroutine(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+    void _probe_coroutine(RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
 
     // for one key left outer join
     template <bool first_probe>
-    void _probe_from_ht_for_left_outer_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                            const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_outer_join(RuntimeState* state, const BuildKeyData& build_data,
+                                            const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_left_outer_join(RuntimeState* state,
-                                                                           const Buffer<CppType>& build_data,
-                                                                           const Buffer<CppType>& probe_data);
+                                                                           const BuildKeyData& build_data,
+                                                                           const ProbeKeyData& probe_data);
     // for one key left semi join
     template <bool first_probe>
-    void _probe_from_ht_for_left_semi_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                           const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_semi_join(RuntimeState* state, const BuildKeyData& build_data,
+                                           const ProbeKeyData& probe_data);
 
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_left_semi_join(RuntimeState* state,
-                                                                          const Buffer<CppType>& build_data,
-                                                                          const Buffer<CppType>& probe_data);
+                                                                          const BuildKeyData& build_data,
+                                                                          const ProbeKeyData& probe_data);
     // for one key left anti join
     template <bool first_probe>
-    void _probe_from_ht_for_left_anti_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                           const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_anti_join(RuntimeState* state, const BuildKeyData& build_data,
+                                           const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_left_anti_join(RuntimeState* state,
-                                                                          const Buffer<CppType>& build_data,
-                                                                          const Buffer<CppType>& probe_data);
+                                                                          const BuildKeyData& build_data,
+                                                                          const ProbeKeyData& probe_data);
 
     // for one key right outer join
     template <bool first_probe>
-    void _probe_from_ht_for_right_outer_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                             const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_outer_join(RuntimeState* state, const BuildKeyData& build_data,
+                                             const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_right_outer_join(RuntimeState* state,
-                                                                            const Buffer<CppType>& build_data,
-                                                                            const Buffer<CppType>& probe_data);
+                                                                            const BuildKeyData& build_data,
+                                                                            const ProbeKeyData& probe_data);
 
     // for one key right semi join
     template <bool first_probe>
-    void _probe_from_ht_for_right_semi_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                            const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_semi_join(RuntimeState* state, const BuildKeyData& build_data,
+                                            const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_right_semi_join(RuntimeState* state,
-                                                                           const Buffer<CppType>& build_data,
-                                                                           const Buffer<CppType>& probe_data);
+                                                                           const BuildKeyData& build_data,
+                                                                           const ProbeKeyData& probe_data);
 
     // for one key right anti join
     template <bool first_probe>
-    void _probe_from_ht_for_right_anti_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                            const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_right_anti_join(RuntimeState* state, const BuildKeyData& build_data,
+                                            const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_right_anti_join(RuntimeState* state,
-                                                                           const Buffer<CppType>& build_data,
-                                                                           const Buffer<CppType>& probe_data);
+                                                                           const BuildKeyData& build_data,
+                                                                           const ProbeKeyData& probe_data);
 
     // for one key full outer join
     template <bool first_probe>
-    void _probe_from_ht_for_full_outer_join(RuntimeState* state, const Buffer<CppType>& build_data,
-                                            const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_full_outer_join(RuntimeState* state, const BuildKeyData& build_data,
+                                            const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_full_outer_join(RuntimeState* state,
-                                                                           const Buffer<CppType>& build_data,
-                                                                           const Buffer<CppType>& probe_data);
+                                                                           const BuildKeyData& build_data,
+                                                                           const ProbeKeyData& probe_data);
 
     // for left semi join with other join conjunct
     template <bool first_probe>
-    void _probe_from_ht_for_left_semi_join_with_other_conjunct(RuntimeState* state, const Buffer<CppType>& build_data,
-                                                               const Buffer<CppType>& probe_data);
+    void _probe_from_ht_for_left_semi_join_with_other_conjunct(RuntimeState* state, const BuildKeyData& build_data,
+                                                               const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_left_semi_join_with_other_conjunct(
-            RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+            RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
 
     // for null aware anti join with other join conjunct
     template <bool first_probe>
     void _probe_from_ht_for_null_aware_anti_join_with_other_conjunct(RuntimeState* state,
-                                                                     const Buffer<CppType>& build_data,
-                                                                     const Buffer<CppType>& probe_data);
+                                                                     const BuildKeyData& build_data,
+                                                                     const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_null_aware_anti_join_with_other_conjunct(
-            RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+            RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
 
     // for one key right outer join with other conjunct
     template <bool first_probe>
     void _probe_from_ht_for_right_outer_right_semi_right_anti_join_with_other_conjunct(
-            RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+            RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_right_outer_right_semi_right_anti_join_with_other_conjunct(
-            RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+            RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
 
     // for one key full outer join with other join conjunct
     template <bool first_probe>
     void _probe_from_ht_for_left_outer_left_anti_full_outer_join_with_other_conjunct(RuntimeState* state,
-                                                                                     const Buffer<CppType>& build_data,
-                                                                                     const Buffer<CppType>& probe_data);
+                                                                                     const BuildKeyData& build_data,
+                                                                                     const ProbeKeyData& probe_data);
     HashTableProbeState::ProbeCoroutine _probe_from_ht_for_left_outer_left_anti_full_outer_join_with_other_conjunct(
-            RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
+            RuntimeState* state, const BuildKeyData& build_data, const ProbeKeyData& probe_data);
 
     JoinHashTableItems* _table_items = nullptr;
     HashTableProbeState* _probe_state = nullptr;
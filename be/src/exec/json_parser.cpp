@@ -16,6 +16,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "gutil/strings/substitute.h"
 
 namespace starrocks {
@@ -451,4 +454,106 @@ Status ExpandedJsonArrayParserWithRoot::advance() noexcept {
     return Status::OK();
 }
 
+Status JsonArrayStreamSplitter::append(const char* data, size_t len) {
+    if (_consumed > 0) {
+        // the returned batch is not referenced any more, keep the incomplete element only.
+        memmove(_buf.get(), _buf.get() + _consumed, _size - _consumed);
+        _size -= _consumed;
+        _scanned -= _consumed;
+        _boundary -= _consumed;
+        _consumed = 0;
+    }
+
+    if (_size + len + simdjson::SIMDJSON_PADDING > _capacity) {
+        // For efficiency reasons, simdjson requires a string with a few bytes (simdjson::SIMDJSON_PADDING) at the end.
+        size_t capacity = std::max(_capacity * 2, _size + len + simdjson::SIMDJSON_PADDING);
+        std::unique_ptr<char[]> buf(new char[capacity]);
+        if (_size > 0) {
+            memcpy(buf.get(), _buf.get(), _size);
+        }
+        _buf = std::move(buf);
+        _capacity = capacity;
+    }
+    memcpy(_buf.get() + _size, data, len);
+    _size += len;
+
+    return _scan();
+}
+
+Status JsonArrayStreamSplitter::_scan() {
+    auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+
+    for (; _scanned < _size; ++_scanned) {
+        char c = _buf[_scanned];
+        switch (_state) {
+        case State::BEFORE_ARRAY:
+            if (is_space(c)) continue;
+            if (c != '[') {
+                return Status::DataQualityError(fmt::format(
+                        "the value should be array type with strip_outer_array=true, but started with {}", c));
+            }
+            _buf[_scanned] = ' ';
+            _state = State::IN_ARRAY;
+            break;
+        case State::IN_ARRAY:
+            if (_in_string) {
+                if (_escaped) {
+                    _escaped = false;
+                } else if (c == '\\') {
+                    _escaped = true;
+                } else if (c == '"') {
+                    _in_string = false;
+                }
+                continue;
+            }
+            if (c == '"') {
+                _in_string = true;
+            } else if (c == '{' || c == '[') {
+                ++_depth;
+            } else if (c == '}' || c == ']') {
+                if (_depth > 0) {
+                    if (--_depth == 0) {
+                        _boundary = _scanned + 1;
+                    }
+                } else if (c == ']') {
+                    // end of the outer array.
+                    _buf[_scanned] = ' ';
+                    _boundary = _scanned;
+                    _state = State::AFTER_ARRAY;
+                } else {
+                    return Status::DataQualityError("unmatched '}' in json array");
+                }
+            } else if (c == ',' && _depth == 0) {
+                _buf[_scanned] = ' ';
+                _boundary = _scanned;
+            }
+            break;
+        case State::AFTER_ARRAY:
+            if (!is_space(c)) {
+                return Status::DataQualityError(fmt::format("unexpected {} after the end of json array", c));
+            }
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+Status JsonArrayStreamSplitter::next_batch(char** data, size_t* len, size_t* allocated) {
+    if (_boundary <= _consumed) {
+        return Status::EndOfFile("no complete element of json array");
+    }
+    *data = _buf.get() + _consumed;
+    *len = _boundary - _consumed;
+    *allocated = _capacity - _consumed;
+    _consumed = _boundary;
+    return Status::OK();
+}
+
+Status JsonArrayStreamSplitter::finish() const {
+    if (_state == State::IN_ARRAY) {
+        return Status::DataQualityError("the json array is not closed at the end of input");
+    }
+    return Status::EndOfFile("all data has been read");
+}
+
 } // namespace starrocks
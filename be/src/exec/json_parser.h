@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 
 #include "exprs/json_functions.h"
@@ -219,4 +220,47 @@ private:
     bool _curr_ready = false;
 };
 
+// JsonArrayStreamSplitter cuts a json array which arrives in pieces into batches of complete elements,
+// so that a huge array could be parsed window by window by JsonDocumentStreamParser,
+// instead of being materialized as a whole document.
+// The brackets of the outer array and the commas between elements are overwritten by spaces in place.
+// eg:
+// input: [{"key": 1}, {"ke  +  y": 2}]
+// batches: {"key": 1}  +  {"key": 2}
+class JsonArrayStreamSplitter {
+public:
+    // append copies data to the tail of the window.
+    // The batch returned by the previous next_batch is invalidated.
+    Status append(const char* data, size_t len);
+    // next_batch returns all the complete elements which are not returned yet.
+    // The returned data is followed by at least simdjson::SIMDJSON_PADDING bytes.
+    // Returns EndOfFile if there is no complete element.
+    Status next_batch(char** data, size_t* len, size_t* allocated);
+    // finish is called when there is no more input, it checks whether the outer array is closed.
+    Status finish() const;
+
+    size_t pending_bytes() const { return _boundary - _consumed; }
+
+private:
+    Status _scan();
+
+    enum class State { BEFORE_ARRAY, IN_ARRAY, AFTER_ARRAY };
+
+    std::unique_ptr<char[]> _buf;
+    size_t _size = 0;
+    size_t _capacity = 0;
+    // bytes before _consumed have been returned by next_batch.
+    size_t _consumed = 0;
+    // end of the last complete element.
+    size_t _boundary = 0;
+    // bytes before _scanned have been scanned.
+    size_t _scanned = 0;
+
+    State _state = State::BEFORE_ARRAY;
+    // nesting depth inside the outer array.
+    int _depth = 0;
+    bool _in_string = false;
+    bool _escaped = false;
+};
+
 } // namespace starrocks
@@ -25,6 +25,7 @@
 #include "column/adaptive_nullable_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "exec/json_parser.h"
 #include "exprs/cast_expr.h"
 #include "exprs/column_ref.h"
@@ -331,6 +332,12 @@ JsonReader::JsonReader(starrocks::RuntimeState* state, starrocks::ScannerCounter
 }
 
 Status JsonReader::open() {
+    if (_scanner->_scan_range.ranges[0].file_type == TFileType::FILE_STREAM && _scanner->_strip_outer_array &&
+        _scanner->_root_paths.empty()) {
+        // TODO: Remove the down_cast, should not rely on the specific implementation.
+        auto* stream = down_cast<StreamLoadPipeInputStream*>(_file->stream().get());
+        _json_array_streaming = stream->pipe()->is_json_array_streaming();
+    }
     RETURN_IF_ERROR(_read_and_parse_json());
     _empty_parser = false;
     _closed = false;
@@ -418,7 +425,10 @@ Status JsonReader::read_chunk(Chunk* chunk, int32_t rows_to_read) {
             }
         } else {
             // Without json root set, the strip_outer_array determines whether to expand outer array.
-            if (_scanner->_strip_outer_array) {
+            if (_json_array_streaming) {
+                // The elements of json array have been cut out as a document stream.
+                st = _read_rows<JsonDocumentStreamParser>(chunk, rows_to_read, &rows_read);
+            } else if (_scanner->_strip_outer_array) {
                 st = _read_rows<JsonArrayParser>(chunk, rows_to_read, &rows_read);
             } else {
                 st = _read_rows<JsonDocumentStreamParser>(chunk, rows_to_read, &rows_read);
@@ -685,6 +695,49 @@ Status JsonReader::_read_file_stream() {
     return Status::OK();
 }
 
+// read complete elements of the json array from the pipe, until there are at least
+// config::streaming_load_json_array_window_bytes of them or the pipe is exhausted.
+Status JsonReader::_read_file_stream_window() {
+    if (_stream_pipe == nullptr) {
+        // TODO: Remove the down_cast, should not rely on the specific implementation.
+        auto pipe = down_cast<StreamLoadPipeInputStream*>(_file->stream().get())->pipe();
+        if (_range_desc.compression_type != TCompressionType::NO_COMPRESSION &&
+            _range_desc.compression_type != TCompressionType::UNKNOWN_COMPRESSION) {
+            _stream_pipe = std::make_shared<CompressedStreamLoadPipeReader>(pipe, _range_desc.compression_type);
+        } else {
+            _stream_pipe = std::make_shared<StreamLoadPipeReader>(pipe);
+        }
+        _stream_splitter = std::make_unique<JsonArrayStreamSplitter>();
+    }
+
+    ++_counter->file_read_count;
+    SCOPED_RAW_TIMER(&_counter->file_read_ns);
+    const auto window_bytes = static_cast<size_t>(config::streaming_load_json_array_window_bytes);
+    while (!_stream_eof && _stream_splitter->pending_bytes() < window_bytes) {
+        auto res = _stream_pipe->read();
+        if (!res.ok()) {
+            if (res.status().is_end_of_file()) {
+                _stream_eof = true;
+                break;
+            }
+            if (res.status().is_time_out() && _stream_splitter->pending_bytes() > 0) {
+                // parse the elements available so far, instead of waiting for a full window.
+                break;
+            }
+            return res.status();
+        }
+        const auto& buf = res.value();
+        _state->update_num_bytes_scan_from_source(buf->remaining());
+        RETURN_IF_ERROR(_stream_splitter->append(buf->ptr, buf->remaining()));
+    }
+
+    auto st = _stream_splitter->next_batch(&_payload, &_payload_size, &_payload_capacity);
+    if (st.is_end_of_file() && _stream_eof) {
+        return _stream_splitter->finish();
+    }
+    return st;
+}
+
 // read one json string from file read and parse it to json doc.
 Status JsonReader::_read_file_broker() {
     ++_counter->file_read_count;
@@ -761,6 +814,13 @@ Status JsonReader::_check_ndjson() {
 
 // read one json string from file read and parse it to json doc.
 Status JsonReader::_read_and_parse_json() {
+    if (_json_array_streaming) {
+        RETURN_IF_ERROR(_read_file_stream_window());
+        _parser = std::make_unique<JsonDocumentStreamParser>(&_simdjson_parser);
+        _empty_parser = false;
+        return _parser->parse(_payload, _payload_size, _payload_capacity);
+    }
+
     const auto& file_type = _scanner->_scan_range.ranges[0].file_type;
     if (file_type == TFileType::FILE_STREAM) {
         RETURN_IF_ERROR(_read_file_stream());
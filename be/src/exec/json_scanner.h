@@ -32,6 +32,7 @@ namespace starrocks {
 struct SimpleJsonPath;
 class JsonReader;
 class JsonParser;
+class JsonArrayStreamSplitter;
 class JsonScanner : public FileScanner {
 public:
     JsonScanner(RuntimeState* state, RuntimeProfile* profile, const TBrokerScanRange& scan_range,
@@ -110,6 +111,7 @@ private:
 
     Status _read_and_parse_json();
     Status _read_file_stream();
+    Status _read_file_stream_window();
     Status _read_file_broker();
     Status _parse_payload();
 
@@ -155,6 +157,13 @@ private:
 
     ByteBufferPtr _file_stream_buffer;
 
+    // The json array in stream load pipe arrives in pieces, and it's parsed window by window
+    // instead of being materialized as a whole document.
+    bool _json_array_streaming = false;
+    bool _stream_eof = false;
+    std::shared_ptr<StreamLoadPipeReader> _stream_pipe;
+    std::unique_ptr<JsonArrayStreamSplitter> _stream_splitter;
+
     std::unique_ptr<char[]> _file_broker_buffer = nullptr;
     size_t _file_broker_buffer_size = 0;
     size_t _file_broker_buffer_capacity = 0;
@@ -29,6 +29,9 @@ Status AggregateStreamingSinkOperator::prepare(RuntimeState* state) {
     if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::LIMITED_MEM) {
         _limited_mem_state.limited_memory_size = config::streaming_agg_limited_memory_size;
     }
+    if (config::enable_streaming_agg_heavy_hitter_preaggregation && !_aggregator->is_none_group_by_exprs()) {
+        _heavy_hitter_context = std::make_unique<AggrHeavyHitterContext>();
+    }
     return _aggregator->open(state);
 }
 
@@ -99,7 +102,11 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_force_streaming(const Chun
 Status AggregateStreamingSinkOperator::_push_chunk_by_force_preaggregation(const ChunkPtr& chunk,
                                                                            const size_t chunk_size) {
     SCOPED_TIMER(_aggregator->agg_compute_timer());
+    const size_t prev_ht_size = _aggregator->hash_map_variant().size();
     TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(chunk_size));
+    COUNTER_UPDATE(_aggregator->preagg_row_count(), chunk_size);
+    COUNTER_UPDATE(_aggregator->preagg_reduced_row_count(),
+                   chunk_size - (_aggregator->hash_map_variant().size() - prev_ht_size));
     if (_aggregator->is_none_group_by_exprs()) {
         RETURN_IF_ERROR(_aggregator->compute_single_agg_state(chunk.get(), chunk_size));
     } else {
@@ -121,6 +128,9 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
     }
 
     size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
+    // The rows found in the hash table are merged into the existing groups.
+    COUNTER_UPDATE(_aggregator->preagg_row_count(), zero_count);
+    COUNTER_UPDATE(_aggregator->preagg_reduced_row_count(), zero_count);
     // very poor aggregation
     if (zero_count == 0) {
         SCOPED_TIMER(_aggregator->streaming_timer());
@@ -165,6 +175,9 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_selective_preaggregation(c
  * SELECTIVE_PREAGG state aggregates continuous_limit chunks, then shifting to ADJUST state.
  */
 Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk, const size_t chunk_size) {
+    if (_heavy_hitter_context != nullptr) {
+        return _push_chunk_by_heavy_hitters(chunk, chunk_size);
+    }
     size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
     const size_t continuous_limit = _auto_context.get_continuous_limit();
     switch (_auto_state) {
@@ -296,6 +309,67 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
     return Status::OK();
 }
 
+Status AggregateStreamingSinkOperator::_push_chunk_by_heavy_hitters(const ChunkPtr& chunk, const size_t chunk_size) {
+    auto& context = *_heavy_hitter_context;
+    size_t num_heavy_rows = 0;
+    {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        num_heavy_rows = context.select_heavy_rows(_aggregator->group_by_columns(), chunk_size, &context.selection);
+    }
+
+    switch (context.mode) {
+    case AggrHeavyHitterMode::SPLIT: {
+        if (num_heavy_rows == 0) {
+            RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
+        } else if (num_heavy_rows == chunk_size) {
+            RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(chunk, chunk_size));
+        } else {
+            RETURN_IF_ERROR(_push_chunk_by_heavy_hitter_split(chunk, num_heavy_rows));
+        }
+        COUNTER_UPDATE(_aggregator->heavy_hitter_row_count(), num_heavy_rows);
+        break;
+    }
+    case AggrHeavyHitterMode::PASS_THROUGH:
+        RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
+        break;
+    case AggrHeavyHitterMode::PREAGG:
+        RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(chunk, chunk_size));
+        break;
+    case AggrHeavyHitterMode::SELECTIVE_PREAGG:
+        RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(chunk, chunk_size, true));
+        break;
+    }
+
+    context.finish_chunk(chunk_size, num_heavy_rows,
+                         _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool()));
+    return Status::OK();
+}
+
+Status AggregateStreamingSinkOperator::_push_chunk_by_heavy_hitter_split(const ChunkPtr& chunk,
+                                                                         const size_t num_heavy_rows) {
+    const size_t chunk_size = chunk->num_rows();
+    {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        const size_t prev_ht_size = _aggregator->hash_map_variant().size();
+        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selected_rows(
+                chunk_size, _heavy_hitter_context->selection, num_heavy_rows));
+        COUNTER_UPDATE(_aggregator->preagg_row_count(), num_heavy_rows);
+        COUNTER_UPDATE(_aggregator->preagg_reduced_row_count(),
+                       num_heavy_rows - (_aggregator->hash_map_variant().size() - prev_ht_size));
+        RETURN_IF_ERROR(_aggregator->compute_batch_agg_states_with_selection(chunk.get(), chunk_size));
+        TRY_CATCH_BAD_ALLOC(_aggregator->try_convert_to_two_level_map());
+    }
+    {
+        // The evaluated group by columns are filtered to the other rows, which are streamed.
+        SCOPED_TIMER(_aggregator->streaming_timer());
+        ChunkPtr res = std::make_shared<Chunk>();
+        RETURN_IF_ERROR(_aggregator->output_chunk_by_streaming_with_selection(chunk.get(), &res));
+        _aggregator->offer_chunk_to_buffer(res);
+    }
+    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
+    return Status::OK();
+}
+
 Status AggregateStreamingSinkOperator::_push_chunk_by_limited_memory(const ChunkPtr& chunk, const size_t chunk_size) {
     if (_limited_mem_state.has_limited(*_aggregator)) {
         RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
@@ -65,6 +65,12 @@ private:
     // Invoked by push_chunk  if current mode is TStreamingPreaggregationMode::LIMITED
     [[nodiscard]] Status _push_chunk_by_limited_memory(const ChunkPtr& chunk, const size_t chunk_size);
 
+    // Invoked by _push_chunk_by_auto if config::enable_streaming_agg_heavy_hitter_preaggregation is on
+    [[nodiscard]] Status _push_chunk_by_heavy_hitters(const ChunkPtr& chunk, const size_t chunk_size);
+
+    // Aggregate the heavy rows marked in the selection of _heavy_hitter_context, and stream the others.
+    [[nodiscard]] Status _push_chunk_by_heavy_hitter_split(const ChunkPtr& chunk, const size_t num_heavy_rows);
+
     // It is used to perform aggregation algorithms shared by
     // AggregateStreamingSourceOperator. It is
     // - prepared at SinkOperator::prepare(),
@@ -76,6 +82,8 @@ private:
     AggrAutoState _auto_state{};
     AggrAutoContext _auto_context;
     LimitedMemAggState _limited_mem_state;
+    // Only set if the rows of heavy-hitter keys are pre-aggregated in the AUTO mode.
+    std::unique_ptr<AggrHeavyHitterContext> _heavy_hitter_context;
 };
 
 class AggregateStreamingSinkOperatorFactory final : public OperatorFactory {
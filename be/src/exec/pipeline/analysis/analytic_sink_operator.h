@@ -23,8 +23,8 @@ namespace starrocks::pipeline {
 class AnalyticSinkOperator : public Operator {
 public:
     AnalyticSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                         const TPlanNode& tnode, AnalytorPtr&& analytor)
-            : Operator(factory, id, "analytic_sink", plan_node_id, false, driver_sequence),
+                         const TPlanNode& tnode, AnalytorPtr&& analytor, const std::string& name = "analytic_sink")
+            : Operator(factory, id, name, plan_node_id, false, driver_sequence),
               _tnode(tnode),
               _analytor(std::move(analytor)) {
         _analytor->ref();
@@ -42,7 +42,7 @@ public:
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
-private:
+protected:
     TPlanNode _tnode;
     // It is used to perform analytic algorithms
     // shared by AnalyticSourceOperator
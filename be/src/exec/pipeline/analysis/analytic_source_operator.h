@@ -23,8 +23,8 @@ namespace starrocks::pipeline {
 class AnalyticSourceOperator : public SourceOperator {
 public:
     AnalyticSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                           AnalytorPtr&& analytor)
-            : SourceOperator(factory, id, "analytic_source", plan_node_id, false, driver_sequence),
+                           AnalytorPtr&& analytor, const std::string& name = "analytic_source")
+            : SourceOperator(factory, id, name, plan_node_id, false, driver_sequence),
               _analytor(std::move(analytor)) {
         _analytor->ref();
     }
@@ -39,7 +39,7 @@ public:
 
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
-private:
+protected:
     // It is used to perform analytic algorithms
     // shared by AnalyticSinkOperator
     AnalytorPtr _analytor = nullptr;
@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/analysis/spillable_analytic_sink_operator.h"
+
+#include "exec/pipeline/query_context.h"
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+Status SpillableAnalyticSinkOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(AnalyticSinkOperator::prepare(state));
+    const auto& spiller = _analytor->spiller();
+    spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+    RETURN_IF_ERROR(spiller->prepare(state));
+    if (state->spill_mode() == TSpillMode::FORCE) {
+        _spill_strategy = spill::SpillStrategy::SPILL_ALL;
+    }
+    _peak_revocable_mem_bytes = _unique_metrics->AddHighWaterMarkCounter(
+            "PeakRevocableMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
+    return Status::OK();
+}
+
+bool SpillableAnalyticSinkOperator::need_input() const {
+    if (!_analytor->is_offloading_input_chunks()) {
+        return AnalyticSinkOperator::need_input();
+    }
+    // Output chunks of offloaded input chunks can only be consumed after all the input chunks are spilled,
+    // so the output buffer must not block the input. They only contain the window function results.
+    return !is_finished() && !_analytor->spiller()->is_full();
+}
+
+Status SpillableAnalyticSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_spill_strategy == spill::SpillStrategy::SPILL_ALL && !_analytor->is_offloading_input_chunks()) {
+        RETURN_IF_ERROR(_offload_input_chunks(state));
+    }
+    RETURN_IF_ERROR(AnalyticSinkOperator::push_chunk(state, chunk));
+    RETURN_IF_ERROR(_analytor->spiller()->task_status());
+    set_revocable_mem_bytes(_analytor->offloadable_bytes());
+    return Status::OK();
+}
+
+Status SpillableAnalyticSinkOperator::set_finishing(RuntimeState* state) {
+    ONCE_DETECT(_set_finishing_once);
+    RETURN_IF_ERROR(AnalyticSinkOperator::set_finishing(state));
+    if (state->is_cancelled() || !_analytor->is_offloading_input_chunks()) {
+        return Status::OK();
+    }
+
+    // Flush the input chunks remaining in the mem table, the source operator starts to restore them
+    // once all the data is flushed.
+    const auto& spiller = _analytor->spiller();
+    RETURN_IF_ERROR(spiller->flush(state, TRACKER_WITH_SPILLER_GUARD(state, spiller)));
+    return spiller->set_flush_all_call_back([]() { return Status::OK(); }, state,
+                                            TRACKER_WITH_SPILLER_GUARD(state, spiller));
+}
+
+Status SpillableAnalyticSinkOperator::set_finished(RuntimeState* state) {
+    _analytor->spiller()->cancel();
+    return AnalyticSinkOperator::set_finished(state);
+}
+
+Status SpillableAnalyticSinkOperator::_offload_input_chunks(RuntimeState* state) {
+    std::weak_ptr<spill::Spiller> weak_spiller = _analytor->spiller();
+    return _analytor->offload_input_chunks([state, weak_spiller](const ChunkPtr& chunk) {
+        auto spiller = weak_spiller.lock();
+        RETURN_IF(spiller == nullptr, Status::Cancelled("spiller has been released"));
+        return spiller->spill(state, chunk, TRACKER_WITH_SPILLER_GUARD(state, spiller));
+    });
+}
+
+Status SpillableAnalyticSinkOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+
+    _spill_options = std::make_shared<spill::SpilledOptions>();
+    _spill_options->spill_mem_table_bytes_size = state->spill_mem_table_size();
+    // Input chunks must be restored in the same order as they are spilled, a single mem table makes sure that
+    // the blocks are flushed one by one.
+    _spill_options->mem_table_pool_size = 1;
+    _spill_options->spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    _spill_options->min_spilled_size = state->spill_operator_min_bytes();
+    _spill_options->block_manager = state->query_ctx()->spill_manager()->block_manager();
+    _spill_options->name = "spillable-analytic-sink";
+    _spill_options->plan_node_id = _plan_node_id;
+    _spill_options->encode_level = state->spill_encode_level();
+    _spill_options->wg = state->fragment_ctx()->workgroup();
+    _spill_options->enable_buffer_read = state->enable_spill_buffer_read();
+    _spill_options->max_read_buffer_bytes = state->max_spill_read_buffer_bytes_per_driver();
+
+    return Status::OK();
+}
+
+OperatorPtr SpillableAnalyticSinkOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    auto analytor = _analytor_factory->create(driver_sequence);
+    analytor->set_spiller(_spill_factory->create(*_spill_options));
+    return std::make_shared<SpillableAnalyticSinkOperator>(this, _id, _plan_node_id, driver_sequence, _tnode,
+                                                           std::move(analytor));
+}
+} // namespace starrocks::pipeline
@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "exec/pipeline/analysis/analytic_sink_operator.h"
+#include "exec/spill/options.h"
+#include "exec/spill/spiller_factory.h"
+#include "util/race_detect.h"
+
+namespace starrocks::pipeline {
+
+// Spillable version of AnalyticSinkOperator.
+// Window functions over a huge partition (or frame) need to buffer the whole partition before producing outputs,
+// most of the memory is occupied by the columns that are only used to build the output chunks. Once spilling is
+// triggered, these input chunks are written to the spiller in order, and only the columns required to evaluate
+// the window functions are kept in memory. SpillableAnalyticSourceOperator restores them in the same order and
+// stitches them with the window function results.
+// The evaluation columns are not spilled, even the rows behind the frame, so the memory is still bounded by the
+// evaluation columns buffered by the analytor, e.g. a whole partition for the materializing process.
+class SpillableAnalyticSinkOperator final : public AnalyticSinkOperator {
+public:
+    template <class... Args>
+    SpillableAnalyticSinkOperator(Args&&... args)
+            : AnalyticSinkOperator(std::forward<Args>(args)..., "spillable_analytic_sink") {}
+
+    ~SpillableAnalyticSinkOperator() override = default;
+
+    bool need_input() const override;
+    Status set_finishing(RuntimeState* state) override;
+    Status set_finished(RuntimeState* state) override;
+
+    Status prepare(RuntimeState* state) override;
+
+    Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
+
+    bool spillable() const override { return true; }
+    void set_execute_mode(int performance_level) override { _spill_strategy = spill::SpillStrategy::SPILL_ALL; }
+
+    size_t estimated_memory_reserved(const ChunkPtr& chunk) override {
+        return chunk != nullptr ? chunk->memory_usage() : 0;
+    }
+
+private:
+    Status _offload_input_chunks(RuntimeState* state);
+
+    DECLARE_ONCE_DETECTOR(_set_finishing_once);
+    spill::SpillStrategy _spill_strategy = spill::SpillStrategy::NO_SPILL;
+};
+
+class SpillableAnalyticSinkOperatorFactory final : public OperatorFactory {
+public:
+    SpillableAnalyticSinkOperatorFactory(int32_t id, int32_t plan_node_id, const TPlanNode& tnode,
+                                         AnalytorFactoryPtr analytor_factory)
+            : OperatorFactory(id, "spillable_analytic_sink", plan_node_id),
+              _tnode(tnode),
+              _analytor_factory(std::move(analytor_factory)) {}
+
+    ~SpillableAnalyticSinkOperatorFactory() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
+
+private:
+    TPlanNode _tnode;
+    AnalytorFactoryPtr _analytor_factory;
+
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
+};
+} // namespace starrocks::pipeline
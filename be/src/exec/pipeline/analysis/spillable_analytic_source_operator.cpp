@@ -0,0 +1,94 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/analysis/spillable_analytic_source_operator.h"
+
+#include <fmt/format.h>
+
+#include "exec/spill/executor.h"
+#include "exec/spill/spiller.hpp"
+
+namespace starrocks::pipeline {
+
+bool SpillableAnalyticSourceOperator::has_output() const {
+    if (_pending_chunk == nullptr) {
+        return AnalyticSourceOperator::has_output();
+    }
+    if (!_is_pending_chunk_offloaded) {
+        return true;
+    }
+    const auto& spiller = _analytor->spiller();
+    RETURN_TRUE_IF_SPILL_TASK_ERROR(spiller);
+    return spiller->has_output_data();
+}
+
+bool SpillableAnalyticSourceOperator::is_finished() const {
+    return _pending_chunk == nullptr && AnalyticSourceOperator::is_finished();
+}
+
+Status SpillableAnalyticSourceOperator::set_finished(RuntimeState* state) {
+    _pending_chunk.reset();
+    if (_analytor->spiller() != nullptr) {
+        _analytor->spiller()->cancel();
+    }
+    return AnalyticSourceOperator::set_finished(state);
+}
+
+StatusOr<ChunkPtr> SpillableAnalyticSourceOperator::pull_chunk(RuntimeState* state) {
+    const auto& spiller = _analytor->spiller();
+    RETURN_IF_ERROR(spiller->task_status());
+
+    if (_pending_chunk == nullptr) {
+        _pending_chunk = _analytor->poll_chunk_buffer();
+        if (_pending_chunk == nullptr) {
+            return nullptr;
+        }
+        const int64_t first_offloaded = _analytor->first_offloaded_chunk_index();
+        _is_pending_chunk_offloaded = first_offloaded >= 0 && _num_polled_chunks >= first_offloaded;
+        _num_polled_chunks++;
+    }
+
+    ChunkPtr chunk;
+    if (_is_pending_chunk_offloaded) {
+        if (!spiller->has_output_data()) {
+            return nullptr;
+        }
+        ASSIGN_OR_RETURN(chunk, spiller->restore(state, TRACKER_WITH_SPILLER_READER_GUARD(state, spiller)));
+        if (chunk == nullptr || chunk->is_empty()) {
+            return nullptr;
+        }
+        // The output chunk may be truncated by limit.
+        if (chunk->num_rows() < _pending_chunk->num_rows()) {
+            return Status::InternalError(fmt::format("restored analytic input chunk has {} rows, expected {}",
+                                                     chunk->num_rows(), _pending_chunk->num_rows()));
+        }
+        chunk->set_num_rows(_pending_chunk->num_rows());
+        // Keep the same column order as the output chunk of non-offloaded input chunk.
+        std::vector<SlotId> slot_ids(_pending_chunk->num_columns());
+        for (const auto& [slot_id, index] : _pending_chunk->get_slot_id_to_index_map()) {
+            slot_ids[index] = slot_id;
+        }
+        for (size_t i = 0; i < slot_ids.size(); i++) {
+            chunk->append_column(_pending_chunk->get_column_by_index(i), slot_ids[i]);
+        }
+    } else {
+        chunk = std::move(_pending_chunk);
+    }
+    _pending_chunk.reset();
+
+    eval_runtime_bloom_filters(chunk.get());
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters({}, chunk.get()));
+    return chunk;
+}
+} // namespace starrocks::pipeline
@@ -0,0 +1,63 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "exec/pipeline/analysis/analytic_source_operator.h"
+
+namespace starrocks::pipeline {
+
+// Source operator paired with SpillableAnalyticSinkOperator. Output chunks of offloaded input chunks only
+// contain the window function results, they are stitched with the input chunks restored from the spiller,
+// which are restored in the same order as they are spilled.
+class SpillableAnalyticSourceOperator final : public AnalyticSourceOperator {
+public:
+    template <class... Args>
+    SpillableAnalyticSourceOperator(Args&&... args)
+            : AnalyticSourceOperator(std::forward<Args>(args)..., "spillable_analytic_source") {}
+
+    ~SpillableAnalyticSourceOperator() override = default;
+
+    bool has_output() const override;
+    bool is_finished() const override;
+
+    Status set_finished(RuntimeState* state) override;
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+private:
+    // The output chunk polled from analytor, which is waiting for its input chunk to be restored.
+    ChunkPtr _pending_chunk;
+    bool _is_pending_chunk_offloaded = false;
+    int64_t _num_polled_chunks = 0;
+};
+
+class SpillableAnalyticSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    SpillableAnalyticSourceOperatorFactory(int32_t id, int32_t plan_node_id, AnalytorFactoryPtr analytor_factory)
+            : SourceOperatorFactory(id, "spillable_analytic_source", plan_node_id),
+              _analytor_factory(std::move(analytor_factory)) {}
+
+    ~SpillableAnalyticSourceOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        auto analytor = _analytor_factory->create(driver_sequence);
+        return std::make_shared<SpillableAnalyticSourceOperator>(this, _id, _plan_node_id, driver_sequence,
+                                                                 std::move(analytor));
+    }
+
+private:
+    AnalytorFactoryPtr _analytor_factory = nullptr;
+};
+} // namespace starrocks::pipeline
@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
@@ -97,9 +98,109 @@ Status ShufflePartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t nu
     _shuffle_channel_id.resize(num_rows);
 
     _shuffler->local_exchange_shuffle(_shuffle_channel_id, _hash_values, num_rows);
+    if (_heavy_key_detector != nullptr) {
+        _spread_heavy_keys(num_rows);
+    }
     return Status::OK();
 }
 
+void ShufflePartitioner::_spread_heavy_keys(size_t num_rows) {
+    _heavy_key_detector->update(_hash_values, num_rows);
+    if (!_heavy_key_detector->has_heavy_keys()) {
+        return;
+    }
+
+    _load_tracker->light_partitions(&_light_partitions);
+    const size_t num_light_partitions = _light_partitions.size();
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (_heavy_key_detector->is_heavy(_hash_values[i])) {
+            _shuffle_channel_id[i] = _light_partitions[_next_light_partition++ % num_light_partitions];
+        }
+    }
+}
+
+HeavyKeyDetector::HeavyKeyDetector(size_t num_partitions)
+        : _num_partitions(std::max<size_t>(num_partitions, 1)),
+          // Any key taking more than 1/_capacity of the samples is guaranteed to be tracked.
+          _capacity(std::clamp<size_t>(num_partitions * 2, 8, 64)) {
+    _counters.reserve(_capacity);
+}
+
+void HeavyKeyDetector::_add(uint32_t hash) {
+    _num_samples++;
+    for (auto& counter : _counters) {
+        if (counter.hash == hash) {
+            counter.count++;
+            return;
+        }
+    }
+    if (_counters.size() < _capacity) {
+        _counters.push_back({hash, 1, 0});
+        return;
+    }
+    // Replace the key with the minimum count, which bounds the count the new key may have missed.
+    auto& min_counter =
+            *std::min_element(_counters.begin(), _counters.end(),
+                              [](const Counter& lhs, const Counter& rhs) { return lhs.count < rhs.count; });
+    min_counter = {hash, min_counter.count + 1, min_counter.count};
+}
+
+void HeavyKeyDetector::update(const std::vector<uint32_t>& hash_values, size_t num_rows) {
+    const size_t stride = std::max<size_t>(1, num_rows / MAX_SAMPLES_PER_CHUNK);
+    for (size_t i = 0; i < num_rows; i += stride) {
+        _add(hash_values[i]);
+    }
+
+    if (_num_samples >= DECAY_SAMPLES) {
+        for (auto& counter : _counters) {
+            counter.count /= 2;
+            counter.error /= 2;
+        }
+        _num_samples /= 2;
+    }
+
+    _heavy_keys.clear();
+    if (_num_samples < MIN_SAMPLES) {
+        return;
+    }
+    for (const auto& counter : _counters) {
+        // Use the lower bound of the count to avoid false positives.
+        if ((counter.count - counter.error) * _num_partitions > _num_samples) {
+            _heavy_keys.push_back(counter.hash);
+        }
+    }
+}
+
+PartitionLoadTracker::PartitionLoadTracker(LocalExchangeSourceOperatorFactory* source, size_t num_partitions)
+        : _source(source),
+          _num_partitions(num_partitions),
+          _routed_rows(std::make_unique<std::atomic<int64_t>[]>(num_partitions)) {
+    for (size_t i = 0; i < num_partitions; ++i) {
+        _routed_rows[i] = 0;
+    }
+}
+
+void PartitionLoadTracker::light_partitions(std::vector<uint32_t>* partitions) const {
+    auto& sources = _source->get_sources();
+    // The dop of the source may be adjusted to be smaller after the tracker is created.
+    const size_t num_partitions = std::min(_num_partitions, sources.size());
+    DCHECK_GT(num_partitions, 0);
+
+    std::vector<int64_t> loads(num_partitions);
+    int64_t total_load = 0;
+    for (size_t i = 0; i < num_partitions; ++i) {
+        loads[i] = _routed_rows[i].load(std::memory_order_relaxed) + sources[i]->num_buffered_rows();
+        total_load += loads[i];
+    }
+
+    partitions->clear();
+    for (size_t i = 0; i < num_partitions; ++i) {
+        if (loads[i] * static_cast<int64_t>(num_partitions) <= total_load) {
+            partitions->push_back(i);
+        }
+    }
+}
+
 Status RandomPartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t num_partitions) {
     size_t num_rows = chunk->num_rows();
     _shuffle_channel_id.resize(num_rows, 0);
@@ -121,14 +222,19 @@ Status RandomPartitioner::shuffle_channel_ids(const ChunkPtr& chunk, int32_t num
 
 PartitionExchanger::PartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                                        LocalExchangeSourceOperatorFactory* source, const TPartitionType::type part_type,
-                                       std::vector<ExprContext*> partition_expr_ctxs)
+                                       std::vector<ExprContext*> partition_expr_ctxs, bool spread_heavy_keys)
         : LocalExchanger(strings::Substitute("Partition($0)", to_string(part_type)), memory_manager, source),
           _part_type(part_type),
-          _partition_exprs(std::move(partition_expr_ctxs)) {}
+          _partition_exprs(std::move(partition_expr_ctxs)) {
+    if (spread_heavy_keys && config::enable_local_shuffle_spread_heavy_keys) {
+        _load_tracker = std::make_unique<PartitionLoadTracker>(source, source->degree_of_parallelism());
+    }
+}
 
 void PartitionExchanger::incr_sinker() {
     LocalExchanger::incr_sinker();
-    _partitioners.emplace_back(std::make_unique<ShufflePartitioner>(_source, _part_type, _partition_exprs));
+    _partitioners.emplace_back(
+            std::make_unique<ShufflePartitioner>(_source, _part_type, _partition_exprs, _load_tracker.get()));
 }
 
 Status PartitionExchanger::prepare(RuntimeState* state) {
@@ -158,6 +264,12 @@ Status PartitionExchanger::accept(const ChunkPtr& chunk, const int32_t sink_driv
     // it will be overwritten by the next time calling partitioner.partition_chunk().
     std::shared_ptr<std::vector<uint32_t>> partition_row_indexes = std::make_shared<std::vector<uint32_t>>(num_rows);
     RETURN_IF_ERROR(partitioner->partition_chunk(chunk, num_partitions, *partition_row_indexes));
+    if (_load_tracker != nullptr) {
+        for (size_t i = 0; i < num_partitions; ++i) {
+            _load_tracker->add_routed_rows(i, partitioner->partition_end_offset(i) -
+                                                      partitioner->partition_begin_offset(i));
+        }
+    }
     RETURN_IF_ERROR(partitioner->send_chunk(chunk, std::move(partition_row_indexes)));
     return Status::OK();
 }
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -73,26 +75,105 @@ protected:
     std::vector<uint32_t> _shuffle_channel_id;
 };
 
+// Detect the heavy keys among the rows sent by a sink driver of local shuffle.
+// The keys are identified by their partition hash values, and counted by the space-saving algorithm
+// over the sampled rows. The counts decay periodically, so that the heavy keys follow the change of data.
+// A key is heavy if it alone takes more than the fair share of one partition.
+class HeavyKeyDetector {
+public:
+    explicit HeavyKeyDetector(size_t num_partitions);
+
+    // Sample the hash values of a chunk and refresh the heavy keys.
+    void update(const std::vector<uint32_t>& hash_values, size_t num_rows);
+
+    bool has_heavy_keys() const { return !_heavy_keys.empty(); }
+    bool is_heavy(uint32_t hash) const {
+        return std::find(_heavy_keys.begin(), _heavy_keys.end(), hash) != _heavy_keys.end();
+    }
+    const std::vector<uint32_t>& heavy_keys() const { return _heavy_keys; }
+
+    static constexpr size_t MAX_SAMPLES_PER_CHUNK = 256;
+    // Keys are not reported as heavy before this many rows are sampled.
+    static constexpr size_t MIN_SAMPLES = 4096;
+    // Halve all the counts when this many rows are sampled.
+    static constexpr size_t DECAY_SAMPLES = 65536;
+
+private:
+    void _add(uint32_t hash);
+
+    struct Counter {
+        uint32_t hash;
+        size_t count;
+        // The upper bound of the overestimation of count.
+        size_t error;
+    };
+
+    const size_t _num_partitions;
+    const size_t _capacity;
+    std::vector<Counter> _counters;
+    size_t _num_samples = 0;
+    std::vector<uint32_t> _heavy_keys;
+};
+
+// Track the load of each source driver of local shuffle, which is shared by all the sink drivers.
+// The load is the number of rows routed to the driver so far, which is what its hash table is built from,
+// plus the number of rows still buffered in its queue.
+class PartitionLoadTracker {
+public:
+    PartitionLoadTracker(LocalExchangeSourceOperatorFactory* source, size_t num_partitions);
+
+    void add_routed_rows(size_t partition_id, size_t num_rows) {
+        _routed_rows[partition_id].fetch_add(num_rows, std::memory_order_relaxed);
+    }
+
+    // Collect the partitions whose load is not above the average, it is never empty.
+    void light_partitions(std::vector<uint32_t>* partitions) const;
+
+    size_t num_partitions() const { return _num_partitions; }
+
+private:
+    LocalExchangeSourceOperatorFactory* _source;
+    const size_t _num_partitions;
+    std::unique_ptr<std::atomic<int64_t>[]> _routed_rows;
+};
+
 // Shuffle by partition columns and partition type.
+// If load_tracker is set, the rows of heavy keys are spread to the light partitions instead of the partition
+// of their hash values, so the rows of one key may be sent to several partitions. It can be used only if
+// the downstream operator tolerates that, e.g. the aggregate whose output is merged by another aggregate later.
 class ShufflePartitioner final : public Partitioner {
 public:
     ShufflePartitioner(LocalExchangeSourceOperatorFactory* source, const TPartitionType::type part_type,
-                       const std::vector<ExprContext*>& partition_expr_ctxs)
-            : Partitioner(source), _part_type(part_type), _partition_expr_ctxs(partition_expr_ctxs) {
+                       const std::vector<ExprContext*>& partition_expr_ctxs,
+                       PartitionLoadTracker* load_tracker = nullptr)
+            : Partitioner(source),
+              _part_type(part_type),
+              _partition_expr_ctxs(partition_expr_ctxs),
+              _load_tracker(load_tracker) {
         _partitions_columns.resize(partition_expr_ctxs.size());
         _hash_values.reserve(source->runtime_state()->chunk_size());
+        if (_load_tracker != nullptr) {
+            _heavy_key_detector = std::make_unique<HeavyKeyDetector>(_load_tracker->num_partitions());
+        }
     }
     ~ShufflePartitioner() override = default;
 
     Status shuffle_channel_ids(const ChunkPtr& chunk, int32_t num_partitions) override;
 
 private:
+    void _spread_heavy_keys(size_t num_rows);
+
     const TPartitionType::type _part_type;
     // Compute per-row partition values.
     const std::vector<ExprContext*>& _partition_expr_ctxs;
     Columns _partitions_columns;
     std::vector<uint32_t> _hash_values;
     std::unique_ptr<Shuffler> _shuffler;
+
+    PartitionLoadTracker* _load_tracker;
+    std::unique_ptr<HeavyKeyDetector> _heavy_key_detector;
+    std::vector<uint32_t> _light_partitions;
+    size_t _next_light_partition = 0;
 };
 
 // Random shuffle row-by-row for each chunk of source.
@@ -174,11 +255,13 @@ protected:
 };
 
 // Exchange the local data for shuffle
+// If spread_heavy_keys is true and config::enable_local_shuffle_spread_heavy_keys is on, the rows of heavy keys
+// are spread across the light source drivers, see ShufflePartitioner.
 class PartitionExchanger final : public LocalExchanger {
 public:
     PartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                        LocalExchangeSourceOperatorFactory* source, const TPartitionType::type part_type,
-                       std::vector<ExprContext*> _partition_expr_ctxs);
+                       std::vector<ExprContext*> _partition_expr_ctxs, bool spread_heavy_keys = false);
 
     ~PartitionExchanger() override = default;
 
@@ -196,6 +279,8 @@ private:
     TPartitionType::type _part_type;
     std::vector<ExprContext*> _partition_exprs;
     std::vector<std::unique_ptr<ShufflePartitioner>> _partitioners;
+    // Only set when the rows of heavy keys are spread.
+    std::unique_ptr<PartitionLoadTracker> _load_tracker;
 };
 
 // The input stream is already ordered by partition columns.
@@ -107,6 +107,12 @@ public:
 
     bool is_finished() const override;
 
+    // The number of shuffled rows waiting in the queue.
+    size_t num_buffered_rows() const {
+        std::lock_guard<std::mutex> l(_chunk_lock);
+        return _partition_rows_num;
+    }
+
     Status set_finished(RuntimeState* state) override;
     [[nodiscard]] Status set_finishing(RuntimeState* state) override {
         std::lock_guard<std::mutex> l(_chunk_lock);
@@ -134,6 +134,10 @@ public:
     const PredicateTreeParams& pred_tree_params() const { return _pred_tree_params; }
     void set_pred_tree_params(PredicateTreeParams&& params) { _pred_tree_params = std::move(params); }
 
+    // The NUMA node that the drivers and scan tasks of this fragment instance run on, -1 means any node.
+    int numa_node() const { return _numa_node; }
+    void set_numa_node(int numa_node) { _numa_node = numa_node; }
+
     size_t next_driver_id() { return _next_driver_id++; }
 
     void set_workgroup(workgroup::WorkGroupPtr wg) { _workgroup = std::move(wg); }
@@ -221,6 +225,8 @@ private:
 
     PredicateTreeParams _pred_tree_params;
 
+    int _numa_node = -1;
+
     size_t _expired_log_count = 0;
 
     std::atomic<int64_t> _last_report_exec_state_ns = MonotonicNanos();
@@ -44,6 +44,7 @@
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/stream_load/transaction_mgr.h"
 #include "util/debug/query_trace.h"
+#include "util/numa_util.h"
 #include "util/runtime_profile.h"
 #include "util/time.h"
 #include "util/uid_util.h"
@@ -165,6 +166,10 @@ Status FragmentExecutor::_prepare_fragment_ctx(const UnifiedExecPlanFragmentPara
         _fragment_ctx->set_pred_tree_params({tpred_tree_params.enable_or, tpred_tree_params.enable_show_in_profile});
     }
 
+    if (NumaUtil::is_numa_aware_scheduling_enabled()) {
+        _fragment_ctx->set_numa_node(NumaUtil::next_node());
+    }
+
     return Status::OK();
 }
 
@@ -796,6 +801,9 @@ Status FragmentExecutor::execute(ExecEnv* exec_env) {
     auto* prepare_instance_timer = ADD_TIMER(profile, "FragmentInstancePrepareTime");
     auto* prepare_driver_timer =
             ADD_CHILD_TIMER_THESHOLD(profile, "prepare-pipeline-driver", "FragmentInstancePrepareTime", 10_ms);
+    if (_fragment_ctx->numa_node() >= 0) {
+        profile->add_info_string("NumaNode", std::to_string(_fragment_ctx->numa_node()));
+    }
 
     {
         SCOPED_TIMER(prepare_instance_timer);
@@ -194,7 +194,7 @@ OpFactories PipelineBuilderContext::maybe_interpolate_local_shuffle_exchange(
 
 OpFactories PipelineBuilderContext::maybe_interpolate_local_shuffle_exchange(
         RuntimeState* state, int32_t plan_node_id, OpFactories& pred_operators,
-        const PartitionExprsGenerator& self_partition_exprs_generator) {
+        const PartitionExprsGenerator& self_partition_exprs_generator, bool spread_heavy_keys) {
     auto* source_op = source_operator(pred_operators);
     if (!source_op->could_local_shuffle()) {
         return pred_operators;
@@ -202,16 +202,19 @@ OpFactories PipelineBuilderContext::maybe_interpolate_local_shuffle_exchange(
 
     if (!source_op->partition_exprs().empty()) {
         return _do_maybe_interpolate_local_shuffle_exchange(state, plan_node_id, pred_operators,
-                                                            source_op->partition_exprs(), source_op->partition_type());
+                                                            source_op->partition_exprs(), source_op->partition_type(),
+                                                            spread_heavy_keys);
     }
 
     return _do_maybe_interpolate_local_shuffle_exchange(state, plan_node_id, pred_operators,
-                                                        self_partition_exprs_generator(), source_op->partition_type());
+                                                        self_partition_exprs_generator(), source_op->partition_type(),
+                                                        spread_heavy_keys);
 }
 
 OpFactories PipelineBuilderContext::_do_maybe_interpolate_local_shuffle_exchange(
         RuntimeState* state, int32_t plan_node_id, OpFactories& pred_operators,
-        const std::vector<ExprContext*>& partition_expr_ctxs, const TPartitionType::type part_type) {
+        const std::vector<ExprContext*>& partition_expr_ctxs, const TPartitionType::type part_type,
+        bool spread_heavy_keys) {
     DCHECK(!pred_operators.empty() && pred_operators[0]->is_source());
 
     // interpolate grouped exchange if needed
@@ -237,8 +240,8 @@ OpFactories PipelineBuilderContext::_do_maybe_interpolate_local_shuffle_exchange
     local_shuffle_source->set_could_local_shuffle(pred_source_op->partition_exprs().empty());
     local_shuffle_source->set_degree_of_parallelism(shuffle_partitions_num);
 
-    auto local_shuffle =
-            std::make_shared<PartitionExchanger>(mem_mgr, local_shuffle_source.get(), part_type, partition_expr_ctxs);
+    auto local_shuffle = std::make_shared<PartitionExchanger>(mem_mgr, local_shuffle_source.get(), part_type,
+                                                              partition_expr_ctxs, spread_heavy_keys);
     auto local_shuffle_sink =
             std::make_shared<LocalExchangeSinkOperatorFactory>(next_operator_id(), plan_node_id, local_shuffle);
     pred_operators.emplace_back(std::move(local_shuffle_sink));
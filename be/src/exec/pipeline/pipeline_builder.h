@@ -99,9 +99,11 @@ public:
                                                          OpFactories& pred_operators,
                                                          const std::vector<ExprContext*>& self_partition_exprs);
     using PartitionExprsGenerator = std::function<std::vector<ExprContext*>()>;
+    // If spread_heavy_keys is true, the rows of one key may be sent to different drivers, see PartitionExchanger.
     OpFactories maybe_interpolate_local_shuffle_exchange(RuntimeState* state, int32_t plan_node_id,
                                                          OpFactories& pred_operators,
-                                                         const PartitionExprsGenerator& self_partition_exprs_generator);
+                                                         const PartitionExprsGenerator& self_partition_exprs_generator,
+                                                         bool spread_heavy_keys = false);
 
     // The intput data is already ordered by partition_exprs. Then we can use a simply approach to split them into different channels
     // as long as the data of the same partition_exprs are in the same channel.
@@ -186,7 +188,8 @@ private:
     OpFactories _do_maybe_interpolate_local_shuffle_exchange(
             RuntimeState* state, int32_t plan_node_id, OpFactories& pred_operators,
             const std::vector<ExprContext*>& partition_expr_ctxs,
-            const TPartitionType::type part_type = TPartitionType::type::HASH_PARTITIONED);
+            const TPartitionType::type part_type = TPartitionType::type::HASH_PARTITIONED,
+            bool spread_heavy_keys = false);
 
     static constexpr int kLocalExchangeBufferChunks = 8;
 
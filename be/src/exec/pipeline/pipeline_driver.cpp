@@ -99,6 +99,9 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
 
     _peak_driver_queue_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakDriverQueueSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
+    if (_fragment_ctx->numa_node() >= 0) {
+        _numa_remote_loads_counter = ADD_COUNTER(_runtime_profile, "NumaRemoteLoads", TUnit::UNIT);
+    }
 
     DCHECK(_state == DriverState::NOT_READY);
 
@@ -223,6 +226,12 @@ void PipelineDriver::update_peak_driver_queue_size_counter(size_t new_value) {
     }
 }
 
+void PipelineDriver::update_numa_remote_loads_counter(int64_t delta) {
+    if (_numa_remote_loads_counter != nullptr) {
+        COUNTER_UPDATE(_numa_remote_loads_counter, delta);
+    }
+}
+
 StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int worker_id) {
     COUNTER_UPDATE(_schedule_counter, 1);
     SCOPED_TIMER(_active_timer);
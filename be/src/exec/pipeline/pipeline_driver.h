@@ -291,6 +291,8 @@ public:
     }
     RuntimeProfile* runtime_profile() { return _runtime_profile.get(); }
     void update_peak_driver_queue_size_counter(size_t new_value);
+    // Only available when NUMA aware scheduling is enabled.
+    void update_numa_remote_loads_counter(int64_t delta);
     // drivers that waits for runtime filters' readiness must be marked PRECONDITION_NOT_READY and put into
     // PipelineDriverPoller.
     void mark_precondition_not_ready();
@@ -558,6 +560,7 @@ protected:
     MonotonicStopWatch* _pending_finish_timer_sw = nullptr;
 
     RuntimeProfile::HighWaterMarkCounter* _peak_driver_queue_size_counter = nullptr;
+    RuntimeProfile::Counter* _numa_remote_loads_counter = nullptr;
 };
 
 } // namespace pipeline
@@ -23,6 +23,7 @@
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
+#include "util/numa_util.h"
 #include "util/stack_util.h"
 #include "util/starrocks_metrics.h"
 
@@ -77,6 +78,19 @@ void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
     std::queue<DriverRawPtr> local_driver_queue;
+
+    // Partition the worker threads evenly among the NUMA nodes. The driver queue prefers the drivers
+    // of the fragment instances assigned to the node of the taking thread.
+    std::unique_ptr<NumaRemoteAccessCounter> numa_remote_access_counter;
+    if (NumaUtil::is_numa_aware_scheduling_enabled()) {
+        if (Status status = NumaUtil::bind_current_thread(worker_id % NumaUtil::num_nodes()); !status.ok()) {
+            LOG(WARNING) << "[Driver] Fail to bind worker " << worker_id << " to NUMA node, status=" << status;
+        }
+        numa_remote_access_counter = std::make_unique<NumaRemoteAccessCounter>();
+        if (!numa_remote_access_counter->valid()) {
+            numa_remote_access_counter.reset();
+        }
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -146,6 +160,7 @@ void GlobalDriverExecutor::_worker_thread() {
 
             StatusOr<DriverState> maybe_state;
             int64_t start_time = driver->get_active_time();
+            int64_t start_remote_loads = numa_remote_access_counter ? numa_remote_access_counter->read() : 0;
 #ifdef NDEBUG
             TRY_CATCH_ALL(maybe_state, driver->process(runtime_state, worker_id));
 #else
@@ -158,6 +173,9 @@ void GlobalDriverExecutor::_worker_thread() {
             this->_driver_queue->update_statistics(driver);
             int64_t end_time = driver->get_active_time();
             _driver_execution_ns += end_time - start_time;
+            if (numa_remote_access_counter) {
+                driver->update_numa_remote_loads_counter(numa_remote_access_counter->read() - start_remote_loads);
+            }
 
             // Check big query
             if (!driver->is_query_never_expired() && status.ok() && driver->workgroup()) {
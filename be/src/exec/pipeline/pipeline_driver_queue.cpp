@@ -17,6 +17,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/numa_util.h"
 
 namespace starrocks::pipeline {
 
@@ -163,11 +164,29 @@ int QuerySharedDriverQueue::_compute_driver_level(const DriverRawPtr driver) con
     return QUEUE_SIZE - 1;
 }
 
+SubQuerySharedDriverQueue::SubQuerySharedDriverQueue() {
+    if (NumaUtil::is_numa_aware_scheduling_enabled()) {
+        numa_node_queues.resize(NumaUtil::num_nodes());
+    }
+}
+
+std::deque<DriverRawPtr>& SubQuerySharedDriverQueue::_queue_of(const DriverRawPtr driver) {
+    if (numa_node_queues.empty() || driver->fragment_ctx() == nullptr) {
+        return queue;
+    }
+    const int node = driver->fragment_ctx()->numa_node();
+    if (node >= 0 && node < numa_node_queues.size()) {
+        return numa_node_queues[node];
+    }
+    return queue;
+}
+
 void SubQuerySharedDriverQueue::put(const DriverRawPtr driver) {
+    auto& q = _queue_of(driver);
     if (driver->driver_state() == DriverState::CANCELED) {
-        queue.emplace_front(driver);
+        q.emplace_front(driver);
     } else {
-        queue.emplace_back(driver);
+        q.emplace_back(driver);
     }
     num_drivers++;
 }
@@ -179,6 +198,21 @@ void SubQuerySharedDriverQueue::cancel(const DriverRawPtr driver) {
     }
 }
 
+DriverRawPtr SubQuerySharedDriverQueue::_take_from(std::deque<DriverRawPtr>& q) {
+    while (!q.empty()) {
+        DriverRawPtr driver = q.front();
+        q.pop_front();
+        auto iter = cancelled_set.find(driver);
+        if (iter != cancelled_set.end()) {
+            cancelled_set.erase(iter);
+        } else {
+            --num_drivers;
+            return driver;
+        }
+    }
+    return nullptr;
+}
+
 DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
     DCHECK(!empty());
     DCHECK(!block);
@@ -190,14 +224,25 @@ DriverRawPtr SubQuerySharedDriverQueue::take(const bool block) {
         return driver;
     }
 
-    while (!queue.empty()) {
-        DriverRawPtr driver = queue.front();
-        queue.pop_front();
-        auto iter = cancelled_set.find(driver);
-        if (iter != cancelled_set.end()) {
-            cancelled_set.erase(iter);
-        } else {
-            --num_drivers;
+    if (numa_node_queues.empty()) {
+        return _take_from(queue);
+    }
+
+    const int num_nodes = numa_node_queues.size();
+    const int local_node = NumaUtil::current_thread_node();
+    if (local_node >= 0 && local_node < num_nodes) {
+        if (DriverRawPtr driver = _take_from(numa_node_queues[local_node]); driver != nullptr) {
+            return driver;
+        }
+    }
+    if (DriverRawPtr driver = _take_from(queue); driver != nullptr) {
+        return driver;
+    }
+    // Steal from the other nodes, starting from the next one so that the victims are spread.
+    const int start = std::max(local_node, 0);
+    for (int i = 1; i <= num_nodes; ++i) {
+        const int node = (start + i) % num_nodes;
+        if (DriverRawPtr driver = _take_from(numa_node_queues[node]); driver != nullptr) {
             return driver;
         }
     }
@@ -68,8 +68,14 @@ public:
 // Otherwise, we take it from `queue`.
 // It should be noted that the driver in `queue` may already be taken from `pending_cancel_queue`,
 // we should ignore such drivers and try to get the next one.
+//
+// With NUMA aware scheduling, the drivers of a fragment instance assigned to a node are stored in
+// `numa_node_queues[node]` instead of `queue`. A thread bound to a node takes the drivers of its node first,
+// then the unassigned ones, and steals the drivers of the other nodes at last, so no thread stays idle.
 class SubQuerySharedDriverQueue {
 public:
+    SubQuerySharedDriverQueue();
+
     void update_accu_time(const DriverRawPtr driver) {
         _accu_consume_time.fetch_add(driver->driver_acct().get_last_time_spent());
     }
@@ -84,6 +90,7 @@ public:
     inline size_t size() const { return num_drivers; }
 
     std::deque<DriverRawPtr> queue;
+    std::vector<std::deque<DriverRawPtr>> numa_node_queues;
     std::queue<DriverRawPtr> pending_cancel_queue;
     std::unordered_set<DriverRawPtr> cancelled_set;
     size_t num_drivers = 0;
@@ -92,6 +99,9 @@ public:
     double factor_for_normal = 0;
 
 private:
+    std::deque<DriverRawPtr>& _queue_of(const DriverRawPtr driver);
+    DriverRawPtr _take_from(std::deque<DriverRawPtr>& q);
+
     std::atomic<int64_t> _accu_consume_time = 0;
 };
 
@@ -62,6 +62,7 @@ OlapChunkSource::~OlapChunkSource() {
 void OlapChunkSource::close(RuntimeState* state) {
     if (_reader) {
         _update_counter();
+        _tablet->update_read_stats(_reader->stats());
     }
     if (_prj_iter) {
         _prj_iter->close();
@@ -59,6 +59,7 @@ SchemaScanner::ColumnDesc SchemaBeTabletsScanner::_s_columns[] = {
         {"INDEX_DISK", TYPE_BIGINT, sizeof(int64_t), false},
         {"MEDIUM_TYPE", TYPE_VARCHAR, sizeof(StringValue), false},
         {"NUM_SEGMENT", TYPE_BIGINT, sizeof(int64_t), false},
+        {"READ_AMP_SCORE", TYPE_DOUBLE, sizeof(double), false},
 };
 
 SchemaBeTabletsScanner::SchemaBeTabletsScanner()
@@ -155,7 +156,7 @@ Status SchemaBeTabletsScanner::fill_chunk(ChunkPtr* chunk) {
     for (; _cur_idx < end; _cur_idx++) {
         auto& info = _infos[_cur_idx];
         for (const auto& [slot_id, index] : slot_id_to_index_map) {
-            if (slot_id < 1 || slot_id > 20) {
+            if (slot_id < 1 || slot_id > 21) {
                 return Status::InternalError(strings::Substitute("invalid slot id:$0", slot_id));
             }
             ColumnPtr column = (*chunk)->get_column_by_slot_id(slot_id);
@@ -262,6 +263,12 @@ Status SchemaBeTabletsScanner::fill_chunk(ChunkPtr* chunk) {
             case 20: {
                 // NUM_SEGMENT
                 fill_column_with_slot<TYPE_BIGINT>(column.get(), (void*)&info.num_segment);
+                break;
+            }
+            case 21: {
+                // READ_AMP_SCORE
+                fill_column_with_slot<TYPE_DOUBLE>(column.get(), (void*)&info.read_amp_score);
+                break;
             }
             default:
                 break;
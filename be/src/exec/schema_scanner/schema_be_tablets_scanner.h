@@ -42,6 +42,7 @@ struct TabletBasicInfo {
     int64_t schema_hash{0};
     int64_t index_disk_usage{0};
     TStorageMedium::type medium_type;
+    double read_amp_score{0};
 };
 
 class SchemaBeTabletsScanner : public SchemaScanner {
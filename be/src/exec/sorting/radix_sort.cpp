@@ -0,0 +1,192 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/sorting/radix_sort.h"
+
+#include <array>
+#include <type_traits>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "column/type_traits.h"
+#include "exec/sorting/sorting.h"
+#include "fmt/format.h"
+#include "types/date_value.h"
+#include "types/timestamp_value.h"
+
+namespace starrocks {
+
+template <typename UKey>
+struct RadixItem {
+    UKey key;
+    uint32_t index_in_chunk;
+};
+
+template <LogicalType LT>
+using RadixKeyType = std::conditional_t<sizeof(RunTimeCppType<LT>) == 4, uint32_t, uint64_t>;
+
+// Encode the value into an unsigned key, whose unsigned order is the same as the order of value
+template <LogicalType LT>
+static inline RadixKeyType<LT> radix_encode(const RunTimeCppType<LT>& value) {
+    using UKey = RadixKeyType<LT>;
+    constexpr UKey kSignBit = UKey(1) << (sizeof(UKey) * 8 - 1);
+    if constexpr (LT == TYPE_DATE) {
+        return static_cast<UKey>(value.julian()) ^ kSignBit;
+    } else if constexpr (LT == TYPE_DATETIME) {
+        return static_cast<UKey>(value.timestamp()) ^ kSignBit;
+    } else {
+        return static_cast<UKey>(value) ^ kSignBit;
+    }
+}
+
+// Sort items by key with LSD radix sort, 8 bits per pass. The sort is stable.
+template <typename UKey>
+static Status radix_sort_items(const std::atomic<bool>& cancel, std::vector<RadixItem<UKey>>& items) {
+    constexpr int kNumDigits = sizeof(UKey);
+    constexpr size_t kNumBuckets = 256;
+    const size_t num_items = items.size();
+    if (num_items <= 1) {
+        return Status::OK();
+    }
+
+    // Build the histograms of all digits in one pass over the data
+    std::array<std::array<uint32_t, kNumBuckets>, kNumDigits> histograms{};
+    for (const auto& item : items) {
+        for (int digit = 0; digit < kNumDigits; digit++) {
+            histograms[digit][(item.key >> (digit * 8)) & 0xFF]++;
+        }
+    }
+
+    std::vector<RadixItem<UKey>> buffer(num_items);
+    RadixItem<UKey>* src = items.data();
+    RadixItem<UKey>* dst = buffer.data();
+    for (int digit = 0; digit < kNumDigits; digit++) {
+        const int shift = digit * 8;
+        const auto& histogram = histograms[digit];
+        // All keys share the same value on this digit, this pass would not change the order
+        if (histogram[(src[0].key >> shift) & 0xFF] == num_items) {
+            continue;
+        }
+        if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+            return Status::Cancelled("Sort cancelled");
+        }
+
+        std::array<uint32_t, kNumBuckets> offsets;
+        uint32_t offset = 0;
+        for (size_t bucket = 0; bucket < kNumBuckets; bucket++) {
+            offsets[bucket] = offset;
+            offset += histogram[bucket];
+        }
+        for (size_t i = 0; i < num_items; i++) {
+            dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != items.data()) {
+        items.swap(buffer);
+    }
+    return Status::OK();
+}
+
+template <LogicalType LT>
+static Status radix_sort_column_impl(const std::atomic<bool>& cancel, const Column* data_column,
+                                     const NullData* null_data, const SortDesc& sort_desc, Permutation* permutation) {
+    using UKey = RadixKeyType<LT>;
+    using ItemType = RadixItem<UKey>;
+
+    const auto& data = down_cast<const RunTimeColumnType<LT>*>(data_column)->get_data();
+    const size_t num_rows = data_column->size();
+    // Inverting all bits of the encoded key reverses the order, which is used by descending order
+    const UKey flip_mask = sort_desc.asc_order() ? UKey(0) : ~UKey(0);
+
+    std::vector<ItemType> items;
+    std::vector<uint32_t> null_rows;
+    items.reserve(num_rows);
+    if (null_data != nullptr) {
+        for (uint32_t i = 0; i < num_rows; i++) {
+            if ((*null_data)[i]) {
+                null_rows.push_back(i);
+            } else {
+                items.push_back(ItemType{radix_encode<LT>(data[i]) ^ flip_mask, i});
+            }
+        }
+    } else {
+        for (uint32_t i = 0; i < num_rows; i++) {
+            items.push_back(ItemType{radix_encode<LT>(data[i]) ^ flip_mask, i});
+        }
+    }
+
+    RETURN_IF_ERROR(radix_sort_items<UKey>(cancel, items));
+
+    permutation->resize(num_rows);
+    size_t pos = 0;
+    auto append_null_rows = [&]() {
+        for (uint32_t row : null_rows) {
+            (*permutation)[pos++] = PermutationItem(0, row);
+        }
+    };
+    if (sort_desc.is_null_first()) {
+        append_null_rows();
+    }
+    for (const auto& item : items) {
+        (*permutation)[pos++] = PermutationItem(0, item.index_in_chunk);
+    }
+    if (!sort_desc.is_null_first()) {
+        append_null_rows();
+    }
+    DCHECK_EQ(pos, num_rows);
+    return Status::OK();
+}
+
+bool radix_sort_supported(LogicalType type) {
+    switch (type) {
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Status radix_sort_column(const std::atomic<bool>& cancel, const ColumnPtr& column, LogicalType type,
+                         const SortDesc& sort_desc, Permutation* permutation) {
+    DCHECK(!column->is_constant());
+    const Column* data_column = column.get();
+    const NullData* null_data = nullptr;
+    if (column->is_nullable()) {
+        const auto* nullable_column = down_cast<const NullableColumn*>(column.get());
+        data_column = nullable_column->data_column().get();
+        if (nullable_column->has_null()) {
+            null_data = &nullable_column->immutable_null_column_data();
+        }
+    }
+
+    switch (type) {
+    case TYPE_INT:
+        return radix_sort_column_impl<TYPE_INT>(cancel, data_column, null_data, sort_desc, permutation);
+    case TYPE_BIGINT:
+        return radix_sort_column_impl<TYPE_BIGINT>(cancel, data_column, null_data, sort_desc, permutation);
+    case TYPE_DATE:
+        return radix_sort_column_impl<TYPE_DATE>(cancel, data_column, null_data, sort_desc, permutation);
+    case TYPE_DATETIME:
+        return radix_sort_column_impl<TYPE_DATETIME>(cancel, data_column, null_data, sort_desc, permutation);
+    default:
+        return Status::NotSupported(fmt::format("radix sort does not support type {}", type_to_string(type)));
+    }
+}
+
+} // namespace starrocks
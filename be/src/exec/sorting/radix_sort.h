@@ -0,0 +1,45 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "exec/sorting/sort_permute.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+
+struct SortDesc;
+
+// LSD radix sort for a single fixed-width sort key.
+//
+// Each row is converted into a (unsigned key, index) pair, where the key is an order-preserving
+// encoding of the value: the sign bit is flipped for signed integers and all bits are inverted
+// for descending order. The pairs are then sorted byte by byte from the least significant digit,
+// so the cost is O(n * sizeof(key)) instead of O(n * log(n)) comparisons.
+// Digits shared by all keys (e.g. the high bytes of a BIGINT holding small values) are skipped.
+// NULLs are never encoded, they are placed in front of or behind all values according to `sort_desc`.
+
+// Whether the logical type could be sorted by `radix_sort_column`
+bool radix_sort_supported(LogicalType type);
+
+// Sort a single column with radix sort, output the order in permutation array.
+// The column must be a non-const column of a type accepted by `radix_sort_supported`, nullable or not.
+Status radix_sort_column(const std::atomic<bool>& cancel, const ColumnPtr& column, LogicalType type,
+                         const SortDesc& sort_desc, Permutation* permutation);
+
+} // namespace starrocks
@@ -17,6 +17,7 @@
 
 #include "column/array_column.h"
 #include "column/binary_column.h"
+#include "column/binary_view.h"
 #include "column/chunk.h"
 #include "column/column.h"
 #include "column/column_helper.h"
@@ -101,12 +102,14 @@ public:
     template <typename T>
     Status do_visit(const BinaryColumnBase<T>& column) {
         DCHECK_GE(column.size(), _permutation.size());
-        using ItemType = InlinePermuteItem<Slice>;
+        // Inline the views instead of the slices, so that most comparisons are decided by the inlined
+        // size and prefix without dereferencing the string data.
+        using ItemType = InlinePermuteItem<BinaryView>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice>(_permutation, column.get_proxy_data());
+        auto inlined = create_inline_permutation<BinaryView>(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(
                 sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range, _build_tie));
         restore_inline_permutation(inlined, _permutation);
@@ -212,7 +215,7 @@ public:
         using ColumnType = BinaryColumnBase<T>;
 
         if (_need_inline_value()) {
-            using ItemType = CompactChunkItem<Slice>;
+            using ItemType = CompactChunkItem<BinaryView>;
             using Container = typename BinaryColumnBase<T>::BinaryDataProxyContainer;
 
             auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
@@ -225,7 +228,7 @@ public:
                 containers.push_back(&real->get_proxy_data());
             }
 
-            auto inlined = _create_inlined_permutation<Slice>(containers);
+            auto inlined = _create_inlined_permutation<BinaryView>(containers);
             RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range,
                                                 _build_tie, _limit, &_pruned_limit));
             _restore_inlined_permutation(inlined);
@@ -15,6 +15,7 @@
 #include "exec/workgroup/scan_executor.h"
 
 #include "exec/workgroup/scan_task_queue.h"
+#include "util/numa_util.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks::workgroup {
@@ -68,6 +69,21 @@ void ScanExecutor::worker_thread() {
         }
         auto& task = maybe_task.value();
 
+        // The scan threads are shared by all the nodes, so the affinity follows the task, which keeps
+        // the chunks read by the task local to the drivers consuming them. A task without a node must not
+        // inherit the binding of the previous task of the thread.
+        if (task.numa_node >= 0) {
+            if (Status status = NumaUtil::bind_current_thread(task.numa_node); !status.ok()) {
+                LOG(WARNING) << "Fail to bind scan thread to NUMA node " << task.numa_node << ", status=" << status;
+                task.numa_node = -1;
+            }
+        }
+        if (task.numa_node < 0) {
+            if (Status status = NumaUtil::unbind_current_thread(); !status.ok()) {
+                LOG(WARNING) << "Fail to unbind scan thread from NUMA node, status=" << status;
+            }
+        }
+
         int64_t time_spent_ns = 0;
         {
             SCOPED_RAW_TIMER(&time_spent_ns);
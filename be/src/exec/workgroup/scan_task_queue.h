@@ -110,6 +110,8 @@ public:
     int priority = 0;
     std::shared_ptr<ScanTaskGroup> task_group = nullptr;
     RuntimeProfile::HighWaterMarkCounter* peak_scan_task_queue_size_counter = nullptr;
+    // The NUMA node of the fragment instance which submits the task, -1 means any node.
+    int numa_node = -1;
 };
 
 /// There are three types of ScanTaskQueue:
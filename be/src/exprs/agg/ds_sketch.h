@@ -0,0 +1,240 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "column/binary_column.h"
+#include "column/type_traits.h"
+#include "column/vectorized_fwd.h"
+#include "exprs/agg/aggregate.h"
+#include "gutil/casts.h"
+#include "types/ds_sketches.h"
+
+namespace starrocks {
+
+// The serialized sketch is both the intermediate and the final result of the sketch aggregates below,
+// so it can be stored in a VARBINARY column and merged again later by the *_union aggregates.
+inline void append_serialized_sketch(Column* to, const std::vector<uint8_t>& bytes) {
+    DCHECK(to->is_binary());
+    down_cast<BinaryColumn*>(to)->append(Slice(bytes.data(), bytes.size()));
+}
+
+/**
+ * RETURN_TYPE: TYPE_VARBINARY
+ * ARGS_TYPE: TYPE_DOUBLE
+ * SERIALIZED_TYPE: TYPE_VARBINARY
+ */
+class DsKllSketchAggregateFunction final
+        : public AggregateFunctionBatchHelper<DataSketchesKll, DsKllSketchAggregateFunction> {
+public:
+    void reset(FunctionContext* ctx, const Columns& args, AggDataPtr state) const override {
+        this->data(state).clear();
+    }
+
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        const auto* column = down_cast<const DoubleColumn*>(columns[0]);
+        this->data(state).update(column->get_data()[row_num]);
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const double* values = down_cast<const DoubleColumn*>(columns[0])->get_data().data();
+        auto& sketch = this->data(state);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            sketch.update(values[i]);
+        }
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        DCHECK(column->is_binary());
+        const auto* binary_column = down_cast<const BinaryColumn*>(column);
+        DataSketchesKll other(binary_column->get_slice(row_num));
+        this->data(state).merge(other);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        append_serialized_sketch(to, this->data(state).serialize());
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        const auto& values = down_cast<const DoubleColumn*>(src[0].get())->get_data();
+        auto* result = down_cast<BinaryColumn*>((*dst).get());
+        result->reserve(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            DataSketchesKll kll;
+            kll.update(values[i]);
+            append_serialized_sketch(result, kll.serialize());
+        }
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        serialize_to_column(ctx, state, to);
+    }
+
+    std::string get_name() const override { return "ds_kll_sketch"; }
+};
+
+/**
+ * RETURN_TYPE: TYPE_VARBINARY
+ * ARGS_TYPE: TYPE_VARBINARY (serialized KLL sketch)
+ * SERIALIZED_TYPE: TYPE_VARBINARY
+ */
+class DsKllSketchUnionAggregateFunction final
+        : public AggregateFunctionBatchHelper<DataSketchesKll, DsKllSketchUnionAggregateFunction> {
+public:
+    void reset(FunctionContext* ctx, const Columns& args, AggDataPtr state) const override {
+        this->data(state).clear();
+    }
+
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        merge(ctx, columns[0], state, row_num);
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        DCHECK(column->is_binary());
+        const auto* binary_column = down_cast<const BinaryColumn*>(column);
+        DataSketchesKll other(binary_column->get_slice(row_num));
+        this->data(state).merge(other);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        append_serialized_sketch(to, this->data(state).serialize());
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        *dst = src[0];
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        serialize_to_column(ctx, state, to);
+    }
+
+    std::string get_name() const override { return "ds_kll_sketch_union"; }
+};
+
+/**
+ * RETURN_TYPE: TYPE_VARBINARY
+ * ARGS_TYPE: ALL TYPE
+ * SERIALIZED_TYPE: TYPE_VARBINARY
+ */
+template <LogicalType LT, typename T = RunTimeCppType<LT>>
+class DsThetaSketchAggregateFunction final
+        : public AggregateFunctionBatchHelper<DataSketchesTheta, DsThetaSketchAggregateFunction<LT, T>> {
+public:
+    using ColumnType = RunTimeColumnType<LT>;
+
+    void reset(FunctionContext* ctx, const Columns& args, AggDataPtr state) const override {
+        this->data(state).clear();
+    }
+
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        update_row(this->data(state), down_cast<const ColumnType*>(columns[0]), row_num);
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* column = down_cast<const ColumnType*>(columns[0]);
+        auto& sketch = this->data(state);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            update_row(sketch, column, i);
+        }
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        DCHECK(column->is_binary());
+        const auto* binary_column = down_cast<const BinaryColumn*>(column);
+        DataSketchesTheta other(binary_column->get_slice(row_num));
+        this->data(state).merge(other);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        append_serialized_sketch(to, this->data(state).serialize());
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        const auto* column = down_cast<const ColumnType*>(src[0].get());
+        auto* result = down_cast<BinaryColumn*>((*dst).get());
+        result->reserve(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            DataSketchesTheta theta;
+            update_row(theta, column, i);
+            append_serialized_sketch(result, theta.serialize());
+        }
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        serialize_to_column(ctx, state, to);
+    }
+
+    std::string get_name() const override { return "ds_theta_sketch"; }
+
+private:
+    static void update_row(DataSketchesTheta& sketch, const ColumnType* column, size_t row_num) {
+        if constexpr (lt_is_string<LT>) {
+            Slice s = column->get_slice(row_num);
+            sketch.update(s.data, s.size);
+        } else {
+            const auto& v = column->get_data()[row_num];
+            sketch.update(&v, sizeof(v));
+        }
+    }
+};
+
+/**
+ * RETURN_TYPE: TYPE_VARBINARY
+ * ARGS_TYPE: TYPE_VARBINARY (serialized Theta sketch)
+ * SERIALIZED_TYPE: TYPE_VARBINARY
+ */
+class DsThetaSketchUnionAggregateFunction final
+        : public AggregateFunctionBatchHelper<DataSketchesTheta, DsThetaSketchUnionAggregateFunction> {
+public:
+    void reset(FunctionContext* ctx, const Columns& args, AggDataPtr state) const override {
+        this->data(state).clear();
+    }
+
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        merge(ctx, columns[0], state, row_num);
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        DCHECK(column->is_binary());
+        const auto* binary_column = down_cast<const BinaryColumn*>(column);
+        DataSketchesTheta other(binary_column->get_slice(row_num));
+        this->data(state).merge(other);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        append_serialized_sketch(to, this->data(state).serialize());
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        *dst = src[0];
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        serialize_to_column(ctx, state, to);
+    }
+
+    std::string get_name() const override { return "ds_theta_sketch_union"; }
+};
+
+} // namespace starrocks
@@ -71,6 +71,18 @@ AggregateFunctionPtr AggregateFactory::MakeHllUnionCountAggregateFunction() {
     return std::make_shared<HllUnionCountAggregateFunction>();
 }
 
+AggregateFunctionPtr AggregateFactory::MakeDsKllSketchAggregateFunction() {
+    return std::make_shared<DsKllSketchAggregateFunction>();
+}
+
+AggregateFunctionPtr AggregateFactory::MakeDsKllSketchUnionAggregateFunction() {
+    return std::make_shared<DsKllSketchUnionAggregateFunction>();
+}
+
+AggregateFunctionPtr AggregateFactory::MakeDsThetaSketchUnionAggregateFunction() {
+    return std::make_shared<DsThetaSketchUnionAggregateFunction>();
+}
+
 AggregateFunctionPtr AggregateFactory::MakePercentileApproxAggregateFunction() {
     return std::make_shared<PercentileApproxAggregateFunction>();
 }
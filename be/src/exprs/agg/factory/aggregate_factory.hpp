@@ -33,6 +33,7 @@
 #include "exprs/agg/count.h"
 #include "exprs/agg/covariance.h"
 #include "exprs/agg/distinct.h"
+#include "exprs/agg/ds_sketch.h"
 #include "exprs/agg/exchange_perf.h"
 #include "exprs/agg/group_concat.h"
 #include "exprs/agg/histogram.h"
@@ -188,6 +189,16 @@ public:
     template <LogicalType T>
     static AggregateFunctionPtr MakeHllRawAggregateFunction();
 
+    // DataSketches KLL/Theta functions:
+    static AggregateFunctionPtr MakeDsKllSketchAggregateFunction();
+
+    static AggregateFunctionPtr MakeDsKllSketchUnionAggregateFunction();
+
+    template <LogicalType T>
+    static AggregateFunctionPtr MakeDsThetaSketchAggregateFunction();
+
+    static AggregateFunctionPtr MakeDsThetaSketchUnionAggregateFunction();
+
     static AggregateFunctionPtr MakePercentileApproxAggregateFunction();
 
     static AggregateFunctionPtr MakePercentileUnionAggregateFunction();
@@ -394,6 +405,11 @@ AggregateFunctionPtr AggregateFactory::MakeHllRawAggregateFunction() {
     return std::make_shared<HllNdvAggregateFunction<LT, true>>();
 }
 
+template <LogicalType LT>
+AggregateFunctionPtr AggregateFactory::MakeDsThetaSketchAggregateFunction() {
+    return std::make_shared<DsThetaSketchAggregateFunction<LT>>();
+}
+
 template <LogicalType LT>
 AggregateFunctionPtr AggregateFactory::MakePercentileContAggregateFunction() {
     return std::make_shared<PercentileContAggregateFunction<LT>>();
@@ -17,6 +17,7 @@
 #include "exprs/agg/approx_top_k.h"
 #include "exprs/agg/factory/aggregate_factory.hpp"
 #include "exprs/agg/factory/aggregate_resolver.hpp"
+#include "types/ds_sketches.h"
 #include "types/hll.h"
 #include "types/logical_type.h"
 
@@ -41,6 +42,9 @@ struct HLLUnionBuilder {
 
             resolver->add_aggregate_mapping<lt, TYPE_BIGINT, DataSketchesHll>(
                     "approx_count_distinct_hll_sketch", false, AggregateFactory::MakeHllSketchAggregateFunction<lt>());
+
+            resolver->add_aggregate_mapping<lt, TYPE_VARBINARY, DataSketchesTheta>(
+                    "ds_theta_sketch", false, AggregateFactory::MakeDsThetaSketchAggregateFunction<lt>());
         }
     }
 };
@@ -68,6 +72,13 @@ void AggregateFuncResolver::register_approx() {
                                                            AggregateFactory::MakeHllUnionAggregateFunction());
     add_aggregate_mapping<TYPE_HLL, TYPE_BIGINT, HyperLogLog>("hll_union_agg", false,
                                                               AggregateFactory::MakeHllUnionCountAggregateFunction());
+
+    add_aggregate_mapping<TYPE_DOUBLE, TYPE_VARBINARY, DataSketchesKll>(
+            "ds_kll_sketch", false, AggregateFactory::MakeDsKllSketchAggregateFunction());
+    add_aggregate_mapping<TYPE_VARBINARY, TYPE_VARBINARY, DataSketchesKll>(
+            "ds_kll_sketch_union", false, AggregateFactory::MakeDsKllSketchUnionAggregateFunction());
+    add_aggregate_mapping<TYPE_VARBINARY, TYPE_VARBINARY, DataSketchesTheta>(
+            "ds_theta_sketch_union", false, AggregateFactory::MakeDsThetaSketchUnionAggregateFunction());
 }
 
 } // namespace starrocks
@@ -14,9 +14,15 @@
 
 #include "exprs/compound_predicate.h"
 
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/function_call_expr.h"
 #include "exprs/jit/ir_helper.h"
+#include "exprs/like_predicate.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -123,7 +129,52 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        // The OR-chain is analyzed before the children are prepared, so that the inner ORs of a chain evaluated
+        // by this predicate know it when they are prepared, and only the outermost OR compiles the patterns.
+        if (!_absorbed && config::like_multi_pattern_min_predicates > 0) {
+            _absorb_pattern_match_chain();
+        }
+        return Expr::prepare(state, context);
+    }
+
+    Status open(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) override {
+        RETURN_IF_ERROR(Expr::open(state, context, scope));
+        if (scope != FunctionContext::FRAGMENT_LOCAL || _pattern_leaves.empty()) {
+            return Status::OK();
+        }
+
+        std::vector<std::string> regex_patterns;
+        for (Expr* leaf : _pattern_leaves) {
+            ASSIGN_OR_RETURN(auto pattern_column, leaf->get_child(1)->evaluate_checked(context, nullptr));
+            if (pattern_column->only_null()) {
+                return Status::OK();
+            }
+            Slice pattern = ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern_column);
+            if (_is_like(leaf)) {
+                regex_patterns.emplace_back(LikePredicate::convert_like_pattern<true>(pattern, '\\'));
+            } else {
+                regex_patterns.emplace_back(pattern.to_string());
+            }
+        }
+
+        auto multi_pattern_state = LikePredicate::compile_multi_patterns(regex_patterns);
+        if (!multi_pattern_state.ok()) {
+            // Some patterns are not supported by hyperscan, evaluate the predicates one by one
+            LOG(INFO) << "fallback to evaluate LIKE/REGEXP predicates separately: " << multi_pattern_state.status();
+            return Status::OK();
+        }
+        _multi_pattern_state = std::move(multi_pattern_state.value());
+        return Status::OK();
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_multi_pattern_state != nullptr) {
+            ASSIGN_OR_RETURN(auto value, _pattern_leaves[0]->get_child(0)->evaluate_checked(context, ptr));
+            return LikePredicate::multi_pattern_match(_multi_pattern_state.get(), value);
+        }
+
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -178,9 +229,75 @@ public:
         out << "VectorizedOrCompoundPredicate ("
             << "lhs=" << _children[0]->type().debug_string() << ", rhs=" << _children[1]->type().debug_string()
             << ", result=" << this->type().debug_string() << ", lhs_is_constant=" << _children[0]->is_constant()
-            << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
+            << ", rhs_is_constant=" << _children[1]->is_constant()
+            << ", multi_pattern=" << (_multi_pattern_state != nullptr) << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    static bool _is_or_predicate(const Expr* expr) {
+        return expr->node_type() == TExprNodeType::COMPOUND_PRED && expr->op() == TExprOpcode::COMPOUND_OR;
+    }
+
+    // If the OR-chain rooted at this predicate consists of LIKE/REGEXP predicates with constant patterns on the same
+    // column, evaluate them here and mark the inner ORs as absorbed.
+    void _absorb_pattern_match_chain() {
+        std::vector<Expr*> leaves;
+        std::vector<VectorizedOrCompoundPredicate*> inner_ors;
+        _collect_or_leaves(this, &leaves, &inner_ors);
+        if (leaves.size() < static_cast<size_t>(config::like_multi_pattern_min_predicates)) {
+            return;
+        }
+
+        SlotId slot_id = -1;
+        for (Expr* leaf : leaves) {
+            if (!_is_constant_pattern_match(leaf)) {
+                return;
+            }
+            SlotId leaf_slot_id = leaf->get_child(0)->get_column_ref()->slot_id();
+            if (slot_id != -1 && slot_id != leaf_slot_id) {
+                return;
+            }
+            slot_id = leaf_slot_id;
+        }
+
+        for (auto* inner_or : inner_ors) {
+            inner_or->_absorbed = true;
+        }
+        _pattern_leaves = std::move(leaves);
+    }
+
+    static void _collect_or_leaves(Expr* expr, std::vector<Expr*>* leaves,
+                                   std::vector<VectorizedOrCompoundPredicate*>* inner_ors) {
+        for (Expr* child : expr->children()) {
+            if (_is_or_predicate(child)) {
+                inner_ors->push_back(down_cast<VectorizedOrCompoundPredicate*>(child));
+                _collect_or_leaves(child, leaves, inner_ors);
+            } else {
+                leaves->push_back(child);
+            }
+        }
+    }
+
+    static bool _is_like(const Expr* expr) { return boost::iequals(expr->fn().name.function_name, "like"); }
+
+    // LIKE(slot, 'constant') or REGEXP(slot, 'constant'), checked by the function name since the function
+    // descriptor is only resolved when the expr is prepared.
+    static bool _is_constant_pattern_match(Expr* expr) {
+        if (dynamic_cast<VectorizedFunctionCallExpr*>(expr) == nullptr || expr->get_num_children() != 2) {
+            return false;
+        }
+        if (!_is_like(expr) && !boost::iequals(expr->fn().name.function_name, "regexp")) {
+            return false;
+        }
+        return expr->get_child(0)->is_slotref() && expr->get_child(1)->is_constant();
+    }
+
+    // Set if this OR is a child of an OR-chain evaluated by multi-pattern matching
+    bool _absorbed = false;
+    // LIKE/REGEXP predicates of the OR-chain, which are evaluated together if `_multi_pattern_state` is set
+    std::vector<Expr*> _pattern_leaves;
+    std::shared_ptr<LikePredicate::MultiPatternState> _multi_pattern_state;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
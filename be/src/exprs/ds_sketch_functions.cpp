@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/ds_sketch_functions.h"
+
+#include "column/column_builder.h"
+#include "column/column_helper.h"
+#include "column/column_viewer.h"
+#include "gutil/strings/substitute.h"
+#include "types/ds_sketches.h"
+
+namespace starrocks {
+
+template <bool IsQuantile>
+static StatusOr<ColumnPtr> kll_evaluate(const char* fn_name, const Columns& columns) {
+    ColumnViewer<TYPE_VARBINARY> sketch_viewer(columns[0]);
+    ColumnViewer<TYPE_DOUBLE> value_viewer(columns[1]);
+
+    size_t size = columns[0]->size();
+    ColumnBuilder<TYPE_DOUBLE> builder(size);
+    for (size_t row = 0; row < size; ++row) {
+        if (sketch_viewer.is_null(row) || value_viewer.is_null(row)) {
+            builder.append_null();
+            continue;
+        }
+        DataSketchesKll kll;
+        if (!kll.deserialize(sketch_viewer.value(row))) {
+            return Status::InvalidArgument(strings::Substitute("$0: invalid KLL sketch at row $1", fn_name, row));
+        }
+        if (kll.is_empty()) {
+            builder.append_null();
+            continue;
+        }
+        double value = value_viewer.value(row);
+        if constexpr (IsQuantile) {
+            if (!(value >= 0 && value <= 1)) {
+                return Status::InvalidArgument(
+                        strings::Substitute("$0: rank must be between 0 and 1, but got $1", fn_name, value));
+            }
+            builder.append(kll.quantile(value));
+        } else {
+            builder.append(kll.rank(value));
+        }
+    }
+    return builder.build(ColumnHelper::is_all_const(columns));
+}
+
+StatusOr<ColumnPtr> DataSketchesFunctions::ds_kll_quantile(FunctionContext* context, const Columns& columns) {
+    return kll_evaluate<true>("ds_kll_quantile", columns);
+}
+
+StatusOr<ColumnPtr> DataSketchesFunctions::ds_kll_rank(FunctionContext* context, const Columns& columns) {
+    return kll_evaluate<false>("ds_kll_rank", columns);
+}
+
+StatusOr<ColumnPtr> DataSketchesFunctions::ds_theta_estimate(FunctionContext* context, const Columns& columns) {
+    ColumnViewer<TYPE_VARBINARY> viewer(columns[0]);
+
+    size_t size = columns[0]->size();
+    ColumnBuilder<TYPE_BIGINT> builder(size);
+    for (size_t row = 0; row < size; ++row) {
+        if (viewer.is_null(row)) {
+            builder.append_null();
+            continue;
+        }
+        DataSketchesTheta theta;
+        if (!theta.deserialize(viewer.value(row))) {
+            return Status::InvalidArgument(strings::Substitute("ds_theta_estimate: invalid Theta sketch at row $0", row));
+        }
+        builder.append(theta.estimate_cardinality());
+    }
+    return builder.build(ColumnHelper::is_all_const(columns));
+}
+
+using ThetaSetOperation = bool (*)(const Slice&, const Slice&, std::string*);
+
+static StatusOr<ColumnPtr> theta_set_operation(const char* fn_name, ThetaSetOperation op, const Columns& columns) {
+    ColumnViewer<TYPE_VARBINARY> lhs_viewer(columns[0]);
+    ColumnViewer<TYPE_VARBINARY> rhs_viewer(columns[1]);
+
+    size_t size = columns[0]->size();
+    ColumnBuilder<TYPE_VARBINARY> builder(size);
+    std::string buf;
+    for (size_t row = 0; row < size; ++row) {
+        if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
+            builder.append_null();
+            continue;
+        }
+        if (!op(lhs_viewer.value(row), rhs_viewer.value(row), &buf)) {
+            return Status::InvalidArgument(strings::Substitute("$0: invalid Theta sketch at row $1", fn_name, row));
+        }
+        builder.append(Slice(buf));
+    }
+
+    ColumnPtr col = builder.build(ColumnHelper::is_all_const(columns));
+    std::string err_msg;
+    if (col->capacity_limit_reached(&err_msg)) {
+        return Status::InternalError(
+                strings::Substitute("Size of binary column generated by $0 reaches limit: $1", fn_name, err_msg));
+    }
+    return col;
+}
+
+StatusOr<ColumnPtr> DataSketchesFunctions::ds_theta_union(FunctionContext* context, const Columns& columns) {
+    return theta_set_operation("ds_theta_union", &DataSketchesTheta::union_of, columns);
+}
+
+StatusOr<ColumnPtr> DataSketchesFunctions::ds_theta_intersect(FunctionContext* context, const Columns& columns) {
+    return theta_set_operation("ds_theta_intersect", &DataSketchesTheta::intersect_of, columns);
+}
+
+StatusOr<ColumnPtr> DataSketchesFunctions::ds_theta_a_not_b(FunctionContext* context, const Columns& columns) {
+    return theta_set_operation("ds_theta_a_not_b", &DataSketchesTheta::a_not_b_of, columns);
+}
+
+} // namespace starrocks
@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "exprs/function_helper.h"
+
+namespace starrocks {
+
+// Scalar functions on the serialized sketches produced by ds_kll_sketch/ds_theta_sketch
+// and their *_union aggregates.
+class DataSketchesFunctions {
+public:
+    /**
+     * @param: [kll sketch, rank]
+     * @paramType: [BinaryColumn, DoubleColumn]
+     * @return: DoubleColumn
+     */
+    DEFINE_VECTORIZED_FN(ds_kll_quantile);
+
+    /**
+     * @param: [kll sketch, value]
+     * @paramType: [BinaryColumn, DoubleColumn]
+     * @return: DoubleColumn
+     */
+    DEFINE_VECTORIZED_FN(ds_kll_rank);
+
+    /**
+     * @param: [theta sketch]
+     * @paramType: [BinaryColumn]
+     * @return: BigIntColumn
+     */
+    DEFINE_VECTORIZED_FN(ds_theta_estimate);
+
+    /**
+     * @param: [theta sketch, theta sketch]
+     * @paramType: [BinaryColumn, BinaryColumn]
+     * @return: BinaryColumn
+     */
+    DEFINE_VECTORIZED_FN(ds_theta_union);
+
+    /**
+     * @param: [theta sketch, theta sketch]
+     * @paramType: [BinaryColumn, BinaryColumn]
+     * @return: BinaryColumn
+     */
+    DEFINE_VECTORIZED_FN(ds_theta_intersect);
+
+    /**
+     * Values of the first sketch that are not in the second one.
+     * @param: [theta sketch, theta sketch]
+     * @paramType: [BinaryColumn, BinaryColumn]
+     * @return: BinaryColumn
+     */
+    DEFINE_VECTORIZED_FN(ds_theta_a_not_b);
+};
+
+} // namespace starrocks
@@ -545,10 +545,13 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
-    std::string re_pattern;
-    re_pattern.clear();
-
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(pattern, state->escape_char);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(const Slice& pattern, char escape_char) {
+    std::string re_pattern;
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -561,7 +564,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -586,6 +589,87 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
     return re_pattern;
 }
 
+template std::string LikePredicate::convert_like_pattern<true>(const Slice& pattern, char escape_char);
+template std::string LikePredicate::convert_like_pattern<false>(const Slice& pattern, char escape_char);
+
+StatusOr<std::shared_ptr<LikePredicate::MultiPatternState>> LikePredicate::compile_multi_patterns(
+        const std::vector<std::string>& regex_patterns) {
+    DCHECK(!regex_patterns.empty());
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < regex_patterns.size(); i++) {
+        expressions.push_back(regex_patterns[i].c_str());
+        flags.push_back(HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.push_back(i);
+    }
+
+    auto state = std::make_shared<MultiPatternState>();
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), expressions.size(), HS_MODE_BLOCK, nullptr,
+                         &state->database, &compile_err) != HS_SUCCESS) {
+        std::string message = fmt::format("Invalid hyperscan expression at {}: {}", compile_err->expression,
+                                          compile_err->message);
+        hs_free_compile_error(compile_err);
+        return Status::InvalidArgument(message);
+    }
+
+    hs_error_t status;
+    if ((status = hs_alloc_scratch(state->database, &state->scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to allocate scratch space, status: {}", status));
+    }
+    return state;
+}
+
+StatusOr<ColumnPtr> LikePredicate::multi_pattern_match(const MultiPatternState* state,
+                                                       const ColumnPtr& value_column) {
+    if (value_column->only_null()) {
+        return ColumnHelper::create_const_null_column(value_column->size());
+    }
+
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(state->scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+
+    DeferOp op([&] {
+        if (scratch != nullptr) {
+            hs_error_t st;
+            if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
+                LOG(ERROR) << "free scratch space failure. status: " << st;
+            }
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+
+        bool v = false;
+        auto value_size = value_viewer.value(row).size;
+        // The scan terminates at the first match of any pattern
+        [[maybe_unused]] auto status = hs_scan(
+                state->database, (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
+                value_size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+
+        DCHECK(status == HS_SUCCESS || status == HS_SCAN_TERMINATED) << " status: " << status;
+        result.append(v);
+    }
+
+    return result.build(value_column->is_constant());
+}
+
 void LikePredicate::remove_escape_character(std::string* search_string) {
     std::string tmp_search_string;
     tmp_search_string.swap(*search_string);
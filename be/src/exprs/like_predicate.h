@@ -58,6 +58,44 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    // Multi-pattern matching: an OR-chain of LIKE/REGEXP predicates with constant patterns on the same
+    // column is compiled into one hyperscan database, so each row is scanned once for all patterns.
+    struct MultiPatternState {
+        hs_database_t* database = nullptr;
+        // Prototype scratch space, cloned for each evaluation
+        hs_scratch_t* scratch = nullptr;
+
+        MultiPatternState() = default;
+        MultiPatternState(const MultiPatternState&) = delete;
+        MultiPatternState& operator=(const MultiPatternState&) = delete;
+
+        ~MultiPatternState() {
+            if (scratch != nullptr) {
+                hs_free_scratch(scratch);
+            }
+            if (database != nullptr) {
+                hs_free_database(database);
+            }
+        }
+    };
+
+    // Compile regex patterns into one database, a row matches if any of the patterns matches.
+    // LIKE patterns must be converted by `convert_like_pattern` first.
+    static StatusOr<std::shared_ptr<MultiPatternState>> compile_multi_patterns(
+            const std::vector<std::string>& regex_patterns);
+
+    /**
+     * @param: [string_value]
+     * @paramType: [BinaryColumn]
+     * @return: BooleanColumn, true if the value matches any pattern of the state
+     */
+    static StatusOr<ColumnPtr> multi_pattern_match(const MultiPatternState* state, const ColumnPtr& value_column);
+
+    /// Convert a LIKE pattern (with embedded % and _) into the corresponding
+    /// regular expression pattern, `escape_char` escapes the next % or _.
+    template <bool fullMatch>
+    static std::string convert_like_pattern(const Slice& pattern, char escape_char);
+
 private:
     /**
      * use for:
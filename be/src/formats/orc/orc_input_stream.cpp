@@ -49,7 +49,14 @@ Status ORCHdfsFileStream::setIORanges(const std::vector<io::SharedBufferedInputS
     if (!_sb_stream) {
         return Status::OK();
     }
-    return _sb_stream->set_io_ranges(io_ranges, coalesce_active_lazy_column);
+    RETURN_IF_ERROR(_sb_stream->set_io_ranges(io_ranges, coalesce_active_lazy_column));
+    // read the coalesced ranges in background, so that later streams of the stripe are ready when decoding.
+    int64_t end_offset = 0;
+    for (const auto& r : io_ranges) {
+        end_offset = std::max(end_offset, r.offset + r.size);
+    }
+    _sb_stream->prefetch(end_offset);
+    return Status::OK();
 }
 
 bool ORCHdfsFileStream::isAlreadyCollectedInSharedBuffer(const int64_t offset, const int64_t length) const {
@@ -512,6 +512,105 @@ bool FileReader::_filter_group_with_more_filter(const tparquet::RowGroup& row_gr
     return false;
 }
 
+// get the values which could be probed in bloom filter, for `slot = literal` and `slot in (...)`.
+static ColumnPtr get_bloom_filter_probe_values(ExprContext* ctx, LogicalType ltype) {
+    Expr* root_expr = ctx->root();
+    if (root_expr->get_num_children() < 1 || root_expr->get_child(0)->node_type() != TExprNodeType::SLOT_REF ||
+        root_expr->get_child(0)->type().type != ltype) {
+        return nullptr;
+    }
+
+    if (root_expr->node_type() == TExprNodeType::IN_PRED && root_expr->op() == TExprOpcode::FILTER_IN) {
+        switch (ltype) {
+#define M(NAME)                                                                                  \
+    case LogicalType::NAME: {                                                                    \
+        const auto* in_filter = dynamic_cast<const VectorizedInConstPredicate<NAME>*>(root_expr); \
+        if (in_filter == nullptr || in_filter->is_not_in()) {                                    \
+            return nullptr;                                                                      \
+        }                                                                                        \
+        return in_filter->get_all_values();                                                      \
+    }
+            M(TYPE_TINYINT)
+            M(TYPE_SMALLINT)
+            M(TYPE_INT)
+            M(TYPE_BIGINT)
+            M(TYPE_DATE)
+            M(TYPE_VARCHAR)
+#undef M
+        default:
+            return nullptr;
+        }
+    }
+
+    if (root_expr->node_type() == TExprNodeType::BINARY_PRED && root_expr->op() == TExprOpcode::EQ &&
+        root_expr->get_num_children() == 2 && root_expr->get_child(1)->is_constant() &&
+        root_expr->get_child(1)->type().type == ltype) {
+        auto res = ctx->evaluate(root_expr->get_child(1), nullptr);
+        if (res.ok()) {
+            return res.value();
+        }
+    }
+    return nullptr;
+}
+
+bool FileReader::_filter_group_with_bloom_filter(const tparquet::RowGroup& row_group) {
+    const TupleDescriptor& tuple_desc = *(_scanner_ctx->tuple_desc);
+    std::vector<uint64_t> hashes;
+    for (const auto& [slot_id, ctxs] : _scanner_ctx->conjunct_ctxs_by_slot) {
+        SlotDescriptor* slot = tuple_desc.get_slot_by_id(slot_id);
+        if (slot == nullptr) {
+            continue;
+        }
+        const tparquet::ColumnMetaData* column_meta = nullptr;
+        for (ExprContext* ctx : ctxs) {
+            ColumnPtr values = get_bloom_filter_probe_values(ctx, slot->type().type);
+            if (values == nullptr) {
+                continue;
+            }
+            if (column_meta == nullptr) {
+                std::unordered_map<std::string, size_t> column_name_2_pos_in_meta{};
+                std::vector<SlotDescriptor*> slot_v{slot};
+                _meta_helper->build_column_name_2_pos_in_meta(column_name_2_pos_in_meta, row_group, slot_v);
+                column_meta = _meta_helper->get_column_meta(column_name_2_pos_in_meta, row_group, slot->col_name());
+                if (column_meta == nullptr || !column_meta->__isset.bloom_filter_offset) {
+                    break;
+                }
+            }
+
+            hashes.clear();
+            if (!SplitBlockBloomFilter::hash_values(*values, slot->type().type, column_meta->type, &hashes)) {
+                continue;
+            }
+            auto bloom_filter = _get_bloom_filter(column_meta->bloom_filter_offset);
+            if (!bloom_filter.ok()) {
+                // just read data ignore the bloom filter.
+                LOG(WARNING) << "Failed to read bloom filter of " << slot->col_name() << " in " << _file->filename()
+                             << ": " << bloom_filter.status();
+                break;
+            }
+            const SplitBlockBloomFilter* filter = bloom_filter.value();
+            if (std::none_of(hashes.begin(), hashes.end(), [&](uint64_t hash) { return filter->test_hash(hash); })) {
+                _scanner_ctx->stats->bloom_filter_skip_groups += 1;
+                _scanner_ctx->stats->bloom_filter_skip_rows += row_group.num_rows;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+StatusOr<const SplitBlockBloomFilter*> FileReader::_get_bloom_filter(int64_t offset) {
+    auto iter = _bloom_filters.find(offset);
+    if (iter != _bloom_filters.end()) {
+        return iter->second.get();
+    }
+    SCOPED_RAW_TIMER(&_scanner_ctx->stats->bloom_filter_read_ns);
+    ASSIGN_OR_RETURN(auto bloom_filter, SplitBlockBloomFilter::read(_file, _file_size, offset));
+    const SplitBlockBloomFilter* result = bloom_filter.get();
+    _bloom_filters.emplace(offset, std::move(bloom_filter));
+    return result;
+}
+
 // when doing row group filter, there maybe some error, but we'd better just ignore it instead of returning the error
 // status and lead to the query failed.
 bool FileReader::_filter_group(const tparquet::RowGroup& row_group) {
@@ -527,6 +626,11 @@ bool FileReader::_filter_group(const tparquet::RowGroup& row_group) {
         return true;
     }
 
+    // bloom filter is the last since it needs extra io.
+    if (config::parquet_reader_bloom_filter_enable && _filter_group_with_bloom_filter(row_group)) {
+        return true;
+    }
+
     return false;
 }
 
@@ -717,6 +821,20 @@ Status FileReader::_init_group_readers() {
     return Status::OK();
 }
 
+Status FileReader::_set_group_io_ranges(GroupReader* group_reader) {
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    int64_t end_offset = 0;
+    group_reader->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
+    int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
+    if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
+        _scanner_ctx->stats->group_active_lazy_coalesce_together += 1;
+    } else {
+        _scanner_ctx->stats->group_active_lazy_coalesce_seperately += 1;
+    }
+    group_reader->set_end_offset(end_offset);
+    return _sb_stream->set_io_ranges(ranges, counter >= 0);
+}
+
 Status FileReader::_prepare_cur_row_group() {
     auto& r = _row_group_readers[_cur_row_group_idx];
     // if coalesce read enabled, we have to
@@ -724,18 +842,24 @@ Status FileReader::_prepare_cur_row_group() {
     // 1. allocate shared buffered input stream and
     // 2. collect io ranges of every row group reader.
     // 3. set io ranges to the stream.
+    // if prefetch enabled, io ranges of the next groups are set too and read in background,
+    // so they may be already set when the group becomes current.
     if (config::parquet_coalesce_read_enable && _sb_stream != nullptr) {
-        std::vector<io::SharedBufferedInputStream::IORange> ranges;
-        int64_t end_offset = 0;
-        r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
-        int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
-        if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
-            _scanner_ctx->stats->group_active_lazy_coalesce_together += 1;
-        } else {
-            _scanner_ctx->stats->group_active_lazy_coalesce_seperately += 1;
+        size_t prefetch_groups = 0;
+        if (config::io_prefetch_enable && _sb_stream->prefetch_enabled()) {
+            // scanner waited for the prefetched data since last group, io is slower than decoding,
+            // so read one more group ahead.
+            int64_t wait_timer = _sb_stream->prefetch_wait_timer();
+            prefetch_groups = wait_timer > _last_prefetch_wait_timer ? 2 : 1;
+            _last_prefetch_wait_timer = wait_timer;
+        }
+        size_t end_group_idx = std::min(_cur_row_group_idx + 1 + prefetch_groups, _row_group_size);
+        for (; _io_ranges_end_group_idx < end_group_idx; _io_ranges_end_group_idx++) {
+            RETURN_IF_ERROR(_set_group_io_ranges(_row_group_readers[_io_ranges_end_group_idx].get()));
+        }
+        if (prefetch_groups > 0) {
+            _sb_stream->prefetch(_row_group_readers[_io_ranges_end_group_idx - 1]->end_offset());
         }
-        r->set_end_offset(end_offset);
-        RETURN_IF_ERROR(_sb_stream->set_io_ranges(ranges, counter >= 0));
         _group_reader_param.sb_stream = _sb_stream;
     }
 
@@ -20,6 +20,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "block_cache/block_cache.h"
@@ -31,6 +32,7 @@
 #include "formats/parquet/group_reader.h"
 #include "formats/parquet/meta_helper.h"
 #include "formats/parquet/metadata.h"
+#include "formats/parquet/split_block_bloom_filter.h"
 #include "gen_cpp/parquet_types.h"
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/runtime_state.h"
@@ -106,6 +108,11 @@ private:
 
     bool _filter_group_with_more_filter(const tparquet::RowGroup& row_group);
 
+    bool _filter_group_with_bloom_filter(const tparquet::RowGroup& row_group);
+
+    // get the bloom filter of column chunk at `offset`, which is read only once for a file.
+    StatusOr<const SplitBlockBloomFilter*> _get_bloom_filter(int64_t offset);
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -129,6 +136,8 @@ private:
     StatusOr<uint32_t> _parse_metadata_length(const std::vector<char>& footer_buff) const;
 
     Status _prepare_cur_row_group();
+    // collect io ranges of the row group and set them to shared buffered input stream.
+    Status _set_group_io_ranges(GroupReader* group_reader);
 
     // get min/max value from row group stats
     Status _get_min_max_value(const SlotDescriptor* slot, const tparquet::ColumnMetaData* column_meta,
@@ -146,6 +155,9 @@ private:
     std::vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
+    // row groups before it have set io ranges to shared buffered input stream.
+    size_t _io_ranges_end_group_idx = 0;
+    int64_t _last_prefetch_wait_timer = 0;
 
     size_t _total_row_count = 0;
     size_t _scan_row_count = 0;
@@ -161,6 +173,8 @@ private:
     GroupReaderParam _group_reader_param;
     std::shared_ptr<MetaHelper> _meta_helper = nullptr;
     const std::set<int64_t>* _need_skip_rowids;
+    // bloom filters of column chunks, keyed by bloom_filter_offset.
+    std::unordered_map<int64_t, std::unique_ptr<SplitBlockBloomFilter>> _bloom_filters;
 };
 
 } // namespace starrocks::parquet
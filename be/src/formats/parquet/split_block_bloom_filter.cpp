@@ -0,0 +1,166 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/split_block_bloom_filter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "column/column.h"
+#include "column/datum.h"
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/time_types.h"
+#include "types/date_value.h"
+#include "util/thrift_util.h"
+#include "util/xxh3.h"
+
+namespace starrocks::parquet {
+
+// the header is small, read it together with the beginning of bitset.
+static constexpr int64_t kHeaderSizeGuess = 256;
+
+static constexpr uint32_t kSalt[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                      0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+SplitBlockBloomFilter::SplitBlockBloomFilter(uint32_t num_bytes)
+        : _bitset(num_bytes / sizeof(uint32_t), 0), _num_blocks(num_bytes / kBytesPerBlock) {
+    DCHECK(num_bytes >= kMinimumBytes && num_bytes % kBytesPerBlock == 0);
+}
+
+StatusOr<std::unique_ptr<SplitBlockBloomFilter>> SplitBlockBloomFilter::read(RandomAccessFile* file,
+                                                                             int64_t file_size, int64_t offset) {
+    if (offset <= 0 || offset >= file_size) {
+        return Status::Corruption(
+                strings::Substitute("Invalid bloom filter offset $0, file size is $1", offset, file_size));
+    }
+
+    int64_t read_size = std::min(kHeaderSizeGuess, file_size - offset);
+    std::vector<uint8_t> buffer(read_size);
+    RETURN_IF_ERROR(file->read_at_fully(offset, buffer.data(), read_size));
+
+    tparquet::BloomFilterHeader header;
+    uint32_t header_length = read_size;
+    RETURN_IF_ERROR(deserialize_thrift_msg(buffer.data(), &header_length, TProtocolType::COMPACT, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH || !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("Only support uncompressed split block bloom filter with xxhash");
+    }
+    int64_t num_bytes = header.numBytes;
+    if (num_bytes < kMinimumBytes || num_bytes > kMaximumBytes || num_bytes % kBytesPerBlock != 0 ||
+        offset + header_length + num_bytes > file_size) {
+        return Status::Corruption(strings::Substitute("Invalid bloom filter size $0 at offset $1, file size is $2",
+                                                      num_bytes, offset, file_size));
+    }
+
+    auto filter = std::make_unique<SplitBlockBloomFilter>(num_bytes);
+    auto* bitset = reinterpret_cast<uint8_t*>(filter->_bitset.data());
+    int64_t buffered = std::min<int64_t>(read_size - header_length, num_bytes);
+    memcpy(bitset, buffer.data() + header_length, buffered);
+    if (buffered < num_bytes) {
+        RETURN_IF_ERROR(
+                file->read_at_fully(offset + header_length + buffered, bitset + buffered, num_bytes - buffered));
+    }
+    return filter;
+}
+
+uint64_t SplitBlockBloomFilter::hash(const void* data, size_t len) {
+    return XXH64(data, len, 0);
+}
+
+bool SplitBlockBloomFilter::hash_values(const Column& values, LogicalType ltype, tparquet::Type::type physical_type,
+                                        std::vector<uint64_t>* hashes) {
+    hashes->reserve(hashes->size() + values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        Datum datum = values.get(i);
+        if (datum.is_null()) {
+            return false;
+        }
+        switch (physical_type) {
+        case tparquet::Type::INT32:
+        case tparquet::Type::INT64: {
+            int64_t value = 0;
+            switch (ltype) {
+            case TYPE_TINYINT:
+                value = datum.get_int8();
+                break;
+            case TYPE_SMALLINT:
+                value = datum.get_int16();
+                break;
+            case TYPE_INT:
+                value = datum.get_int32();
+                break;
+            case TYPE_BIGINT:
+                value = datum.get_int64();
+                break;
+            case TYPE_DATE:
+                // DATE of parquet is the number of days from the unix epoch.
+                if (physical_type != tparquet::Type::INT32) {
+                    return false;
+                }
+                value = datum.get_date().julian() - date::UNIX_EPOCH_JULIAN;
+                break;
+            default:
+                return false;
+            }
+            if (physical_type == tparquet::Type::INT32) {
+                auto value32 = static_cast<int32_t>(value);
+                hashes->push_back(hash(&value32, sizeof(value32)));
+            } else {
+                hashes->push_back(hash(&value, sizeof(value)));
+            }
+            break;
+        }
+        case tparquet::Type::BYTE_ARRAY: {
+            if (ltype != TYPE_VARCHAR) {
+                return false;
+            }
+            const Slice& slice = datum.get_slice();
+            hashes->push_back(hash(slice.data, slice.size));
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+void SplitBlockBloomFilter::_block_mask(uint32_t key, uint32_t* mask) {
+    for (int i = 0; i < 8; i++) {
+        mask[i] = 1U << ((key * kSalt[i]) >> 27);
+    }
+}
+
+void SplitBlockBloomFilter::insert_hash(uint64_t hash) {
+    uint32_t mask[8];
+    _block_mask(static_cast<uint32_t>(hash), mask);
+    uint32_t* block = _bitset.data() + _block_index(hash) * 8;
+    for (int i = 0; i < 8; i++) {
+        block[i] |= mask[i];
+    }
+}
+
+bool SplitBlockBloomFilter::test_hash(uint64_t hash) const {
+    uint32_t mask[8];
+    _block_mask(static_cast<uint32_t>(hash), mask);
+    const uint32_t* block = _bitset.data() + _block_index(hash) * 8;
+    for (int i = 0; i < 8; i++) {
+        if ((block[i] & mask[i]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace starrocks::parquet
@@ -0,0 +1,73 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "gen_cpp/parquet_types.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+class RandomAccessFile;
+} // namespace starrocks
+
+namespace starrocks::parquet {
+
+// SplitBlockBloomFilter is the bloom filter of column chunk written at `bloom_filter_offset`.
+// The bitset is split into blocks of 256 bits, and each value sets one bit in every 32-bit word of one block.
+// https://github.com/apache/parquet-format/blob/master/BloomFilter.md
+class SplitBlockBloomFilter {
+public:
+    static constexpr uint32_t kBytesPerBlock = 32;
+    static constexpr uint32_t kMinimumBytes = kBytesPerBlock;
+    static constexpr uint32_t kMaximumBytes = 128 * 1024 * 1024;
+
+    // num_bytes should be a multiple of kBytesPerBlock.
+    explicit SplitBlockBloomFilter(uint32_t num_bytes);
+
+    // read the bloom filter header and bitset at `offset` of file.
+    static StatusOr<std::unique_ptr<SplitBlockBloomFilter>> read(RandomAccessFile* file, int64_t file_size,
+                                                                 int64_t offset);
+
+    // the hash of a value is the xxhash64 of its plain encoding, without length prefix for BYTE_ARRAY.
+    static uint64_t hash(const void* data, size_t len);
+
+    // hash the non-null values in `values`, whose type is `ltype`, as the plain encoding of `physical_type`.
+    // return false if the type is not supported or there is null in values.
+    static bool hash_values(const Column& values, LogicalType ltype, tparquet::Type::type physical_type,
+                            std::vector<uint64_t>* hashes);
+
+    void insert_hash(uint64_t hash);
+
+    bool test_hash(uint64_t hash) const;
+
+    // the bitset in little-endian 32-bit words.
+    const uint8_t* data() const { return reinterpret_cast<const uint8_t*>(_bitset.data()); }
+    size_t num_bytes() const { return _bitset.size() * sizeof(uint32_t); }
+
+private:
+    static void _block_mask(uint32_t key, uint32_t* mask);
+
+    uint32_t _block_index(uint64_t hash) const { return ((hash >> 32) * _num_blocks) >> 32; }
+
+    std::vector<uint32_t> _bitset;
+    uint32_t _num_blocks;
+};
+
+} // namespace starrocks::parquet
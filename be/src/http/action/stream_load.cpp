@@ -308,9 +308,12 @@ Status StreamLoadAction::_on_header(HttpRequest* http_req, StreamLoadContext* ct
         }
 
         if (ctx->format == TFileFormatType::FORMAT_JSON) {
+            ctx->json_array_streaming = config::enable_streaming_load_json_array &&
+                                        boost::iequals(http_req->header(HTTP_STRIP_OUTER_ARRAY), "true") &&
+                                        http_req->header(HTTP_JSONROOT).empty();
             size_t max_body_bytes = config::streaming_load_max_batch_size_mb * 1024 * 1024;
             auto ignore_json_size = boost::iequals(http_req->header(HTTP_IGNORE_JSON_SIZE), "true");
-            if (!ignore_json_size && ctx->body_bytes > max_body_bytes) {
+            if (!ctx->json_array_streaming && !ignore_json_size && ctx->body_bytes > max_body_bytes) {
                 std::stringstream ss;
                 ss << "The size of this batch exceed the max size [" << max_body_bytes << "]  of json type data "
                    << " data [ " << ctx->body_bytes
@@ -360,7 +363,7 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
                     ctx->format == TFileFormatType::FORMAT_JSON ? std::max(len, ctx->kDefaultBufferSize) : len);
 
         } else if (ctx->buffer->remaining() < len) {
-            if (ctx->format == TFileFormatType::FORMAT_JSON) {
+            if (ctx->format == TFileFormatType::FORMAT_JSON && !ctx->json_array_streaming) {
                 // For json format, we need build a complete json before we push the buffer to the pipe.
                 // buffer capacity is not enough, so we try to expand the buffer.
                 ByteBufferPtr buf = ByteBuffer::allocate(BitUtil::RoundUpToPowerOfTwo(ctx->buffer->pos + len));
@@ -368,7 +371,8 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
                 std::swap(buf, ctx->buffer);
 
             } else {
-                // For non-json format, we could push buffer to the body_sink in streaming mode.
+                // For non-json format and streaming json array,
+                // we could push buffer to the body_sink in streaming mode.
                 // buffer capacity is not enough, so we push the buffer to the pipe and allocate new one.
                 ctx->buffer->flip();
                 auto st = ctx->body_sink->append(std::move(ctx->buffer));
@@ -431,6 +435,9 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req, StreamLoadContext*
     if (ctx->use_streaming) {
         auto pipe =
                 std::make_shared<StreamLoadPipe>(1024 * 1024 /* max_buffered_bytes */, 64 * 1024 /* min_chunk_size */);
+        if (ctx->json_array_streaming) {
+            pipe->set_json_array_streaming();
+        }
         RETURN_IF_ERROR(_exec_env->load_stream_mgr()->put(ctx->id, pipe));
         request.fileType = TFileType::FILE_STREAM;
         ctx->body_sink = pipe;
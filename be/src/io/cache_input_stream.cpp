@@ -18,8 +18,10 @@
 
 #include <utility>
 
+#include "block_cache/cache_warmup.h"
+#include "block_cache/datacache_utils.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
-#include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
 #include "util/stack_util.h"
 
@@ -39,30 +41,18 @@ CacheInputStream::CacheInputStream(const std::shared_ptr<SharedBufferedInputStre
           _size(size) {
     _cache = BlockCache::instance();
     _block_size = _cache->block_size();
-
-    _cache_key.resize(12);
-
-    char* data = _cache_key.data();
-    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
-    memcpy(data, &hash_value, sizeof(hash_value));
-    // The modification time is more appropriate to indicate the different file versions.
-    // While some data source, such as Hudi, have no modification time because their files
-    // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
-    // Usually the last modification timestamp has 41 bits, to reduce memory usage, we ignore the tail 9
-    // bytes and choose the high 32 bits to represent the second timestamp.
-    if (modification_time > 0) {
-        uint32_t mtime_s = (modification_time >> 9) & 0x00000000FFFFFFFF;
-        memcpy(data + 8, &mtime_s, sizeof(mtime_s));
-    } else {
-        uint32_t file_size = _size;
-        memcpy(data + 8, &file_size, sizeof(file_size));
-    }
+    _modification_time = modification_time;
+    _cache_key = DataCacheUtils::get_cache_key(filename, _size, modification_time);
     // default _buffer size is 4MB = (16 * 256KB)
     _buffer_size = 16 * _block_size;
     _buffer.reserve(_buffer_size);
 }
 
 CacheInputStream::~CacheInputStream() {
+    if (auto* warmup = _cache->warmup(); warmup != nullptr && _enable_warmup_record && !_accessed_blocks.empty()) {
+        warmup->record(_filename, _size, _modification_time,
+                       std::vector<int64_t>(_accessed_blocks.begin(), _accessed_blocks.end()));
+    }
     int64_t io_bytes = _sb_stream->shared_io_bytes() + _sb_stream->direct_io_bytes();
     if (_enable_cache_io_adaptor && io_bytes > 0) {
         int64_t latency_us_per_block = (_sb_stream->shared_io_timer() + _sb_stream->direct_io_timer()) / 1000;
@@ -214,7 +204,7 @@ Status CacheInputStream::_read_blocks_from_remote(const int64_t offset, const in
             out_remain_size -= out_size;
         }
 
-        if (_enable_populate_cache) {
+        if (_enable_populate_cache && !_skip_populate(read_offset_cursor, read_size)) {
             RETURN_IF_ERROR(_populate_to_cache(read_offset_cursor, read_size, src));
         }
 
@@ -252,12 +242,16 @@ Status CacheInputStream::_populate_to_cache(const int64_t offset, const int64_t
                 options.allow_zero_copy = true;
             }
         }
+        options.skip_admission = _small_read;
         Status r = _cache->write_buffer(_cache_key, write_offset_cursor, write_size, src_cursor, &options);
         if (r.ok() || r.is_already_exist()) {
             _stats.write_cache_count += 1;
             _stats.write_cache_bytes += write_size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
+        } else if (r.is_resource_busy()) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += write_size;
         } else if (!_can_ignore_populate_error(r)) {
             _stats.write_cache_fail_count += 1;
             _stats.write_cache_fail_bytes += write_size;
@@ -316,6 +310,7 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
         return Status::EndOfFile("");
     }
     const int64_t end_offset = offset + count;
+    _small_read = count <= config::datacache_admission_small_read_bytes;
 
     char* p = static_cast<char*>(out);
     char* pe = p + count;
@@ -323,6 +318,11 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
     const int64_t _block_size = _cache->block_size();
     const int64_t start_block_id = offset / _block_size;
     const int64_t end_block_id = (end_offset - 1) / _block_size;
+    if (_enable_warmup_record && _cache->warmup() != nullptr) {
+        for (int64_t i = start_block_id; i <= end_block_id; i++) {
+            _accessed_blocks.insert(i * _block_size);
+        }
+    }
 
     std::vector<ReadFromRemoteIORange> need_read_from_remote{};
 
@@ -415,6 +415,7 @@ StatusOr<std::string_view> CacheInputStream::peek(int64_t count) {
     // so here we have to fill cache manually.
     SharedBufferPtr sb;
     ASSIGN_OR_RETURN(auto s, _sb_stream->peek_shared_buffer(count, &sb));
+    _small_read = count <= config::datacache_admission_small_read_bytes;
     if (_enable_populate_cache) {
         _populate_cache_from_zero_copy_buffer(s.data(), _offset, count, sb);
     }
@@ -425,6 +426,9 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
                                                              const SharedBufferPtr& sb) {
     int64_t begin = offset / _block_size * _block_size;
     int64_t end = std::min((offset + count + _block_size - 1) / _block_size * _block_size, _size);
+    if (_skip_populate(begin, end - begin)) {
+        return;
+    }
     p -= (offset - begin);
     auto f = [sb, this](const char* buf, size_t off, size_t size) {
         SCOPED_RAW_TIMER(&_stats.write_cache_ns);
@@ -439,12 +443,16 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
             options.callback = cb;
             options.allow_zero_copy = true;
         }
+        options.skip_admission = _small_read;
         Status r = _cache->write_buffer(_cache_key, off, size, buf, &options);
         if (r.ok() || r.is_already_exist()) {
             _stats.write_cache_count += 1;
             _stats.write_cache_bytes += size;
             _stats.write_mem_cache_bytes += options.stats.write_mem_bytes;
             _stats.write_disk_cache_bytes += options.stats.write_disk_bytes;
+        } else if (r.is_resource_busy()) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += size;
         } else if (!_can_ignore_populate_error(r)) {
             _stats.write_cache_fail_count += 1;
             _stats.write_cache_fail_bytes += size;
@@ -461,6 +469,24 @@ void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int6
     return;
 }
 
+bool CacheInputStream::_skip_populate(int64_t offset, int64_t size) {
+    // A range starting inside the last block of the previous one continues the sequential run.
+    if (offset <= _sequential_end && offset >= _sequential_end - _block_size) {
+        _sequential_bytes += std::max<int64_t>(0, offset + size - _sequential_end);
+        _sequential_end = std::max(_sequential_end, offset + size);
+    } else {
+        _sequential_bytes = size;
+        _sequential_end = offset + size;
+    }
+    const int64_t limit = config::datacache_sequential_scan_bypass_bytes;
+    if (limit <= 0 || _small_read || _sequential_bytes <= limit) {
+        return false;
+    }
+    _stats.skip_write_cache_count += 1;
+    _stats.skip_write_cache_bytes += size;
+    return true;
+}
+
 bool CacheInputStream::_can_ignore_populate_error(const Status& status) const {
     if (status.is_resource_busy() || status.is_mem_limit_exceeded() || status.is_capacity_limit_exceeded()) {
         return true;
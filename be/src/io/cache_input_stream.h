@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 
 #include "block_cache/block_cache.h"
 #include "block_cache/io_buffer.h"
@@ -71,6 +72,8 @@ public:
 
     void set_enable_cache_io_adaptor(bool v) { _enable_cache_io_adaptor = v; }
 
+    void set_enable_warmup_record(bool v) { _enable_warmup_record = v; }
+
     void set_datacache_evict_probability(int32_t v) { _datacache_evict_probability = v; }
 
     int64_t get_align_size() const;
@@ -97,6 +100,9 @@ private:
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _deduplicate_shared_buffer(const SharedBufferPtr& sb);
     bool _can_ignore_populate_error(const Status& status) const;
+    // Returns true if the remote data in [offset, offset + size) should not be written into cache
+    // because it is part of a large sequential scan.
+    bool _skip_populate(int64_t offset, int64_t size);
 
     std::string _cache_key;
     std::string _filename;
@@ -106,14 +112,23 @@ private:
     std::string _buffer;
     Stats _stats;
     int64_t _size;
+    int64_t _modification_time = 0;
     bool _enable_populate_cache = false;
     bool _enable_async_populate_mode = false;
     bool _enable_block_buffer = false;
+    bool _enable_warmup_record = false;
     bool _enable_cache_io_adaptor = false;
     int32_t _datacache_evict_probability = 100;
     BlockCache* _cache = nullptr;
     int64_t _block_size = 0;
     std::unordered_map<int64_t, BlockBuffer> _block_map;
+    // whether the current read is small enough to be treated as metadata
+    bool _small_read = false;
+    // end offset and total bytes of the current run of sequential remote reads
+    int64_t _sequential_end = -1;
+    int64_t _sequential_bytes = 0;
+    // offsets of the blocks read through this stream, reported to the cache warm-up on destruction
+    std::unordered_set<int64_t> _accessed_blocks;
 };
 
 } // namespace starrocks::io
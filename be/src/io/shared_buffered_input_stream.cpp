@@ -20,6 +20,7 @@
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -27,6 +28,11 @@ SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInp
                                                      size_t file_size)
         : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
 
+SharedBufferedInputStream::~SharedBufferedInputStream() {
+    // the prefetch tasks refer to the mem tracker of query, wait for them.
+    release();
+}
+
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
         offset = raw_offset / align_size * align_size;
@@ -215,6 +221,9 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     }
 
     SharedBuffer& sb = *shared_buffer;
+    if (sb.prefetch.valid()) {
+        _wait_prefetch(&sb);
+    }
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
         SCOPED_RAW_TIMER(&_shared_io_timer);
@@ -233,14 +242,119 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
 }
 
 void SharedBufferedInputStream::release() {
+    for (auto& [_, sb] : _map) {
+        _discard_prefetch(sb.get());
+    }
     _map.clear();
 }
 
 void SharedBufferedInputStream::release_to_offset(int64_t offset) {
     auto it = _map.upper_bound(offset);
+    for (auto iter = _map.begin(); iter != it; ++iter) {
+        _discard_prefetch(iter->second.get());
+    }
     _map.erase(_map.begin(), it);
 }
 
+void SharedBufferedInputStream::set_prefetch_stream(ThreadPool* pool, StreamOpener opener) {
+    _prefetch_pool = pool;
+    _prefetch_stream = std::make_shared<PrefetchStream>(std::move(opener));
+}
+
+Status SharedBufferedInputStream::PrefetchStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    std::lock_guard<std::mutex> l(_lock);
+    if (_stream == nullptr && _open_status.ok()) {
+        auto stream_or = _opener();
+        if (stream_or.ok()) {
+            _stream = std::move(stream_or).value();
+        } else {
+            _open_status = stream_or.status();
+        }
+    }
+    RETURN_IF_ERROR(_open_status);
+    return _stream->read_at_fully(offset, out, count);
+}
+
+void SharedBufferedInputStream::prefetch(int64_t end_offset) {
+    if (_prefetch_pool == nullptr || !config::io_prefetch_enable) {
+        return;
+    }
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    if (mem_tracker != nullptr && !mem_tracker->check_mem_limit("io prefetch").ok()) {
+        return;
+    }
+
+    using PrefetchItem = std::pair<SharedBufferPtr, std::shared_ptr<std::promise<Status>>>;
+    std::vector<PrefetchItem> items;
+    int64_t bytes = 0;
+    for (const auto& iter : _map) {
+        if (iter.first > end_offset) {
+            break;
+        }
+        const SharedBufferPtr& sb = iter.second;
+        if (sb->prefetch.valid() || sb->buffer.capacity() != 0) {
+            continue;
+        }
+        if (_prefetch_inflight_bytes + bytes + sb->size > config::io_prefetch_max_buffer_bytes) {
+            break;
+        }
+        items.emplace_back(sb, std::make_shared<std::promise<Status>>());
+        bytes += sb->size;
+    }
+    if (items.empty()) {
+        return;
+    }
+
+    // the buffers are read one by one, so that the first one could be used as soon as possible.
+    auto st = _prefetch_pool->submit_func([items, stream = _prefetch_stream, mem_tracker]() {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        for (const auto& [sb, promise] : items) {
+            sb->buffer.reserve(sb->size);
+            promise->set_value(stream->read_at_fully(sb->offset, sb->buffer.data(), sb->size));
+        }
+    });
+    if (!st.ok()) {
+        return;
+    }
+    for (const auto& [sb, promise] : items) {
+        sb->prefetch = promise->get_future().share();
+    }
+    _prefetch_inflight_bytes += bytes;
+}
+
+void SharedBufferedInputStream::_wait_prefetch(SharedBuffer* sb) {
+    Status st;
+    {
+        SCOPED_RAW_TIMER(&_prefetch_wait_timer);
+        try {
+            st = sb->prefetch.get();
+        } catch (const std::future_error& e) {
+            // the task is dropped by the thread pool.
+            st = Status::InternalError(e.what());
+        }
+    }
+    sb->prefetch = {};
+    _prefetch_inflight_bytes -= sb->size;
+    if (st.ok()) {
+        _prefetch_hit_bytes += sb->size;
+        _shared_io_count += 1;
+        _shared_io_bytes += sb->size;
+    } else {
+        // read it again when used.
+        std::vector<uint8_t>().swap(sb->buffer);
+    }
+}
+
+void SharedBufferedInputStream::_discard_prefetch(SharedBuffer* sb) {
+    if (!sb->prefetch.valid()) {
+        return;
+    }
+    sb->prefetch.wait();
+    sb->prefetch = {};
+    _prefetch_inflight_bytes -= sb->size;
+    _prefetch_wasted_bytes += sb->size;
+}
+
 Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
     auto st = find_shared_buffer(offset, count);
     if (!st.ok()) {
@@ -269,6 +383,9 @@ StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
 
 StatusOr<std::string_view> SharedBufferedInputStream::peek(int64_t count) {
     ASSIGN_OR_RETURN(auto ret, find_shared_buffer(_offset, count));
+    if (ret->prefetch.valid()) {
+        _wait_prefetch(ret.get());
+    }
     if (ret->buffer.capacity() == 0) return Status::NotSupported("peek shared buffer empty");
     const uint8_t* buf = nullptr;
     RETURN_IF_ERROR(get_bytes(&buf, _offset, count, ret));
@@ -278,6 +395,9 @@ StatusOr<std::string_view> SharedBufferedInputStream::peek(int64_t count) {
 StatusOr<std::string_view> SharedBufferedInputStream::peek_shared_buffer(int64_t count,
                                                                          SharedBufferPtr* shared_buffer) {
     ASSIGN_OR_RETURN(auto ret, find_shared_buffer(_offset, count));
+    if (ret->prefetch.valid()) {
+        _wait_prefetch(ret.get());
+    }
     if (ret->buffer.capacity() == 0) return Status::NotSupported("peek shared buffer empty");
     const uint8_t* buf = ret->buffer.data() + _offset - ret->offset;
     if (shared_buffer) {
@@ -16,11 +16,19 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class ThreadPool;
+} // namespace starrocks
+
 namespace starrocks::io {
 
 class SharedBufferedInputStream : public SeekableInputStream {
@@ -47,13 +55,15 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        // valid when the buffer is being read by prefetch and not consumed yet.
+        std::shared_future<Status> prefetch;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
     using SharedBufferPtr = std::shared_ptr<SharedBuffer>;
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
-    ~SharedBufferedInputStream() override = default;
+    ~SharedBufferedInputStream() override;
 
     Status seek(int64_t position) override {
         _offset = position;
@@ -83,6 +93,17 @@ public:
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
 
+    using StreamOpener = std::function<StatusOr<std::shared_ptr<SeekableInputStream>>()>;
+    // Enable prefetch, the shared buffers will be read in `pool` from a stream opened by `opener`.
+    // The stream is opened by the first prefetch task, so files that never prefetch do not open it.
+    // The prefetch tasks read the stream one at a time, it should not be used by others.
+    void set_prefetch_stream(ThreadPool* pool, StreamOpener opener);
+    // Read the shared buffers which end before `end_offset` in background, get_bytes will wait for them.
+    // The prefetched but not yet consumed data is limited by config::io_prefetch_max_buffer_bytes,
+    // and the memory is charged to the mem tracker of current thread.
+    void prefetch(int64_t end_offset);
+    bool prefetch_enabled() const { return _prefetch_pool != nullptr; }
+
     int64_t shared_io_count() const { return _shared_io_count; }
     int64_t shared_io_bytes() const { return _shared_io_bytes; }
     int64_t shared_align_io_bytes() const { return _shared_align_io_bytes; }
@@ -91,6 +112,9 @@ public:
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
+    int64_t prefetch_hit_bytes() const { return _prefetch_hit_bytes; }
+    int64_t prefetch_wasted_bytes() const { return _prefetch_wasted_bytes; }
+    int64_t prefetch_wait_timer() const { return _prefetch_wait_timer; }
 
     StatusOr<std::string_view> peek(int64_t count) override;
     const std::string& filename() const override { return _filename; }
@@ -98,7 +122,24 @@ public:
     StatusOr<std::string_view> peek_shared_buffer(int64_t count, SharedBufferPtr* shared_buffer);
 
 private:
+    // The stream of prefetch shared by the prefetch tasks of a file, which may run concurrently.
+    class PrefetchStream {
+    public:
+        explicit PrefetchStream(StreamOpener opener) : _opener(std::move(opener)) {}
+        Status read_at_fully(int64_t offset, void* out, int64_t count);
+
+    private:
+        std::mutex _lock;
+        StreamOpener _opener;
+        std::shared_ptr<SeekableInputStream> _stream;
+        Status _open_status;
+    };
+
     void _update_estimated_mem_usage();
+    // wait for the prefetch of shared buffer, the buffer is left empty if prefetch failed.
+    void _wait_prefetch(SharedBuffer* sb);
+    // wait for the prefetch of shared buffer which will be released without being read.
+    void _discard_prefetch(SharedBuffer* sb);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
@@ -118,6 +159,12 @@ private:
     int64_t _direct_io_timer = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
+    ThreadPool* _prefetch_pool = nullptr;
+    std::shared_ptr<PrefetchStream> _prefetch_stream;
+    int64_t _prefetch_inflight_bytes = 0;
+    int64_t _prefetch_hit_bytes = 0;
+    int64_t _prefetch_wasted_bytes = 0;
+    int64_t _prefetch_wait_timer = 0;
 };
 
 } // namespace starrocks::io
@@ -392,6 +392,13 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("io_prefetch") // thread pool for reading ahead of external table scan
+                            .set_min_threads(0)
+                            .set_max_threads(config::io_prefetch_thread_num)
+                            .set_max_queue_size(1000)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_io_prefetch_pool));
+
     std::unique_ptr<ThreadPool> driver_executor_thread_pool;
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
@@ -670,6 +677,10 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_io_prefetch_pool) {
+        _io_prefetch_pool->shutdown();
+    }
+
 #ifndef BE_TEST
     close_s3_clients();
 #endif
@@ -729,6 +740,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
+    _io_prefetch_pool.reset();
     _automatic_partition_pool.reset();
     _metrics = nullptr;
 }
@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/huge_page_allocator.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks {
+
+size_t HugePageAllocator::min_bytes(HugePageUsage usage) {
+    bool enabled = false;
+    switch (usage) {
+    case HugePageUsage::JOIN_HASH_TABLE:
+        enabled = config::enable_huge_page_for_join_hash_table;
+        break;
+    case HugePageUsage::AGG_HASH_MAP:
+        enabled = config::enable_huge_page_for_agg_hash_map;
+        break;
+    case HugePageUsage::SORT_BUFFER:
+        enabled = config::enable_huge_page_for_sort_buffer;
+        break;
+    }
+    if (!enabled) {
+        return std::numeric_limits<size_t>::max();
+    }
+    return std::max<int64_t>(config::huge_page_alloc_min_bytes, HUGE_PAGE_SIZE);
+}
+
+static void* map_hugetlb(size_t length) {
+#ifdef MAP_HUGETLB
+    void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED) {
+        return ptr;
+    }
+    VLOG(2) << "fail to allocate " << length << " bytes from hugetlbfs pool, fall back to transparent huge pages";
+#endif
+    return nullptr;
+}
+
+// Map a huge page aligned region, so that the whole region can be backed by transparent huge pages.
+static void* map_transparent_huge_pages(size_t length) {
+    const size_t mapped_length = length + HugePageAllocator::HUGE_PAGE_SIZE;
+    auto* mapped = (uint8_t*)mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (mapped == MAP_FAILED) {
+        PLOG(ERROR) << "fail to allocate memory via mmap";
+        return nullptr;
+    }
+    auto addr = reinterpret_cast<uintptr_t>(mapped);
+    auto* aligned = reinterpret_cast<uint8_t*>(HugePageAllocator::round_up(addr));
+    size_t head = aligned - mapped;
+    size_t tail = mapped_length - head - length;
+    if (head > 0) {
+        munmap(mapped, head);
+    }
+    if (tail > 0) {
+        munmap(aligned + length, tail);
+    }
+#ifdef MADV_HUGEPAGE
+    if (madvise(aligned, length, MADV_HUGEPAGE) != 0) {
+        VLOG(2) << "fail to madvise MADV_HUGEPAGE, transparent huge pages may be disabled";
+    }
+#endif
+    return aligned;
+}
+
+void* HugePageAllocator::allocate(size_t length) {
+    length = round_up(length);
+    if (tls_thread_status.is_catched()) {
+        if (!tls_thread_status.try_mem_consume(length)) {
+            return nullptr;
+        }
+    } else {
+        tls_thread_status.mem_consume(length);
+    }
+
+    void* ptr = nullptr;
+    if (config::huge_page_alloc_use_hugetlb) {
+        ptr = map_hugetlb(length);
+    }
+    if (ptr == nullptr) {
+        ptr = map_transparent_huge_pages(length);
+    }
+    if (ptr == nullptr) {
+        tls_thread_status.mem_release(length);
+    }
+    return ptr;
+}
+
+void HugePageAllocator::free(void* ptr, size_t length) {
+    if (ptr == nullptr) {
+        return;
+    }
+    length = round_up(length);
+    if (munmap(ptr, length) != 0) {
+        PLOG(ERROR) << "fail to free memory via munmap";
+    }
+    tls_thread_status.mem_release(length);
+}
+
+void HugePageAllocator::advise(void* ptr, size_t length) {
+#ifdef MADV_HUGEPAGE
+    auto begin = round_up(reinterpret_cast<uintptr_t>(ptr));
+    auto end = (reinterpret_cast<uintptr_t>(ptr) + length) & ~(HUGE_PAGE_SIZE - 1);
+    if (begin < end) {
+        (void)madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+} // namespace starrocks
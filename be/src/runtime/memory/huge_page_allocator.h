@@ -0,0 +1,137 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace starrocks {
+
+// The kinds of buffers that can be backed by huge pages, each one is enabled by its own config.
+enum class HugePageUsage {
+    JOIN_HASH_TABLE,
+    AGG_HASH_MAP,
+    SORT_BUFFER,
+};
+
+// Allocate memory backed by 2MB huge pages, for the multi-GB, long-lived and randomly accessed
+// buffers which suffer from TLB misses with 4KB pages.
+//
+// The memory is mapped directly instead of going through malloc, either from the hugetlbfs pool
+// (config::huge_page_alloc_use_hugetlb) or as transparent huge pages with madvise(MADV_HUGEPAGE).
+// It is accounted to the mem tracker of the current thread, in the same way as the malloc hooks do.
+class HugePageAllocator {
+public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    // Buffers of at least this many bytes are backed by huge pages for |usage|,
+    // SIZE_MAX if huge pages are disabled for |usage|.
+    static size_t min_bytes(HugePageUsage usage);
+
+    // Return nullptr if the memory cannot be mapped or the mem limit is exceeded.
+    // |length| is rounded up to the huge page size.
+    static void* allocate(size_t length);
+
+    // |length| must be the one passed to allocate().
+    static void free(void* ptr, size_t length);
+
+    // Ask the kernel to back the huge page aligned part of a malloc-ed buffer with transparent huge pages.
+    // It is most effective before the buffer is touched.
+    static void advise(void* ptr, size_t length);
+
+    static size_t round_up(size_t length) { return (length + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1); }
+};
+
+// STL allocator which allocates the buffers of at least HugePageAllocator::min_bytes(usage) bytes from
+// HugePageAllocator, and the smaller ones from the general allocator.
+//
+// The threshold is captured when the allocator is created, so that changing the configs never lets a
+// container free its buffer in the wrong way. The allocators propagate with their containers for the same reason.
+template <typename T, HugePageUsage usage>
+class HugePageStlAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    template <typename U>
+    struct rebind {
+        using other = HugePageStlAllocator<U, usage>;
+    };
+
+    HugePageStlAllocator() : _min_bytes(HugePageAllocator::min_bytes(usage)) {}
+
+    template <typename U>
+    HugePageStlAllocator(const HugePageStlAllocator<U, usage>& other) : _min_bytes(other.min_bytes()) {}
+
+    T* allocate(size_t n) {
+        const size_t bytes = n * sizeof(T);
+        if (bytes < _min_bytes) {
+            return std::allocator<T>().allocate(n);
+        }
+        void* ptr = HugePageAllocator::allocate(bytes);
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        const size_t bytes = n * sizeof(T);
+        if (bytes < _min_bytes) {
+            std::allocator<T>().deallocate(ptr, n);
+        } else {
+            HugePageAllocator::free(ptr, bytes);
+        }
+    }
+
+    // Like RawAllocator, resize() without a value leaves the elements uninitialized, so the allocator doesn't add
+    // a fill pass over the buffers it replaces. The callers needing zeros, e.g. the buckets of join hash table,
+    // fill them explicitly.
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args) {
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+    size_t min_bytes() const { return _min_bytes; }
+
+    template <typename U>
+    bool operator==(const HugePageStlAllocator<U, usage>& rhs) const {
+        return _min_bytes == rhs.min_bytes();
+    }
+    template <typename U>
+    bool operator!=(const HugePageStlAllocator<U, usage>& rhs) const {
+        return !(*this == rhs);
+    }
+
+private:
+    size_t _min_bytes = std::numeric_limits<size_t>::max();
+};
+
+template <typename T, HugePageUsage usage>
+using HugePageBuffer = std::vector<T, HugePageStlAllocator<T, usage>>;
+
+} // namespace starrocks
@@ -220,6 +220,9 @@ public:
     // when use_streaming is true, we use stream_pipe to send source data,
     // otherwise we save source data to file first, then process it.
     bool use_streaming = false;
+    // when json_array_streaming is true, the json array is pushed to stream_pipe in pieces
+    // and parsed window by window, otherwise the whole json is built before pushed.
+    bool json_array_streaming = false;
     TFileFormatType::type format = TFileFormatType::FORMAT_CSV_PLAIN;
 
     TStreamLoadPutResult put_result;
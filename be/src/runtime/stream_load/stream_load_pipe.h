@@ -83,6 +83,11 @@ public:
 
     void set_non_blocking_read() { _non_blocking_read = true; }
 
+    // The data in pipe is one json array split at arbitrary positions,
+    // rather than a complete json document per buffer.
+    void set_json_array_streaming() { _json_array_streaming = true; }
+    bool is_json_array_streaming() const { return _json_array_streaming; }
+
 private:
     Status _append(const ByteBufferPtr& buf);
 
@@ -101,6 +106,7 @@ private:
     std::condition_variable _put_cond;
     std::condition_variable _get_cond;
     bool _non_blocking_read{false};
+    bool _json_array_streaming{false};
 
     bool _finished{false};
     bool _cancelled{false};
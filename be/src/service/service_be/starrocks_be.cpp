@@ -39,6 +39,7 @@
 #include "storage/storage_engine.h"
 #include "util/logging.h"
 #include "util/mem_info.h"
+#include "util/starrocks_metrics.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/thrift_server.h"
 
@@ -118,7 +119,17 @@ Status init_datacache(GlobalEnv* global_env, const std::vector<StorePath>& stora
         cache_options.skip_read_factor = starrocks::config::datacache_skip_read_factor;
         cache_options.scheduler_threads_per_cpu = starrocks::config::datacache_scheduler_threads_per_cpu;
         cache_options.engine = config::datacache_engine;
-        return cache->init(cache_options);
+        RETURN_IF_ERROR(cache->init(cache_options));
+        if (cache->warmup() != nullptr) {
+            REGISTER_GAUGE_STARROCKS_METRIC(datacache_warmup_total_blocks,
+                                            []() { return BlockCache::instance()->warmup()->progress().total_blocks; })
+            REGISTER_GAUGE_STARROCKS_METRIC(datacache_warmup_cached_blocks,
+                                            []() { return BlockCache::instance()->warmup()->progress().cached_blocks; })
+            REGISTER_GAUGE_STARROCKS_METRIC(datacache_warmup_loaded_blocks,
+                                            []() { return BlockCache::instance()->warmup()->progress().loaded_blocks; })
+            REGISTER_GAUGE_STARROCKS_METRIC(datacache_warmup_failed_blocks,
+                                            []() { return BlockCache::instance()->warmup()->progress().failed_blocks; })
+        }
     }
     return Status::OK();
 }
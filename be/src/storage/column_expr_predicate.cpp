@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "column/column_helper.h"
+#include "column/datum_convert.h"
 #include "common/status.h"
 #include "common/statusor.h"
 #include "exprs/binary_predicate.h"
@@ -283,6 +284,131 @@ Status ColumnExprPredicate::try_to_rewrite_for_zone_map_filter(starrocks::Object
 
     return Status::OK();
 }
+// Returns the flat json sub-column name accessed by a single-level json path, e.g. `$.a` -> `a`,
+// `$."a.b"` -> `"a.b"`. Only top-level keys are flattened, so nested paths are not supported.
+static bool json_path_to_flat_name(const Slice& path, std::string* name) {
+    std::string_view sv(path.data, path.size);
+    if (sv.size() <= 2 || sv.substr(0, 2) != "$.") {
+        return false;
+    }
+    sv.remove_prefix(2);
+    if (sv.front() == '"') {
+        // quoted key, the writer keeps the quotes in the sub-column name
+        if (sv.size() < 3 || sv.back() != '"' || sv.substr(1, sv.size() - 2).find('"') != std::string_view::npos) {
+            return false;
+        }
+    } else if (sv.find_first_of(".[]*\"") != std::string_view::npos) {
+        return false;
+    }
+    name->assign(sv.data(), sv.size());
+    return true;
+}
+
+Status ColumnExprPredicate::try_to_rewrite_for_json_flat_column(
+        ObjectPool* pool, const std::function<LogicalType(const std::string&)>& flat_type_of, std::string* flat_path,
+        const ColumnPredicate** output) const {
+    DCHECK(pool != nullptr);
+    DCHECK(output != nullptr);
+    *output = nullptr;
+    // more than one expr context means the predicate has been converted by cast, skip it
+    if (_expr_ctxs.size() != 1) {
+        return Status::OK();
+    }
+    ExprContext* ctx = _expr_ctxs[0];
+    Expr* root = ctx->root();
+    if (root->node_type() != TExprNodeType::BINARY_PRED || root->get_num_children() != 2) {
+        return Status::OK();
+    }
+
+    Expr* fn = root->get_child(0);
+    Expr* value = root->get_child(1);
+    TExprOpcode::type op = root->op();
+    if (fn->is_constant() && !value->is_constant()) {
+        // `literal <op> fn` => `fn <reversed op> literal`
+        std::swap(fn, value);
+        switch (op) {
+        case TExprOpcode::LT:
+            op = TExprOpcode::GT;
+            break;
+        case TExprOpcode::LE:
+            op = TExprOpcode::GE;
+            break;
+        case TExprOpcode::GT:
+            op = TExprOpcode::LT;
+            break;
+        case TExprOpcode::GE:
+            op = TExprOpcode::LE;
+            break;
+        default:
+            break;
+        }
+    }
+
+    PredicateType pred_type;
+    switch (op) {
+    case TExprOpcode::EQ:
+        pred_type = PredicateType::kEQ;
+        break;
+    case TExprOpcode::LT:
+        pred_type = PredicateType::kLT;
+        break;
+    case TExprOpcode::LE:
+        pred_type = PredicateType::kLE;
+        break;
+    case TExprOpcode::GT:
+        pred_type = PredicateType::kGT;
+        break;
+    case TExprOpcode::GE:
+        pred_type = PredicateType::kGE;
+        break;
+    default:
+        return Status::OK();
+    }
+
+    if (fn->node_type() != TExprNodeType::FUNCTION_CALL || !value->is_constant() || fn->get_num_children() != 2) {
+        return Status::OK();
+    }
+    auto* call = dynamic_cast<VectorizedFunctionCallExpr*>(fn);
+    if (call == nullptr || call->get_function_desc() == nullptr) {
+        return Status::OK();
+    }
+    const std::string fn_name = boost::to_lower_copy(call->get_function_desc()->name);
+    if (fn_name != "get_json_int" && fn_name != "get_json_double" && fn_name != "get_json_string") {
+        return Status::OK();
+    }
+    Expr* json_arg = fn->get_child(0);
+    Expr* path_arg = fn->get_child(1);
+    if (!json_arg->is_slotref() || json_arg->type().type != TYPE_JSON || !path_arg->is_constant()) {
+        return Status::OK();
+    }
+
+    // the sub-column must hold exactly what the function returns, e.g. get_json_int() returning INT would
+    // truncate a BIGINT sub-column and its min/max can't be used any more.
+    const LogicalType result_type = fn->type().type;
+    if (value->type().type != result_type) {
+        return Status::OK();
+    }
+
+    ASSIGN_OR_RETURN(ColumnPtr path_column, path_arg->evaluate_checked(ctx, nullptr));
+    if (path_column->empty() || path_column->is_null(0)) {
+        return Status::OK();
+    }
+    std::string name;
+    if (!json_path_to_flat_name(path_column->get(0).get_slice(), &name) || flat_type_of(name) != result_type) {
+        return Status::OK();
+    }
+
+    ASSIGN_OR_RETURN(ColumnPtr value_column, value->evaluate_checked(ctx, nullptr));
+    if (value_column->empty() || value_column->is_null(0)) {
+        return Status::OK();
+    }
+    auto type_info = get_type_info(result_type);
+    const std::string operand = datum_to_string(type_info.get(), value_column->get(0));
+    *output = pool->add(new_column_cmp_predicate(pred_type, type_info, _column_id, operand));
+    *flat_path = std::move(name);
+    return Status::OK();
+}
+
 Status ColumnExprPredicate::seek_inverted_index(const std::string& column_name, InvertedIndexIterator* iterator,
                                                 roaring::Roaring* row_bitmap) const {
     // Only support simple (NOT) LIKE/MATCH predicate for now
@@ -1,3 +1,5 @@
+#include <functional>
+#include <string>
 #include <utility>
 
 #include "exprs/expr.h"
@@ -61,6 +63,14 @@ public:
     // otherwise, it will contain one or more predicates which form the conjunction normal form
     Status try_to_rewrite_for_zone_map_filter(starrocks::ObjectPool* pool,
                                               std::vector<const ColumnExprPredicate*>* output) const;
+
+    // try to rewrite `get_json_int/double/string(json_col, '$.key') <op> <literal>` to an equivalent predicate on
+    // the flattened json sub-column `key`, so that its zone map and bloom filter can be used.
+    // |flat_type_of| returns the type of the flat sub-column with the given name, or TYPE_UNKNOWN if it's absent.
+    // output is only valid when returning Status::OK(), and it's nullptr if the conditions of rewriting are not met
+    Status try_to_rewrite_for_json_flat_column(ObjectPool* pool,
+                                               const std::function<LogicalType(const std::string&)>& flat_type_of,
+                                               std::string* flat_path, const ColumnPredicate** output) const;
     Status seek_inverted_index(const std::string& column_name, InvertedIndexIterator* iterator,
                                roaring::Roaring* row_bitmap) const override;
 
@@ -144,6 +144,7 @@ Status Compaction::do_compaction_impl() {
     } else {
         _tablet->set_last_base_compaction_success_time(now);
     }
+    _tablet->reset_read_stats();
 
     LOG(INFO) << "succeed to do " << compaction_name() << ". tablet=" << _tablet->tablet_id()
               << ", output_version=" << _output_version.first << "-" << _output_version.second
@@ -30,6 +30,8 @@ class CompactionPolicy;
 struct CompactionContext {
     double score = 0;
     CompactionType type = INVALID_COMPACTION;
+    // bytes of the input rowsets picked by the policy
+    int64_t input_bytes = 0;
     std::unique_ptr<CompactionPolicy> policy;
 };
 
@@ -344,7 +344,8 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
     if (tablet->need_compaction()) {
         CompactionCandidate candidate;
         candidate.tablet = tablet;
-        candidate.score = tablet->compaction_score();
+        // prefer tablets whose queries pay for many overlapping segments
+        candidate.score = tablet->compaction_score() * tablet->read_amp_score_factor();
         candidate.type = tablet->compaction_type();
         update_candidates({candidate});
     }
@@ -28,6 +28,9 @@ public:
     // used to judge whether a tablet should do compaction or not
     virtual bool need_compaction(double* score, CompactionType* type) = 0;
 
+    // total disk size of the input rowsets picked by the last need_compaction()
+    virtual int64_t input_rowsets_size() const = 0;
+
     // used to generate a CompactionTask for tablet
     virtual std::shared_ptr<CompactionTask> create_compaction(TabletSharedPtr tablet) = 0;
 };
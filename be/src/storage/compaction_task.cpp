@@ -14,14 +14,26 @@
 
 #include "storage/compaction_task.h"
 
+#include <algorithm>
 #include <sstream>
+#include <unordered_map>
 
+#include "column/datum_convert.h"
+#include "column/schema.h"
+#include "gen_cpp/segment.pb.h"
 #include "runtime/current_thread.h"
+#include "runtime/global_dict/types.h"
 #include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
 #include "storage/compaction_manager.h"
+#include "storage/merge_iterator.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
+#include "storage/rowset/segment.h"
 #include "storage/storage_engine.h"
+#include "storage/types.h"
+#include "util/defer_op.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
@@ -150,6 +162,7 @@ void CompactionTask::_success_callback() {
     set_compaction_task_state(COMPACTION_SUCCESS);
     // for compatible, update compaction time
     int64_t cost_time = UnixMillis() - _task_info.start_time;
+    _tablet->reset_read_stats();
     if (_task_info.compaction_type == CUMULATIVE_COMPACTION) {
         _tablet->set_last_cumu_compaction_success_time(UnixMillis());
         _tablet->set_last_cumu_compaction_failure_status(TStatusCode::OK);
@@ -257,4 +270,177 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
     return Status::OK();
 }
 
+namespace {
+
+// Sort key range of an input segment, from the segment zone map of the first sort key column
+struct SegmentKeyRange {
+    RowsetSharedPtr rowset;
+    uint32_t segment_id = 0;
+    Datum min;
+    Datum max;
+    int64_t size = 0;
+};
+
+} // namespace
+
+Status CompactionTask::_segment_reuse_compact(Statistics* statistics) {
+    // Linking a segment keeps its encoding as is, so the same restrictions as shortcut compaction apply,
+    // and separate index files are not linked.
+    if (_output_rowset != nullptr || !config::enable_compaction_segment_reuse ||
+        _tablet_schema->keys_type() != DUP_KEYS || !_tablet->enable_shortcut_compaction() ||
+        !_tablet_schema->indexes()->empty()) {
+        return Status::OK();
+    }
+    const auto& sort_key_idxes = _tablet_schema->sort_key_idxes();
+    const TabletColumn& key_column = _tablet_schema->column(sort_key_idxes.empty() ? 0 : sort_key_idxes[0]);
+    TypeInfoPtr type_info = get_type_info(delegate_type(key_column.type()));
+
+    std::vector<SegmentKeyRange> ranges;
+    for (const auto& rowset : _input_rowsets) {
+        if (rowset->rowset_meta()->has_delete_predicate() ||
+            rowset->schema()->schema_version() != _tablet_schema->schema_version()) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(rowset->load());
+        for (uint32_t i = 0; i < rowset->num_segments(); i++) {
+            const auto& segment = rowset->segments()[i];
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            // without a zone map the key range is unknown, nothing can be reused safely
+            const ColumnReader* reader = segment->column_with_uid(key_column.unique_id());
+            if (reader == nullptr || reader->segment_zone_map() == nullptr) {
+                return Status::OK();
+            }
+            const ZoneMapPB* zone_map = reader->segment_zone_map();
+            if (zone_map->has_null() || !zone_map->has_not_null()) {
+                return Status::OK();
+            }
+            SegmentKeyRange range;
+            range.rowset = rowset;
+            range.segment_id = i;
+            RETURN_IF_ERROR(datum_from_string(type_info.get(), &range.min, zone_map->min(), nullptr));
+            RETURN_IF_ERROR(datum_from_string(type_info.get(), &range.max, zone_map->max(), nullptr));
+            ASSIGN_OR_RETURN(range.size, segment->file_system()->get_file_size(segment->file_name()));
+            ranges.emplace_back(std::move(range));
+        }
+    }
+
+    std::sort(ranges.begin(), ranges.end(), [&](const SegmentKeyRange& lhs, const SegmentKeyRange& rhs) {
+        return type_info->cmp(lhs.min, rhs.min) < 0;
+    });
+    // Split the segments into groups of overlapping key ranges, the groups are disjoint and in key order.
+    // Equal bounds count as overlapping because only the first sort key column is compared.
+    // A group of one large segment is linked as is, all the other segments are merged.
+    std::vector<bool> reuse(ranges.size(), false);
+    size_t num_reused = 0;
+    for (size_t begin = 0; begin < ranges.size();) {
+        size_t end = begin + 1;
+        Datum group_max = ranges[begin].max;
+        while (end < ranges.size() && type_info->cmp(ranges[end].min, group_max) <= 0) {
+            if (type_info->cmp(ranges[end].max, group_max) > 0) {
+                group_max = ranges[end].max;
+            }
+            end++;
+        }
+        if (end == begin + 1 && ranges[begin].size >= config::compaction_segment_reuse_min_bytes) {
+            reuse[begin] = true;
+            num_reused++;
+        }
+        begin = end;
+    }
+    if (num_reused == 0) {
+        return Status::OK();
+    }
+
+    TRACE("[Compaction] start segment reuse compaction data");
+    int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
+            config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
+    std::unique_ptr<RowsetWriter> output_rs_writer;
+    RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
+            _tablet.get(), max_rows_per_segment, HORIZONTAL_COMPACTION, _task_info.output_version, _task_info.gtid,
+            &output_rs_writer, _tablet_schema));
+
+    Schema schema = ChunkHelper::convert_schema(_tablet_schema);
+    int32_t chunk_size = CompactionUtils::get_read_chunk_size(
+            config::compaction_memory_limit_per_worker, config::vector_chunk_size, _task_info.input_rows_num,
+            _task_info.input_rowsets_size, _task_info.segment_iterator_num);
+    OlapReaderStatistics stats;
+    std::unordered_map<Rowset*, std::vector<ChunkIteratorPtr>> rowset_iters;
+    std::vector<ChunkIteratorPtr> pending_iters;
+    for (size_t i = 0; i < ranges.size(); i++) {
+        auto& range = ranges[i];
+        if (!reuse[i]) {
+            auto& iters = rowset_iters[range.rowset.get()];
+            if (iters.empty()) {
+                ASSIGN_OR_RETURN(iters, range.rowset->get_segment_iterators2(schema, _tablet_schema, nullptr, 0,
+                                                                             &stats, nullptr, chunk_size));
+            }
+            pending_iters.emplace_back(iters[range.segment_id]);
+            continue;
+        }
+        RETURN_IF_ERROR(_merge_segments(pending_iters, schema, chunk_size, output_rs_writer.get()));
+        pending_iters.clear();
+        RETURN_IF_ERROR(output_rs_writer->link_segment(range.rowset, range.segment_id));
+    }
+    RETURN_IF_ERROR(_merge_segments(pending_iters, schema, chunk_size, output_rs_writer.get()));
+
+    StatusOr<RowsetSharedPtr> build_res = output_rs_writer->build();
+    if (!build_res.ok()) {
+        LOG(WARNING) << "rowset writer build failed. compaction task_id:" << _task_info.task_id
+                     << ", tablet:" << _task_info.tablet_id << " output_version=" << _task_info.output_version;
+        return build_res.status();
+    }
+    _output_rowset = build_res.value();
+    _task_info.output_num_rows = _output_rowset->num_rows();
+    _task_info.output_segments_num = _output_rowset->num_segments();
+    _task_info.output_rowset_size = _output_rowset->data_disk_size();
+    _task_info.reused_segments_num = num_reused;
+    TRACE_COUNTER_INCREMENT("reused_segments_num", num_reused);
+    TRACE_COUNTER_INCREMENT("output_rowset_data_size", _output_rowset->data_disk_size());
+    TRACE_COUNTER_INCREMENT("output_segments_num", _output_rowset->num_segments());
+    TRACE("[Compaction] output rowset built");
+
+    if (statistics) {
+        statistics->output_rows = _output_rowset->num_rows();
+        statistics->merged_rows = 0;
+        statistics->filtered_rows = 0;
+    }
+
+    if (config::enable_rowset_verify) {
+        RETURN_IF_ERROR(_output_rowset->verify());
+    }
+    return Status::OK();
+}
+
+Status CompactionTask::_merge_segments(const std::vector<ChunkIteratorPtr>& seg_iters, const Schema& schema,
+                                       int32_t chunk_size, RowsetWriter* output_rs_writer) {
+    if (seg_iters.empty()) {
+        return Status::OK();
+    }
+    auto iter = new_heap_merge_iterator(seg_iters);
+    RETURN_IF_ERROR(iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS));
+    DeferOp close_iter([&] { iter->close(); });
+
+    auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    while (true) {
+        if (should_stop()) {
+            return Status::Cancelled("compaction task is stopped.");
+        }
+#ifndef BE_TEST
+        RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("Compaction"));
+#endif
+        chunk->reset();
+        auto st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk.get());
+        RETURN_IF_ERROR(output_rs_writer->add_chunk(*chunk));
+    }
+    return output_rs_writer->flush();
+}
+
 } // namespace starrocks
@@ -29,6 +29,9 @@
 
 namespace starrocks {
 
+class RowsetWriter;
+class Schema;
+
 enum CompactionTaskState { COMPACTION_INIT, COMPACTION_RUNNING, COMPACTION_FAILED, COMPACTION_SUCCESS };
 
 static const char* compaction_state_to_string(CompactionTaskState state) {
@@ -70,6 +73,7 @@ struct CompactionTaskInfo {
     size_t output_num_rows{0};
     CompactionType compaction_type{CompactionType::INVALID_COMPACTION};
     bool is_shortcut_compaction{false};
+    size_t reused_segments_num{0};
     bool is_manual_compaction{false};
 
     // for vertical compaction
@@ -122,6 +126,7 @@ struct CompactionTaskInfo {
         ss << ", total_merged_rows:" << total_merged_rows;
         ss << ", total_del_filtered_rows:" << total_del_filtered_rows;
         ss << ", is_shortcut_compaction:" << is_shortcut_compaction;
+        ss << ", reused_segments_num:" << reused_segments_num;
         ss << ", is_manual_compaction:" << is_manual_compaction;
         ss << ", progress:" << get_progress();
         return ss.str();
@@ -220,6 +225,8 @@ public:
 
     bool is_shortcut_compaction() const { return _task_info.is_shortcut_compaction; }
 
+    size_t reused_segments_num() const { return _task_info.reused_segments_num; }
+
     bool is_manual_compaction() const { return _task_info.is_manual_compaction; }
 
     void set_is_manual_compaction(bool is_manual_compaction) { _task_info.is_manual_compaction = is_manual_compaction; }
@@ -299,6 +306,13 @@ protected:
 
     Status _shortcut_compact(Statistics* statistics);
 
+    // for duplicate key tablets, link input segments whose key range does not overlap any other input
+    // segment into the output rowset, and merge the rest.
+    Status _segment_reuse_compact(Statistics* statistics);
+
+    Status _merge_segments(const std::vector<ChunkIteratorPtr>& seg_iters, const Schema& schema, int32_t chunk_size,
+                           RowsetWriter* output_rs_writer);
+
 protected:
     CompactionTaskInfo _task_info;
     RuntimeProfile _runtime_profile;
@@ -55,6 +55,22 @@ bool DefaultCumulativeBaseCompactionPolicy::need_compaction(double* score, Compa
     return _compaction_type != INVALID_COMPACTION;
 }
 
+int64_t DefaultCumulativeBaseCompactionPolicy::input_rowsets_size() const {
+    const std::vector<RowsetSharedPtr>* rowsets = nullptr;
+    if (_compaction_type == CUMULATIVE_COMPACTION) {
+        rowsets = &_cumulative_rowsets;
+    } else if (_compaction_type == BASE_COMPACTION) {
+        rowsets = &_base_rowsets;
+    } else {
+        return 0;
+    }
+    int64_t size = 0;
+    for (const auto& rowset : *rowsets) {
+        size += rowset->data_disk_size();
+    }
+    return size;
+}
+
 std::shared_ptr<CompactionTask> DefaultCumulativeBaseCompactionPolicy::create_compaction(TabletSharedPtr tablet) {
     if (_compaction_type == CUMULATIVE_COMPACTION) {
         Version output_version;
@@ -34,6 +34,7 @@ namespace starrocks {
 Status HorizontalCompactionTask::run_impl() {
     Statistics statistics;
     RETURN_IF_ERROR(_shortcut_compact(&statistics));
+    RETURN_IF_ERROR(_segment_reuse_compact(&statistics));
     RETURN_IF_ERROR(_horizontal_compact_data(&statistics));
 
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
@@ -0,0 +1,136 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/json_flat_path_stats.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+JsonFlatPathStats::JsonFlatPathStats() = default;
+JsonFlatPathStats::~JsonFlatPathStats() = default;
+
+void JsonFlatPathStats::record_reads(int64_t tablet_id, int32_t column_uid, const std::vector<std::string>& paths,
+                                     const std::vector<bool>& from_flat) {
+    DCHECK_EQ(paths.size(), from_flat.size());
+    if (paths.empty()) {
+        return;
+    }
+    const int64_t now = UnixSeconds();
+    auto& shard = _shard(tablet_id);
+    std::lock_guard lock(shard.mutex);
+    auto& stats = shard.tablets[tablet_id];
+    auto& column_stats = stats.columns[column_uid];
+    _decay(&column_stats, now);
+    for (size_t i = 0; i < paths.size(); i++) {
+        _add_path_read(&column_stats, paths[i]);
+        column_stats.total_reads++;
+        stats.total_reads++;
+        stats.flat_reads += from_flat[i];
+    }
+}
+
+void JsonFlatPathStats::_decay(ColumnStats* stats, int64_t now) {
+    const int64_t interval = config::json_flat_hot_path_decay_interval_sec;
+    if (stats->decay_time_s == 0 || interval <= 0) {
+        stats->decay_time_s = now;
+        return;
+    }
+    const int64_t periods = (now - stats->decay_time_s) / interval;
+    if (periods <= 0) {
+        return;
+    }
+    stats->decay_time_s += periods * interval;
+    const int shift = static_cast<int>(std::min<int64_t>(periods, 62));
+    for (auto iter = stats->path_reads.begin(); iter != stats->path_reads.end();) {
+        iter->second >>= shift;
+        if (iter->second == 0) {
+            iter = stats->path_reads.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    stats->total_reads >>= shift;
+}
+
+void JsonFlatPathStats::_add_path_read(ColumnStats* stats, const std::string& path) {
+    auto iter = stats->path_reads.find(path);
+    if (iter != stats->path_reads.end()) {
+        iter->second++;
+        return;
+    }
+    if (stats->path_reads.size() < kMaxTrackedPaths) {
+        stats->path_reads.emplace(path, 1);
+        return;
+    }
+    auto min_iter = std::min_element(stats->path_reads.begin(), stats->path_reads.end(),
+                                     [](const auto& a, const auto& b) { return a.second < b.second; });
+    const int64_t reads = min_iter->second + 1;
+    stats->path_reads.erase(min_iter);
+    stats->path_reads.emplace(path, reads);
+}
+
+std::vector<std::string> JsonFlatPathStats::hot_paths(int64_t tablet_id, int32_t column_uid, size_t limit) const {
+    std::vector<std::pair<std::string, int64_t>> candidates;
+    {
+        const auto& shard = _shard(tablet_id);
+        std::lock_guard lock(shard.mutex);
+        auto iter = shard.tablets.find(tablet_id);
+        if (iter == shard.tablets.end()) {
+            return {};
+        }
+        auto column_iter = iter->second.columns.find(column_uid);
+        if (column_iter == iter->second.columns.end() || column_iter->second.total_reads == 0) {
+            return {};
+        }
+        const auto& stats = column_iter->second;
+        const double min_reads = stats.total_reads * config::json_flat_hot_path_min_ratio;
+        for (const auto& [path, reads] : stats.path_reads) {
+            if (reads >= min_reads) {
+                candidates.emplace_back(path, reads);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+
+    std::vector<std::string> result;
+    for (size_t i = 0; i < candidates.size() && i < limit; i++) {
+        result.emplace_back(std::move(candidates[i].first));
+    }
+    return result;
+}
+
+double JsonFlatPathStats::flat_read_ratio(int64_t tablet_id) const {
+    const auto& shard = _shard(tablet_id);
+    std::lock_guard lock(shard.mutex);
+    auto iter = shard.tablets.find(tablet_id);
+    if (iter == shard.tablets.end() || iter->second.total_reads == 0) {
+        return -1;
+    }
+    return static_cast<double>(iter->second.flat_reads) / iter->second.total_reads;
+}
+
+void JsonFlatPathStats::erase(int64_t tablet_id) {
+    auto& shard = _shard(tablet_id);
+    std::lock_guard lock(shard.mutex);
+    shard.tablets.erase(tablet_id);
+}
+
+} // namespace starrocks
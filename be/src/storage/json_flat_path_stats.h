@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/olap_define.h"
+
+namespace starrocks {
+
+// Tablet-level access statistics of json paths.
+//
+// Json functions like `get_json_int(c, '$.a')` are pushed down to the scan as column access paths. Every
+// time a segment iterator is created for such a json column, the accessed paths are recorded here together
+// with whether they are served by a flattened sub-column of that segment or by parsing the whole json.
+//
+// Because JsonFlattener derives the flat paths from the data of each write, segments of one tablet may
+// flatten different paths. The writers use `hot_paths()` to prefer the paths which are actually read, so
+// that compaction converges the segments of a tablet to the same flat schema.
+class JsonFlatPathStats {
+    DECLARE_SINGLETON(JsonFlatPathStats);
+
+public:
+    // |from_flat[i]| tells whether |paths[i]| of the json column |column_uid| is read from a flattened sub-column.
+    void record_reads(int64_t tablet_id, int32_t column_uid, const std::vector<std::string>& paths,
+                      const std::vector<bool>& from_flat);
+
+    // Return at most |limit| paths of the json column, most accessed first. A path is hot if it accounts for
+    // at least `json_flat_hot_path_min_ratio` of all the path reads of the column.
+    std::vector<std::string> hot_paths(int64_t tablet_id, int32_t column_uid, size_t limit) const;
+
+    // Fraction of the json path reads served from flattened sub-columns, -1 if nothing is recorded.
+    double flat_read_ratio(int64_t tablet_id) const;
+
+    void erase(int64_t tablet_id);
+
+private:
+    // bound the memory used by a json column with a lot of distinct paths. When all of them are tracked, a new
+    // path replaces the least read one and inherits its count (space-saving), so a path read more than
+    // 1/kMaxTrackedPaths of the time is always tracked.
+    static constexpr size_t kMaxTrackedPaths = 256;
+    static constexpr size_t kNumShards = 32;
+
+    struct ColumnStats {
+        std::unordered_map<std::string, int64_t> path_reads;
+        int64_t total_reads = 0;
+        // unix seconds of the last decay, 0 before the first read
+        int64_t decay_time_s = 0;
+    };
+
+    // halve the counts for every `json_flat_hot_path_decay_interval_sec` elapsed since the last decay,
+    // and forget the paths whose count drops to 0.
+    static void _decay(ColumnStats* stats, int64_t now);
+
+    static void _add_path_read(ColumnStats* stats, const std::string& path);
+
+    struct TabletStats {
+        std::unordered_map<int32_t, ColumnStats> columns;
+        int64_t total_reads = 0;
+        int64_t flat_reads = 0;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<int64_t, TabletStats> tablets;
+    };
+
+    Shard& _shard(int64_t tablet_id) { return _shards[static_cast<uint64_t>(tablet_id) % kNumShards]; }
+    const Shard& _shard(int64_t tablet_id) const { return _shards[static_cast<uint64_t>(tablet_id) % kNumShards]; }
+
+    std::array<Shard, kNumShards> _shards;
+};
+
+} // namespace starrocks
@@ -325,13 +325,10 @@ Status Rowset::load_segments(std::vector<SegmentPtr>* segments, const LakeIOOpti
                 // try load segment serially
                 LOG(WARNING) << "sumbit_func failed: " << st.code_as_string()
                              << ", try to load segment serially, seg_id: " << seg_id;
-                auto segment_or = _tablet_mgr->load_segment(segment_info, seg_id, &footer_size_hint, lake_io_opts,
-                                                            fill_metadata_cache, _tablet_schema);
-                if (auto status = check_status(segment_or, seg_name); !status.ok()) {
-                    return status;
-                }
+                (*task)();
             }
             seg_id++;
+            // keep the segments in order even if some of them are loaded serially
             segment_futures.push_back(task->get_future());
         } else {
             auto segment_or = _tablet_mgr->load_segment(segment_info, seg_id++, &footer_size_hint, lake_io_opts,
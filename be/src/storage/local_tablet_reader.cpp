@@ -14,16 +14,20 @@
 
 #include "storage/local_tablet_reader.h"
 
+#include "column/binary_column.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "serde/protobuf_serde.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_index.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/projection_iterator.h"
+#include "storage/row_cache.h"
+#include "storage/row_store_encoder_factory.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
 
 namespace starrocks {
 
@@ -110,18 +114,40 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
 
     // convert keys to pk single column format
     const auto& tablet_schema = _tablet->tablet_schema();
-    vector<uint32_t> pk_columns;
-    for (size_t i = 0; i < tablet_schema->num_key_columns(); i++) {
-        pk_columns.push_back((uint32_t)i);
-    }
     std::unique_ptr<Column> pk_column;
     RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(*tablet_schema->schema(), &pk_column));
     PrimaryKeyEncoder::encode(*tablet_schema->schema(), keys, 0, keys.num_rows(), pk_column.get());
 
+    std::vector<std::unique_ptr<Column>> read_columns;
+    auto* row_cache = StorageEngine::instance()->update_manager()->row_cache();
+    if (_can_use_row_cache(row_cache, value_column_ids)) {
+        RETURN_IF_ERROR(_multi_get_with_row_cache(row_cache, *pk_column, value_column_ids, found, &read_columns));
+    } else {
+        RETURN_IF_ERROR(_multi_get_from_storage(*pk_column, value_column_ids, found, &read_columns));
+    }
+
+    // put read values into values output parameter, they are already in input keys' order
+    values.reset();
+    for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
+        values.get_column_by_index(col_idx)->append(*read_columns[col_idx]);
+    }
+    int64_t t_end = MonotonicMillis();
+    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
+                                     _tablet->tablet_id(), _version, value_column_ids.size(), n,
+                                     std::count(found.begin(), found.end(), true), t_end - t_start);
+    return Status::OK();
+}
+
+Status LocalTabletReader::_multi_get_from_storage(const Column& pks, const std::vector<uint32_t>& column_ids,
+                                                  std::vector<bool>& found,
+                                                  std::vector<std::unique_ptr<Column>>* columns) {
+    size_t n = pks.size();
+    const auto& tablet_schema = _tablet->tablet_schema();
+
     // search pks in pk index to get rowids
     EditVersion edit_version;
     std::vector<uint64_t> rowids(n);
-    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
+    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), pks, &edit_version, &rowids));
     if (edit_version.major_number() != _version) {
         return Status::InternalError(
                 strings::Substitute("multi_get version not match tablet:$0 current_version:$1 read_version:$2",
@@ -137,23 +163,147 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
     vector<uint32_t> idxes;
     plan_read_by_rssid(rowids, found, rowids_by_rssid, idxes);
 
-    auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, value_column_ids);
-    std::vector<std::unique_ptr<Column>> read_columns(value_column_ids.size());
+    auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, column_ids);
+    std::vector<std::unique_ptr<Column>> read_columns(column_ids.size());
     for (uint32_t i = 0; i < read_columns.size(); ++i) {
         read_columns[i] = ChunkHelper::column_from_field(*read_column_schema.field(i).get())->clone_empty();
     }
-    RETURN_IF_ERROR(_tablet->updates()->get_column_values(value_column_ids, _version, false, rowids_by_rssid,
+    RETURN_IF_ERROR(_tablet->updates()->get_column_values(column_ids, _version, false, rowids_by_rssid,
                                                           &read_columns, nullptr, tablet_schema));
 
-    // reorder read values to input keys' order and put into values output parameter
-    values.reset();
-    for (size_t col_idx = 0; col_idx < value_column_ids.size(); col_idx++) {
-        values.get_column_by_index(col_idx)->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
+    // reorder read values to input keys' order
+    columns->resize(column_ids.size());
+    for (size_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+        (*columns)[col_idx] = read_columns[col_idx]->clone_empty();
+        (*columns)[col_idx]->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
+    }
+    return Status::OK();
+}
+
+bool LocalTabletReader::_can_use_row_cache(RowCache* row_cache, const std::vector<uint32_t>& column_ids) const {
+    if (!row_cache->enabled() || column_ids.empty()) {
+        return false;
+    }
+    // only value columns are cached
+    const auto& tablet_schema = _tablet->tablet_schema();
+    for (auto cid : column_ids) {
+        if (cid < tablet_schema->num_key_columns() || cid >= _num_value_columns_end()) {
+            return false;
+        }
+    }
+    auto row_encoder = RowStoreEncoderFactory::instance()->get_or_create_encoder(SIMPLE);
+    return row_encoder->is_supported(*tablet_schema->schema()).ok();
+}
+
+size_t LocalTabletReader::_num_value_columns_end() const {
+    // the full row column of row store is the last column
+    size_t num_columns = _tablet->tablet_schema()->num_columns();
+    return _tablet->is_column_with_row_store() ? num_columns - 1 : num_columns;
+}
+
+Status LocalTabletReader::_multi_get_with_row_cache(RowCache* row_cache, const Column& pks,
+                                                    const std::vector<uint32_t>& column_ids, std::vector<bool>& found,
+                                                    std::vector<std::unique_ptr<Column>>* columns) {
+    // cached rows are the latest rows of the tablet
+    if (_tablet->updates()->max_readable_version() != _version) {
+        return _multi_get_from_storage(pks, column_ids, found, columns);
+    }
+    const auto& tablet_schema = _tablet->tablet_schema();
+    const int64_t tablet_id = _tablet->tablet_id();
+    const int32_t schema_version = tablet_schema->schema_version();
+    // must be taken before reading from storage
+    const int64_t sequence = row_cache->tablet_sequence(tablet_id);
+    std::vector<bool> hits;
+    std::vector<std::string> rows;
+    size_t num_hits = row_cache->lookup(tablet_id, schema_version, pks, &hits, &rows);
+    if (_tablet->updates()->max_readable_version() != _version) {
+        return _multi_get_from_storage(pks, column_ids, found, columns);
+    }
+
+    // all value columns are read, so that the rows of missed keys can be cached
+    const size_t num_key_columns = tablet_schema->num_key_columns();
+    std::vector<uint32_t> value_column_ids;
+    for (uint32_t cid = num_key_columns; cid < _num_value_columns_end(); cid++) {
+        value_column_ids.push_back(cid);
+    }
+    auto value_schema = ChunkHelper::convert_schema(tablet_schema, value_column_ids);
+    auto row_encoder = RowStoreEncoderFactory::instance()->get_or_create_encoder(SIMPLE);
+
+    std::vector<std::unique_ptr<Column>> hit_columns(value_column_ids.size());
+    for (size_t i = 0; i < value_column_ids.size(); i++) {
+        hit_columns[i] = ChunkHelper::column_from_field(*value_schema.field(i).get())->clone_empty();
+    }
+    if (num_hits > 0) {
+        BinaryColumn hit_rows;
+        hit_rows.reserve(num_hits);
+        for (size_t i = 0; i < pks.size(); i++) {
+            if (hits[i]) {
+                hit_rows.append(Slice(rows[i]));
+            }
+        }
+        RETURN_IF_ERROR(row_encoder->decode_columns_from_full_row_column(*tablet_schema->schema(), hit_rows,
+                                                                         value_column_ids, &hit_columns));
+    }
+
+    std::vector<uint32_t> miss_idxes;
+    for (uint32_t i = 0; i < pks.size(); i++) {
+        if (!hits[i]) {
+            miss_idxes.push_back(i);
+        }
+    }
+    std::vector<bool> miss_found(miss_idxes.size(), false);
+    Columns miss_columns;
+    if (!miss_idxes.empty()) {
+        auto miss_pks = pks.clone_empty();
+        miss_pks->append_selective(pks, miss_idxes.data(), 0, miss_idxes.size());
+        std::vector<std::unique_ptr<Column>> read_columns;
+        RETURN_IF_ERROR(_multi_get_from_storage(*miss_pks, value_column_ids, miss_found, &read_columns));
+        for (auto& column : read_columns) {
+            miss_columns.emplace_back(std::move(column));
+        }
+
+        std::vector<uint32_t> found_idxes;
+        for (uint32_t i = 0; i < miss_found.size(); i++) {
+            if (miss_found[i]) {
+                found_idxes.push_back(i);
+            }
+        }
+        if (!found_idxes.empty()) {
+            auto found_pks = miss_pks->clone_empty();
+            found_pks->append_selective(*miss_pks, found_idxes.data(), 0, found_idxes.size());
+            BinaryColumn found_rows;
+            RETURN_IF_ERROR(
+                    row_encoder->encode_columns_to_full_row_column(*tablet_schema->schema(), miss_columns, found_rows));
+            row_cache->insert(tablet_id, schema_version, sequence, *found_pks, found_rows);
+        }
+    }
+
+    // merge rows of hit and missed keys in input keys' order, rows of missed keys are after rows of hit keys.
+    found.assign(pks.size(), false);
+    std::vector<uint32_t> idxes;
+    uint32_t hit_pos = 0;
+    uint32_t miss_pos = 0;
+    uint32_t miss_found_pos = 0;
+    for (size_t i = 0; i < pks.size(); i++) {
+        if (hits[i]) {
+            found[i] = true;
+            idxes.push_back(hit_pos++);
+        } else if (miss_found[miss_pos++]) {
+            found[i] = true;
+            idxes.push_back(num_hits + miss_found_pos++);
+        }
+    }
+    columns->resize(column_ids.size());
+    for (size_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+        size_t value_idx = column_ids[col_idx] - num_key_columns;
+        auto merged = hit_columns[value_idx]->clone_empty();
+        merged->append(*hit_columns[value_idx]);
+        if (!miss_columns.empty()) {
+            merged->append(*miss_columns[value_idx]);
+        }
+        (*columns)[col_idx] = merged->clone_empty();
+        (*columns)[col_idx]->append_selective(*merged, idxes.data(), 0, idxes.size());
     }
-    int64_t t_end = MonotonicMillis();
-    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
-                                     _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
-                                     t_end - t_start);
     return Status::OK();
 }
 
@@ -20,6 +20,7 @@
 namespace starrocks {
 
 class ColumnPredicate;
+class RowCache;
 class PTabletReaderMultiGetRequest;
 class PTabletReaderMultiGetResult;
 
@@ -46,6 +47,16 @@ public:
                                     const std::vector<const ColumnPredicate*>& predicates);
 
 private:
+    // read values of encoded primary keys `pks` from storage, values of found keys are in the order of `pks`.
+    Status _multi_get_from_storage(const Column& pks, const std::vector<uint32_t>& column_ids, std::vector<bool>& found,
+                                   std::vector<std::unique_ptr<Column>>* columns);
+    // same as _multi_get_from_storage, but lookup the row cache first, and cache the rows read from storage.
+    Status _multi_get_with_row_cache(RowCache* row_cache, const Column& pks, const std::vector<uint32_t>& column_ids,
+                                     std::vector<bool>& found, std::vector<std::unique_ptr<Column>>* columns);
+    bool _can_use_row_cache(RowCache* row_cache, const std::vector<uint32_t>& column_ids) const;
+    // value columns are [num_key_columns, _num_value_columns_end())
+    size_t _num_value_columns_end() const;
+
     TabletSharedPtr _tablet;
     int64_t _version{0};
 };
@@ -75,6 +75,57 @@ void MemTable::_init_aggregator_if_needed() {
     }
 }
 
+void MemTable::_init_sorted_input_check_if_needed() {
+    // The rows of primary key tables are deduplicated by the primary key instead of the sort key,
+    // and may carry deletes, so they always go through the sort.
+    if (!config::enable_memtable_sorted_input_fast_path || _keys_type == KeysType::PRIMARY_KEYS) {
+        return;
+    }
+    // The same sort key columns as _sort_column_inc().
+    _sorted_input_key_idxes = _vectorized_schema->sort_key_idxes();
+    if (_sorted_input_key_idxes.empty()) {
+        for (ColumnId i = 0; i < _vectorized_schema->num_key_fields(); ++i) {
+            _sorted_input_key_idxes.push_back(i);
+        }
+    }
+    if (_keys_type != KeysType::DUP_KEYS) {
+        // The rows are aggregated by the key columns, so the order of the sort key tells the duplicate
+        // keys only if the sort key columns are the key columns. Leave the other cases to the sort,
+        // which reports the error.
+        std::vector<ColumnId> tmp = _sorted_input_key_idxes;
+        std::sort(tmp.begin(), tmp.end());
+        std::vector<ColumnId> key_idxes(_vectorized_schema->num_key_fields());
+        std::iota(key_idxes.begin(), key_idxes.end(), 0);
+        if (tmp != key_idxes) {
+            return;
+        }
+    }
+    _sorted_input = true;
+}
+
+void MemTable::_check_sorted_input(size_t from) {
+    // The order is strict for the tables which aggregate the rows of the same key.
+    const int max_cmp = _keys_type == KeysType::DUP_KEYS ? 0 : -1;
+    const size_t num_rows = _chunk->num_rows();
+    for (size_t row = std::max<size_t>(from, 1); row < num_rows; ++row) {
+        int cmp = 0;
+        for (ColumnId idx : _sorted_input_key_idxes) {
+            const ColumnPtr& column = _chunk->get_column_by_index(idx);
+            // nulls first, the same as _sort_column_inc()
+            cmp = column->compare_at(row - 1, row, *column, -1);
+            if (cmp != 0) {
+                break;
+            }
+        }
+        if (cmp > max_cmp) {
+            _sorted_input = false;
+            VLOG(2) << "memtable of tablet " << _tablet_id << " finds row " << row
+                    << " out of order, fall back to sort";
+            return;
+        }
+    }
+}
+
 MemTable::MemTable(int64_t tablet_id, const Schema* schema, const std::vector<SlotDescriptor*>* slot_descs,
                    MemTableSink* sink, std::string merge_condition, MemTracker* mem_tracker)
         : _tablet_id(tablet_id),
@@ -90,6 +141,7 @@ MemTable::MemTable(int64_t tablet_id, const Schema* schema, const std::vector<Sl
         _has_op_slot = true;
     }
     _init_aggregator_if_needed();
+    _init_sorted_input_check_if_needed();
 }
 
 MemTable::MemTable(int64_t tablet_id, const Schema* schema, const std::vector<SlotDescriptor*>* slot_descs,
@@ -106,6 +158,7 @@ MemTable::MemTable(int64_t tablet_id, const Schema* schema, const std::vector<Sl
         _has_op_slot = true;
     }
     _init_aggregator_if_needed();
+    _init_sorted_input_check_if_needed();
 }
 
 MemTable::MemTable(int64_t tablet_id, const Schema* schema, MemTableSink* sink, int64_t max_buffer_size,
@@ -119,6 +172,7 @@ MemTable::MemTable(int64_t tablet_id, const Schema* schema, MemTableSink* sink,
           _max_buffer_size(max_buffer_size),
           _mem_tracker(mem_tracker) {
     _init_aggregator_if_needed();
+    _init_sorted_input_check_if_needed();
 }
 
 MemTable::~MemTable() = default;
@@ -215,6 +269,11 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         }
     }
 
+    if (_sorted_input) {
+        // Compare the first new row with the last old one as well.
+        _check_sorted_input(cur_row_count);
+    }
+
     if (chunk.has_rows()) {
         _chunk_memory_usage += chunk.memory_usage() * size / chunk.num_rows();
         _chunk_bytes_usage += _chunk->bytes_usage(cur_row_count, size);
@@ -224,7 +283,8 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
     // if memtable is full, push it to the flush executor,
     // and create a new memtable for incoming data
     bool suggest_flush = false;
-    if (is_full()) {
+    // The rows in order have no duplicate keys to aggregate in advance.
+    if (is_full() && !_sorted_input) {
         size_t orig_bytes = write_buffer_size();
         RETURN_IF_ERROR(_merge());
         size_t new_bytes = write_buffer_size();
@@ -252,7 +312,18 @@ Status MemTable::finalize() {
     {
         SCOPED_RAW_TIMER(&duration_ns);
 
-        if (_keys_type != KeysType::DUP_KEYS) {
+        if (_sorted_input) {
+            // The rows are in order, and have no duplicate keys if the keys are aggregated,
+            // so they are flushed as they are.
+            DCHECK_EQ(0, _merge_count);
+            _result_chunk = std::move(_chunk);
+            _chunk_memory_usage = 0;
+            _chunk_bytes_usage = 0;
+            _aggregator.reset();
+            _aggregator_memory_usage = 0;
+            _aggregator_bytes_usage = 0;
+            StarRocksMetrics::instance()->memtable_sorted_input_total.increment(1);
+        } else if (_keys_type != KeysType::DUP_KEYS) {
             if (_chunk->num_rows() > 0) {
                 // merge last undo merge
                 RETURN_IF_ERROR(_merge());
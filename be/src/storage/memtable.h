@@ -71,6 +71,10 @@ public:
 
     bool check_supported_column_partial_update(const Chunk& chunk);
 
+    // Whether all the rows inserted so far are in the order of the sort key, see
+    // config::enable_memtable_sorted_input_fast_path.
+    bool is_sorted_input() const { return _sorted_input; }
+
 private:
     Status _merge();
 
@@ -81,6 +85,10 @@ private:
     void _init_aggregator_if_needed();
     void _aggregate(bool is_final);
 
+    void _init_sorted_input_check_if_needed();
+    // Check whether the rows of _chunk starting from |from| keep the order of the sort key.
+    void _check_sorted_input(size_t from);
+
     Status _split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::unique_ptr<Column>* deletes);
 
     ChunkPtr _chunk;
@@ -104,6 +112,11 @@ private:
 
     uint64_t _merge_count = 0;
 
+    // The rows in order are flushed as they are, without being sorted or aggregated. The order must be
+    // strict for the tables which aggregate the rows of the same key.
+    bool _sorted_input = false;
+    std::vector<ColumnId> _sorted_input_key_idxes;
+
     bool _has_op_slot = false;
     std::unique_ptr<Column> _deletes;
 
@@ -230,6 +230,8 @@ struct OlapReaderStatistics {
     int64_t late_materialize_ns = 0;
 
     int64_t raw_rows_read = 0;
+    // rows read through a merge iterator over more than one segment
+    int64_t rows_merged = 0;
 
     int64_t rows_vec_cond_filtered = 0;
     int64_t vec_cond_ns = 0;
@@ -14,12 +14,15 @@
 
 #include "storage/primary_index.h"
 
+#include <functional>
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/tracer.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
+#include "runtime/current_thread.h"
 #include "runtime/large_int_value.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_dump.h"
@@ -29,14 +32,97 @@
 #include "storage/tablet.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
+#include "util/crc32c.h"
+#include "util/raw_container.h"
 #include "util/stack_util.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 #include "util/xxh3.h"
 
 namespace starrocks {
 
 using tablet_rowid_t = PrimaryIndex::tablet_rowid_t;
 
+// phmap archive serializing the snapshot of in-memory index to a buffer, the checksum of content is computed along.
+// The buffer is written to the file later, so that the index is not blocked by file io.
+class IndexSnapshotWriter {
+public:
+    explicit IndexSnapshotWriter(std::string* buffer) : _buffer(buffer) {}
+
+    bool dump(const char* p, size_t sz) {
+        _checksum = crc32c::Extend(_checksum, p, sz);
+        _buffer->append(p, sz);
+        return true;
+    }
+
+    template <typename V>
+    bool dump(const V& v) {
+        static_assert(std::is_trivially_copyable_v<V>, "V should be trivially copyable");
+        return dump(reinterpret_cast<const char*>(&v), sizeof(V));
+    }
+
+    // append the checksum of content
+    void finish() { _buffer->append(reinterpret_cast<const char*>(&_checksum), sizeof(_checksum)); }
+
+private:
+    std::string* _buffer;
+    uint32_t _checksum = 0;
+};
+
+// phmap archive reading the snapshot of in-memory index from a file.
+class IndexSnapshotReader {
+public:
+    explicit IndexSnapshotReader(SequentialFile* file) : _file(file) {
+        raw::stl_string_resize_uninitialized(&_buffer, kBufferSize);
+    }
+
+    bool load(char* p, size_t sz) {
+        while (sz > 0 && _status.ok()) {
+            if (_pos == _limit) {
+                if (sz >= kBufferSize) {
+                    _status = _file->read_fully(p, sz);
+                    break;
+                }
+                auto res = _file->read(_buffer.data(), kBufferSize);
+                if (!res.ok()) {
+                    _status = res.status();
+                    break;
+                }
+                if (*res == 0) {
+                    _status = Status::Corruption("unexpected end of primary index snapshot");
+                    break;
+                }
+                _pos = 0;
+                _limit = *res;
+            }
+            size_t n = std::min(sz, _limit - _pos);
+            memcpy(p, _buffer.data() + _pos, n);
+            _pos += n;
+            p += n;
+            sz -= n;
+        }
+        return _status.ok();
+    }
+
+    template <typename V>
+    bool load(V* v) {
+        static_assert(std::is_trivially_copyable_v<V>, "V should be trivially copyable");
+        return load(reinterpret_cast<char*>(v), sizeof(V));
+    }
+
+    const Status& status() const { return _status; }
+
+private:
+    static constexpr size_t kBufferSize = 1024 * 1024;
+
+    SequentialFile* _file;
+    std::string _buffer;
+    size_t _pos = 0;
+    size_t _limit = 0;
+    Status _status;
+};
+
 class HashIndex {
 public:
     using DeletesMap = PrimaryIndex::DeletesMap;
@@ -57,6 +143,15 @@ public:
     virtual void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, uint32_t idx_begin, uint32_t idx_end,
                         DeletesMap* deletes) = 0;
 
+    // split keys of a range [idx_begin, idx_end) into PARALLEL_UPSERT_NUM_PARTS parts, one for each submap, so that
+    // parts can be upserted concurrently. Must be called before the upsert of parts, indexes of each part are in
+    // ascending order.
+    virtual void partition(const Column& pks, uint32_t idx_begin, uint32_t idx_end,
+                           std::vector<std::vector<uint32_t>>* parts) = 0;
+    // batch upsert keys at |idxes|
+    virtual void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, const std::vector<uint32_t>& idxes,
+                        DeletesMap* deletes) = 0;
+
     // replace values, return error if not exist. replace a range [indexes[idx_begin], indexes[idx_end-1]]
     virtual Status replace(uint32_t rssid, uint32_t rowid_start, const std::vector<uint32_t>& indexes,
                            uint32_t idx_begin, uint32_t idx_end, const Column& pks) = 0;
@@ -77,6 +172,13 @@ public:
     virtual std::size_t memory_usage() const = 0;
 
     virtual Status pk_dump(PrimaryKeyDump* dump, PrimaryIndexDumpPB* dump_pb) = 0;
+
+    // dump all entries to the snapshot, and load them back
+    virtual bool dump(IndexSnapshotWriter* ar) const = 0;
+    virtual bool load(IndexSnapshotReader* ar) = 0;
+
+    // erase entries whose value(rssid << 32 | rowid) matches |pred|
+    virtual void erase_if(const std::function<bool(uint64_t)>& pred) = 0;
 };
 
 #pragma pack(push)
@@ -103,13 +205,47 @@ public:
 };
 
 const uint32_t PREFETCHN = 8;
+// the hash maps of in-memory index have 16 submaps, keys are split into one part for each submap for parallel upsert
+const size_t PARALLEL_UPSERT_NUM_PARTS = 16;
+
+// Expose the submap index of phmap::parallel_hash_set, which is protected.
+template <class Map>
+struct SubmapIndex : public Map {
+    static size_t of(size_t hashval) { return Map::subidx(hashval); }
+};
+
+// Check that the keys of a part all belong to one submap, see HashIndex::partition().
+template <class Map, class KeyAt>
+void check_one_submap(const Map& map, const std::vector<uint32_t>& idxes, const KeyAt& key_at) {
+#ifndef NDEBUG
+    for (uint32_t i : idxes) {
+        DCHECK_EQ(SubmapIndex<Map>::of(map.hash(key_at(idxes[0]))), SubmapIndex<Map>::of(map.hash(key_at(i))));
+    }
+#endif
+}
 
 template <typename Key>
 class HashIndexImpl : public HashIndex {
 private:
-    phmap::parallel_flat_hash_map<Key, RowIdPack4, StdHashWithSeed<Key, PhmapSeed1>, phmap::priv::hash_default_eq<Key>,
-                                  TraceAlloc<phmap::priv::Pair<const Key, RowIdPack4>>, 4, phmap::NullMutex, true>
-            _map;
+    using Map =
+            phmap::parallel_flat_hash_map<Key, RowIdPack4, StdHashWithSeed<Key, PhmapSeed1>,
+                                          phmap::priv::hash_default_eq<Key>,
+                                          TraceAlloc<phmap::priv::Pair<const Key, RowIdPack4>>, 4, phmap::NullMutex, true>;
+    Map _map;
+
+    void _upsert_one(const Key* keys, uint32_t i, uint32_t rssid, uint32_t rowid_start, DeletesMap* deletes) {
+        RowIdPack4 v((((uint64_t)rssid) << 32) + rowid_start + i);
+        auto p = _map.insert({keys[i], v});
+        if (!p.second) {
+            uint64_t old = p.first->second.value;
+            if ((old >> 32) == rssid) {
+                LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i] << " idx=" << i
+                           << " rowid=" << rowid_start + i;
+            }
+            (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+            p.first->second = v;
+        }
+    }
 
 public:
     HashIndexImpl() = default;
@@ -162,21 +298,28 @@ public:
     void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, uint32_t idx_begin, uint32_t idx_end,
                 DeletesMap* deletes) override {
         auto* keys = reinterpret_cast<const Key*>(pks.raw_data());
-        uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
         for (uint32_t i = idx_begin; i < idx_end; i++) {
             uint32_t prefetch_i = i + PREFETCHN;
             if (LIKELY(prefetch_i < idx_end)) _map.prefetch(keys[prefetch_i]);
-            RowIdPack4 v(base + i);
-            auto p = _map.insert({keys[i], v});
-            if (!p.second) {
-                uint64_t old = p.first->second.value;
-                if ((old >> 32) == rssid) {
-                    LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i] << " idx=" << i
-                               << " rowid=" << rowid_start + i;
-                }
-                (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
-                p.first->second = v;
-            }
+            _upsert_one(keys, i, rssid, rowid_start, deletes);
+        }
+    }
+
+    void partition(const Column& pks, uint32_t idx_begin, uint32_t idx_end,
+                   std::vector<std::vector<uint32_t>>* parts) override {
+        auto* keys = reinterpret_cast<const Key*>(pks.raw_data());
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            (*parts)[SubmapIndex<Map>::of(_map.hash(keys[i]))].push_back(i);
+        }
+    }
+
+    void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, const std::vector<uint32_t>& idxes,
+                DeletesMap* deletes) override {
+        auto* keys = reinterpret_cast<const Key*>(pks.raw_data());
+        check_one_submap(_map, idxes, [&](uint32_t i) -> const Key& { return keys[i]; });
+        for (size_t j = 0; j < idxes.size(); j++) {
+            if (LIKELY(j + PREFETCHN < idxes.size())) _map.prefetch(keys[idxes[j + PREFETCHN]]);
+            _upsert_one(keys, idxes[j], rssid, rowid_start, deletes);
         }
     }
 
@@ -254,6 +397,20 @@ public:
         }
         return dump->finish_pindex_kvs(dump_pb);
     }
+
+    bool dump(IndexSnapshotWriter* ar) const override { return _map.dump(*ar); }
+
+    bool load(IndexSnapshotReader* ar) override { return _map.load(*ar); }
+
+    void erase_if(const std::function<bool(uint64_t)>& pred) override {
+        for (auto it = _map.begin(); it != _map.end();) {
+            if (pred(it->second.value)) {
+                _map._erase(it++);
+            } else {
+                ++it;
+            }
+        }
+    }
 };
 
 template <size_t S>
@@ -278,10 +435,11 @@ struct FixSliceHash {
 template <size_t S>
 class FixSliceHashIndex : public HashIndex {
 private:
-    phmap::parallel_flat_hash_map<FixSlice<S>, RowIdPack4, FixSliceHash<S>, phmap::priv::hash_default_eq<FixSlice<S>>,
-                                  TraceAlloc<phmap::priv::Pair<const FixSlice<S>, RowIdPack4>>, 4, phmap::NullMutex,
-                                  true>
-            _map;
+    using Map = phmap::parallel_flat_hash_map<FixSlice<S>, RowIdPack4, FixSliceHash<S>,
+                                              phmap::priv::hash_default_eq<FixSlice<S>>,
+                                              TraceAlloc<phmap::priv::Pair<const FixSlice<S>, RowIdPack4>>, 4,
+                                              phmap::NullMutex, true>;
+    Map _map;
 
 public:
     FixSliceHashIndex() = default;
@@ -410,6 +568,35 @@ public:
             }
         }
     }
+
+    void partition(const Column& pks, uint32_t idx_begin, uint32_t idx_end,
+                   std::vector<std::vector<uint32_t>>* parts) override {
+        const auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            (*parts)[SubmapIndex<Map>::of(_map.hash(FixSlice<S>(keys[i])))].push_back(i);
+        }
+    }
+
+    void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, const std::vector<uint32_t>& idxes,
+                DeletesMap* deletes) override {
+        const auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        check_one_submap(_map, idxes, [&](uint32_t i) { return FixSlice<S>(keys[i]); });
+        uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
+        for (uint32_t i : idxes) {
+            uint64_t v = base + i;
+            auto p = _map.emplace(FixSlice<S>(keys[i]), v);
+            if (!p.second) {
+                uint64_t old = p.first->second.value;
+                if ((old >> 32) == rssid) {
+                    LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i].to_string()
+                               << " [" << hexdump(keys[i].data, keys[i].size) << "]";
+                }
+                (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+                p.first->second = v;
+            }
+        }
+    }
+
     [[maybe_unused]] void try_replace(uint32_t rssid, uint32_t rowid_start, const Column& pks,
                                       const vector<uint32_t>& src_rssid, uint32_t idx_begin, uint32_t idx_end,
                                       vector<uint32_t>* failed) override {
@@ -585,10 +772,26 @@ public:
         }
         return dump->finish_pindex_kvs(dump_pb);
     }
+
+    bool dump(IndexSnapshotWriter* ar) const override { return _map.dump(*ar); }
+
+    bool load(IndexSnapshotReader* ar) override { return _map.load(*ar); }
+
+    void erase_if(const std::function<bool(uint64_t)>& pred) override {
+        for (auto it = _map.begin(); it != _map.end();) {
+            if (pred(it->second.value)) {
+                _map._erase(it++);
+            } else {
+                ++it;
+            }
+        }
+    }
 }; // namespace starrocks
 
 struct StringHasher1 {
     size_t operator()(const string& v) const { return XXH3_64bits(v.data(), v.length()); }
+    // Same hash as the string, to find the submap of a key without copying it.
+    size_t operator()(const Slice& v) const { return XXH3_64bits(v.data, v.size); }
 };
 
 class SliceHashIndex : public HashIndex {
@@ -598,7 +801,8 @@ private:
                                           TraceAlloc<phmap::priv::Pair<const string, tablet_rowid_t>>, 4,
                                           phmap::NullMutex, true>;
     StringMap _map;
-    size_t _total_length = 0;
+    // updated by concurrent upserts of different submaps
+    std::atomic<size_t> _total_length{0};
 
 public:
     SliceHashIndex() = default;
@@ -653,6 +857,36 @@ public:
         }
     }
 
+    void partition(const Column& pks, uint32_t idx_begin, uint32_t idx_end,
+                   std::vector<std::vector<uint32_t>>* parts) override {
+        const auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        for (uint32_t i = idx_begin; i < idx_end; i++) {
+            (*parts)[SubmapIndex<StringMap>::of(_map.hash(keys[i]))].push_back(i);
+        }
+    }
+
+    void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, const std::vector<uint32_t>& idxes,
+                DeletesMap* deletes) override {
+        const auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        check_one_submap(_map, idxes, [&](uint32_t i) -> const Slice& { return keys[i]; });
+        uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
+        for (uint32_t i : idxes) {
+            uint64_t v = base + i;
+            auto p = _map.insert({keys[i].to_string(), v});
+            if (!p.second) {
+                uint64_t old = p.first->second;
+                if ((old >> 32) == rssid) {
+                    LOG(ERROR) << "found duplicate in upsert data rssid:" << rssid << " key=" << keys[i].to_string()
+                               << " [" << hexdump(keys[i].data, keys[i].size) << "]";
+                }
+                (*deletes)[(uint32_t)(old >> 32)].push_back((uint32_t)(old & ROWID_MASK));
+                p.first->second = v;
+            } else {
+                _total_length += keys[i].size;
+            }
+        }
+    }
+
     Status replace(uint32_t rssid, uint32_t rowid_start, const std::vector<uint32_t>& indexes, uint32_t idx_begin,
                    uint32_t idx_end, const Column& pks) override {
         const auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
@@ -746,6 +980,54 @@ public:
         }
         return dump->finish_pindex_kvs(dump_pb);
     }
+
+    // string keys are not trivially copyable, so dump entries one by one
+    bool dump(IndexSnapshotWriter* ar) const override {
+        if (!ar->dump(static_cast<uint64_t>(_map.size()))) {
+            return false;
+        }
+        for (const auto& kv : _map) {
+            if (!ar->dump(static_cast<uint32_t>(kv.first.size())) || !ar->dump(kv.first.data(), kv.first.size()) ||
+                !ar->dump(kv.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool load(IndexSnapshotReader* ar) override {
+        uint64_t n = 0;
+        if (!ar->load(&n)) {
+            return false;
+        }
+        _map.reserve(n);
+        std::string key;
+        for (uint64_t i = 0; i < n; i++) {
+            uint32_t key_size = 0;
+            tablet_rowid_t value = 0;
+            if (!ar->load(&key_size)) {
+                return false;
+            }
+            key.resize(key_size);
+            if (!ar->load(key.data(), key_size) || !ar->load(&value)) {
+                return false;
+            }
+            _map.emplace(key, value);
+            _total_length += key_size;
+        }
+        return true;
+    }
+
+    void erase_if(const std::function<bool(uint64_t)>& pred) override {
+        for (auto it = _map.begin(); it != _map.end();) {
+            if (pred(it->second)) {
+                _total_length -= it->first.size();
+                _map._erase(it++);
+            } else {
+                ++it;
+            }
+        }
+    }
 }; // namespace starrocks
 
 class ShardByLengthSliceHashIndex : public HashIndex {
@@ -869,6 +1151,37 @@ public:
         }
     }
 
+    void partition(const Column& pks, uint32_t idx_begin, uint32_t idx_end,
+                   std::vector<std::vector<uint32_t>>* parts) override {
+        // create the shards here, so that concurrent upserts of parts do not modify _maps
+        if (idx_begin < idx_end) {
+            auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+            for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
+                if (keys[i].size != keys[idx_begin].size) {
+                    get_index_by_length(keys[idx_begin].size)->partition(pks, idx_begin, i, parts);
+                    idx_begin = i;
+                }
+            }
+            get_index_by_length(keys[idx_begin].size)->partition(pks, idx_begin, idx_end, parts);
+        }
+    }
+
+    void upsert(uint32_t rssid, uint32_t rowid_start, const Column& pks, const std::vector<uint32_t>& idxes,
+                DeletesMap* deletes) override {
+        auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        std::vector<uint32_t> shard_idxes;
+        for (size_t j = 0; j < idxes.size(); j++) {
+            if (j > 0 && keys[idxes[j]].size != keys[idxes[j - 1]].size) {
+                get_index_by_length(keys[idxes[j - 1]].size)->upsert(rssid, rowid_start, pks, shard_idxes, deletes);
+                shard_idxes.clear();
+            }
+            shard_idxes.push_back(idxes[j]);
+        }
+        if (!shard_idxes.empty()) {
+            get_index_by_length(keys[shard_idxes.back()].size)->upsert(rssid, rowid_start, pks, shard_idxes, deletes);
+        }
+    }
+
     Status replace(uint32_t rssid, uint32_t rowid_start, const std::vector<uint32_t>& indexes, uint32_t idx_begin,
                    uint32_t idx_end, const Column& pks) override {
         if (!indexes.empty() && idx_begin < idx_end) {
@@ -963,6 +1276,37 @@ public:
         }
         return Status::OK();
     }
+
+    // dump shards in order of key length, an absent shard is dumped as a false flag
+    bool dump(IndexSnapshotWriter* ar) const override {
+        for (const auto& _map : _maps) {
+            if (!ar->dump(static_cast<bool>(_map)) || (_map && !_map->dump(ar))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool load(IndexSnapshotReader* ar) override {
+        for (size_t len = 0; len < max_fix_length; len++) {
+            bool exist = false;
+            if (!ar->load(&exist)) {
+                return false;
+            }
+            if (exist && !get_index_by_length(len)->load(ar)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void erase_if(const std::function<bool(uint64_t)>& pred) override {
+        for (auto& _map : _maps) {
+            if (_map) {
+                _map->erase_if(pred);
+            }
+        }
+    }
 };
 
 static std::unique_ptr<HashIndex> create_hash_index(LogicalType key_type, size_t fix_size) {
@@ -1175,13 +1519,47 @@ Status PrimaryIndex::_do_load(Tablet* tablet) {
                   << " #rowset:" << rowsets.size() << " #segment:" << total_segments << " #row:" << total_rows << " -"
                   << total_dels << "=" << total_rows - total_dels << " bytes:" << total_data_size;
     }
-    if (total_rows > total_dels) {
-        _pkey_to_rssid_rowid->reserve(total_rows - total_dels);
+    std::vector<RowsetSharedPtr> missing_rowsets;
+    bool from_snapshot = false;
+    if (config::enable_primary_index_snapshot) {
+        auto snapshot_st = _load_snapshot(tablet, apply_version, rowsets, &missing_rowsets);
+        if (snapshot_st.ok()) {
+            from_snapshot = true;
+        } else {
+            if (!snapshot_st.is_not_found()) {
+                LOG(WARNING) << "load primary index snapshot failed, rebuild it tablet:" << _tablet_id << " "
+                             << snapshot_st;
+            }
+            _pkey_to_rssid_rowid = create_hash_index(_enc_pk_type, _key_size);
+        }
+    }
+    if (!from_snapshot) {
+        if (total_rows > total_dels) {
+            _pkey_to_rssid_rowid->reserve(total_rows - total_dels);
+        }
+        missing_rowsets = rowsets;
+    }
+    RETURN_IF_ERROR(_insert_rowsets(tablet, pkey_schema, apply_version, missing_rowsets, rowset_ids));
+    if (size() != total_rows - total_dels) {
+        LOG(WARNING) << strings::Substitute("load primary index row count not match tablet:$0 index:$1 != stats:$2",
+                                            _tablet_id, size(), total_rows - total_dels);
     }
+    LOG(INFO) << "load primary index finish table:" << tablet->belonged_table_id() << " tablet:" << tablet->tablet_id()
+              << " version:" << apply_version << " #rowset:" << rowsets.size() << " #segment:" << total_segments
+              << " data_size:" << total_data_size << " rowsets:" << int_list_to_string(rowset_ids)
+              << " from_snapshot:" << from_snapshot << " #scanned_rowset:" << missing_rowsets.size() << " size:" << size()
+              << " memory:" << memory_usage() << " duration: " << timer.elapsed_time() / 1000000 << "ms";
+    span->SetAttribute("memory", memory_usage());
+    span->SetAttribute("size", size());
+    return Status::OK();
+}
 
+Status PrimaryIndex::_insert_rowsets(Tablet* tablet, const Schema& pkey_schema, int64_t apply_version,
+                                     const std::vector<RowsetSharedPtr>& rowsets,
+                                     const std::vector<uint32_t>& rowset_ids) {
     OlapReaderStatistics stats;
     std::unique_ptr<Column> pk_column;
-    if (pk_columns.size() > 1) {
+    if (pkey_schema.num_fields() > 1) {
         RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pkey_schema, &pk_column));
     }
     // only hold pkey, so can use larger chunk size
@@ -1235,16 +1613,188 @@ Status PrimaryIndex::_do_load(Tablet* tablet) {
             itr->close();
         }
     }
-    if (size() != total_rows - total_dels) {
-        LOG(WARNING) << strings::Substitute("load primary index row count not match tablet:$0 index:$1 != stats:$2",
-                                            _tablet_id, size(), total_rows - total_dels);
+    return Status::OK();
+}
+
+static const uint32_t PRIMARY_INDEX_SNAPSHOT_MAGIC = 0x534e4950;
+static const uint32_t PRIMARY_INDEX_SNAPSHOT_FORMAT_VERSION = 1;
+
+static std::string get_primary_index_snapshot_file_name(const std::string& dir) {
+    return dir + "/index.mem.snapshot";
+}
+
+// the last 4 bytes of snapshot file is the crc32c checksum of the content before it
+static Status verify_primary_index_snapshot(FileSystem* fs, const std::string& file_name) {
+    ASSIGN_OR_RETURN(auto rfile, fs->new_random_access_file(file_name));
+    ASSIGN_OR_RETURN(int64_t file_size, rfile->get_size());
+    if (file_size < static_cast<int64_t>(sizeof(uint32_t))) {
+        return Status::Corruption(strings::Substitute("primary index snapshot $0 is too small", file_name));
+    }
+    const int64_t content_size = file_size - sizeof(uint32_t);
+    uint32_t expected_checksum = 0;
+    RETURN_IF_ERROR(rfile->read_at_fully(content_size, &expected_checksum, sizeof(expected_checksum)));
+    std::string buff;
+    raw::stl_string_resize_uninitialized(&buff, 4 * 1024 * 1024);
+    uint32_t checksum = 0;
+    for (int64_t offset = 0; offset < content_size;) {
+        int64_t n = std::min<int64_t>(buff.size(), content_size - offset);
+        RETURN_IF_ERROR(rfile->read_at_fully(offset, buff.data(), n));
+        checksum = crc32c::Extend(checksum, buff.data(), n);
+        offset += n;
+    }
+    if (checksum != expected_checksum) {
+        return Status::Corruption(
+                strings::Substitute("primary index snapshot crc checksum fail. filename: $0 cur_crc: $1 expect_crc: $2",
+                                    file_name, checksum, expected_checksum));
     }
-    LOG(INFO) << "load primary index finish table:" << tablet->belonged_table_id() << " tablet:" << tablet->tablet_id()
-              << " version:" << apply_version << " #rowset:" << rowsets.size() << " #segment:" << total_segments
-              << " data_size:" << total_data_size << " rowsets:" << int_list_to_string(rowset_ids) << " size:" << size()
-              << " memory:" << memory_usage() << " duration: " << timer.elapsed_time() / 1000000 << "ms";
-    span->SetAttribute("memory", memory_usage());
-    span->SetAttribute("size", size());
+    return Status::OK();
+}
+
+bool PrimaryIndex::need_snapshot() const {
+    if (!config::enable_primary_index_snapshot || _persistent_index != nullptr || _pkey_to_rssid_rowid == nullptr) {
+        return false;
+    }
+    if (size() < config::primary_index_snapshot_min_rows) {
+        return false;
+    }
+    return MonotonicMillis() - _last_snapshot_ms >= config::primary_index_snapshot_interval_sec * 1000;
+}
+
+// Snapshot file format:
+// |magic|format version|encoded pk type|key size|version|#rowset|
+// |rowset seg id|#segment|rowset id| ... (for each rowset)
+// |dump of the hash index|crc32c checksum|
+Status PrimaryIndex::dump_snapshot(int64_t version, const std::vector<RowsetSharedPtr>& rowsets,
+                                   std::string* content) {
+    RETURN_ERROR_IF_FALSE(_persistent_index == nullptr && _pkey_to_rssid_rowid != nullptr,
+                          "only in-memory primary index supports snapshot");
+    MonotonicStopWatch timer;
+    timer.start();
+    content->clear();
+    content->reserve(memory_usage());
+    IndexSnapshotWriter ar(content);
+    ar.dump(PRIMARY_INDEX_SNAPSHOT_MAGIC);
+    ar.dump(PRIMARY_INDEX_SNAPSHOT_FORMAT_VERSION);
+    ar.dump(static_cast<int32_t>(_enc_pk_type));
+    ar.dump(static_cast<uint64_t>(_key_size));
+    ar.dump(version);
+    ar.dump(static_cast<uint64_t>(rowsets.size()));
+    for (const auto& rowset : rowsets) {
+        const std::string rowset_id = rowset->rowset_id().to_string();
+        ar.dump(rowset->rowset_meta()->get_rowset_seg_id());
+        ar.dump(static_cast<uint32_t>(rowset->num_segments()));
+        ar.dump(static_cast<uint32_t>(rowset_id.size()));
+        ar.dump(rowset_id.data(), rowset_id.size());
+    }
+    if (!_pkey_to_rssid_rowid->dump(&ar)) {
+        return Status::InternalError("failed to dump primary index");
+    }
+    ar.finish();
+    _last_snapshot_ms = MonotonicMillis();
+    VLOG(1) << "dump primary index snapshot tablet:" << _tablet_id << " version:" << version
+            << " #rowset:" << rowsets.size() << " size:" << size() << " bytes:" << content->size()
+            << " duration: " << timer.elapsed_time() / 1000000 << "ms";
+    return Status::OK();
+}
+
+Status PrimaryIndex::write_snapshot(const std::string& dir, const std::string& content) {
+    const std::string file_name = get_primary_index_snapshot_file_name(dir);
+    const std::string tmp_file_name = file_name + ".tmp";
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(dir));
+    {
+        WritableFileOptions wblock_opts;
+        wblock_opts.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
+        ASSIGN_OR_RETURN(auto wfile, fs->new_writable_file(wblock_opts, tmp_file_name));
+        RETURN_IF_ERROR(wfile->append(content));
+        RETURN_IF_ERROR(wfile->sync());
+        RETURN_IF_ERROR(wfile->close());
+    }
+    return fs->rename_file(tmp_file_name, file_name);
+}
+
+Status PrimaryIndex::_load_snapshot(Tablet* tablet, int64_t apply_version, const std::vector<RowsetSharedPtr>& rowsets,
+                                    std::vector<RowsetSharedPtr>* missing_rowsets) {
+    const std::string file_name = get_primary_index_snapshot_file_name(tablet->schema_hash_path());
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(file_name));
+    RETURN_IF_ERROR(fs->path_exists(file_name));
+    RETURN_IF_ERROR(verify_primary_index_snapshot(fs.get(), file_name));
+    ASSIGN_OR_RETURN(auto rfile, fs->new_sequential_file(file_name));
+    IndexSnapshotReader ar(rfile.get());
+
+    uint32_t magic = 0;
+    uint32_t format_version = 0;
+    int32_t enc_pk_type = 0;
+    uint64_t key_size = 0;
+    int64_t version = 0;
+    uint64_t num_rowsets = 0;
+    ar.load(&magic);
+    ar.load(&format_version);
+    ar.load(&enc_pk_type);
+    ar.load(&key_size);
+    ar.load(&version);
+    ar.load(&num_rowsets);
+    RETURN_IF_ERROR(ar.status());
+    if (magic != PRIMARY_INDEX_SNAPSHOT_MAGIC || format_version != PRIMARY_INDEX_SNAPSHOT_FORMAT_VERSION ||
+        enc_pk_type != static_cast<int32_t>(_enc_pk_type) || key_size != _key_size || version > apply_version) {
+        return Status::InternalError(
+                strings::Substitute("primary index snapshot mismatch, format_version:$0 pk_type:$1 key_size:$2 "
+                                    "version:$3 apply_version:$4",
+                                    format_version, enc_pk_type, key_size, version, apply_version));
+    }
+    // rowset seg id -> (#segment, rowset id)
+    std::unordered_map<uint32_t, std::pair<uint32_t, std::string>> snapshot_rowsets;
+    for (uint64_t i = 0; i < num_rowsets; i++) {
+        uint32_t rssid = 0;
+        uint32_t num_segments = 0;
+        uint32_t rowset_id_size = 0;
+        std::string rowset_id;
+        ar.load(&rssid);
+        ar.load(&num_segments);
+        ar.load(&rowset_id_size);
+        rowset_id.resize(rowset_id_size);
+        ar.load(rowset_id.data(), rowset_id_size);
+        RETURN_IF_ERROR(ar.status());
+        snapshot_rowsets.emplace(rssid, std::make_pair(num_segments, std::move(rowset_id)));
+    }
+    if (!_pkey_to_rssid_rowid->load(&ar)) {
+        RETURN_IF_ERROR(ar.status());
+        return Status::InternalError("failed to load primary index snapshot");
+    }
+
+    // Rows only turn into deleted, so the live rows of a rowset in the snapshot are all in the index, and entries
+    // deleted after the snapshot can be filtered by delete vectors. Rowsets applied after the snapshot are rebuilt
+    // by scanning them.
+    auto manager = StorageEngine::instance()->update_manager();
+    std::unordered_map<uint32_t, DelVectorPtr> delvecs;
+    for (const auto& rowset : rowsets) {
+        uint32_t rssid = rowset->rowset_meta()->get_rowset_seg_id();
+        auto iter = snapshot_rowsets.find(rssid);
+        if (iter == snapshot_rowsets.end() || iter->second.first != static_cast<uint32_t>(rowset->num_segments()) ||
+            iter->second.second != rowset->rowset_id().to_string()) {
+            missing_rowsets->push_back(rowset);
+            continue;
+        }
+        for (uint32_t i = 0; i < rowset->num_segments(); i++) {
+            DelVectorPtr delvec;
+            RETURN_IF_ERROR(manager->get_del_vec(tablet->data_dir()->get_meta(), {_tablet_id, rssid + i},
+                                                 apply_version, &delvec));
+            if (delvec != nullptr && delvec->empty()) {
+                delvec.reset();
+            }
+            delvecs.emplace(rssid + i, std::move(delvec));
+        }
+    }
+    _pkey_to_rssid_rowid->erase_if([&](uint64_t value) {
+        auto iter = delvecs.find((uint32_t)(value >> 32));
+        if (iter == delvecs.end()) {
+            return true;
+        }
+        return iter->second != nullptr && iter->second->roaring()->contains((uint32_t)(value & ROWID_MASK));
+    });
+    _last_snapshot_ms = MonotonicMillis();
+    LOG(INFO) << "load primary index snapshot tablet:" << _tablet_id << " snapshot version:" << version
+              << " apply version:" << apply_version << " #rowset:" << rowsets.size()
+              << " #missing_rowset:" << missing_rowsets->size() << " size:" << size();
     return Status::OK();
 }
 
@@ -1401,7 +1951,7 @@ Status PrimaryIndex::upsert(uint32_t rssid, uint32_t rowid_start, const Column&
     if (_persistent_index != nullptr) {
         st = _upsert_into_persistent_index(rssid, rowid_start, pks, 0, pks.size(), deletes, stat);
     } else {
-        _pkey_to_rssid_rowid->upsert(rssid, rowid_start, pks, 0, pks.size(), deletes);
+        st = _upsert_into_hash_index(rssid, rowid_start, pks, 0, pks.size(), deletes);
     }
     return st;
 }
@@ -1413,11 +1963,57 @@ Status PrimaryIndex::upsert(uint32_t rssid, uint32_t rowid_start, const Column&
     if (_persistent_index != nullptr) {
         st = _upsert_into_persistent_index(rssid, rowid_start, pks, idx_begin, idx_end, deletes, nullptr);
     } else {
-        _pkey_to_rssid_rowid->upsert(rssid, rowid_start, pks, idx_begin, idx_end, deletes);
+        st = _upsert_into_hash_index(rssid, rowid_start, pks, idx_begin, idx_end, deletes);
     }
     return st;
 }
 
+// Keys are split into parts by the submaps of hash index, the parts are upserted by threads without lock, thread
+// i upserts the parts i, i + num_threads, ... A key always falls into the same part, so the upserts of duplicate keys
+// keep the order of input.
+// Only the in-memory index is upserted in parallel, the persistent index is upserted sequentially by
+// _upsert_into_persistent_index.
+Status PrimaryIndex::_upsert_into_hash_index(uint32_t rssid, uint32_t rowid_start, const Column& pks,
+                                             uint32_t idx_begin, uint32_t idx_end, DeletesMap* deletes) {
+    const size_t num_threads =
+            std::min<int64_t>(config::primary_index_parallel_upsert_num_threads, PARALLEL_UPSERT_NUM_PARTS);
+    if (num_threads <= 1 || idx_end - idx_begin < config::primary_index_parallel_upsert_min_rows) {
+        _pkey_to_rssid_rowid->upsert(rssid, rowid_start, pks, idx_begin, idx_end, deletes);
+        return Status::OK();
+    }
+    std::vector<std::vector<uint32_t>> parts(PARALLEL_UPSERT_NUM_PARTS);
+    for (auto& part : parts) {
+        part.reserve((idx_end - idx_begin) / PARALLEL_UPSERT_NUM_PARTS * 2);
+    }
+    _pkey_to_rssid_rowid->partition(pks, idx_begin, idx_end, &parts);
+
+    std::vector<DeletesMap> thread_deletes(num_threads);
+    auto* mem_tracker = CurrentThread::mem_tracker();
+    auto upsert_parts = [&, mem_tracker](size_t thread_idx) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        for (size_t i = thread_idx; i < PARALLEL_UPSERT_NUM_PARTS; i += num_threads) {
+            _pkey_to_rssid_rowid->upsert(rssid, rowid_start, pks, parts[i], &thread_deletes[thread_idx]);
+        }
+    };
+    auto* pool = StorageEngine::instance()->update_manager()->get_pindex_thread_pool();
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    for (size_t i = 1; i < num_threads; i++) {
+        if (!token->submit_func([&upsert_parts, i]() { upsert_parts(i); }).ok()) {
+            upsert_parts(i);
+        }
+    }
+    upsert_parts(0);
+    token->wait();
+
+    for (auto& part_delete : thread_deletes) {
+        for (auto& [del_rssid, rowids] : part_delete) {
+            auto& dels = (*deletes)[del_rssid];
+            dels.insert(dels.end(), rowids.begin(), rowids.end());
+        }
+    }
+    return Status::OK();
+}
+
 Status PrimaryIndex::_replace_persistent_index_by_indexes(uint32_t rssid, uint32_t rowid_start,
                                                           const std::vector<uint32_t>& replace_indexes,
                                                           const Column& pks) {
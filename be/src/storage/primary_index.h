@@ -153,6 +153,20 @@ public:
 
     Status pk_dump(PrimaryKeyDump* dump, PrimaryIndexMultiLevelPB* dump_pb);
 
+    // Whether the in-memory index should be dumped to a snapshot file now, controlled by
+    // config::enable_primary_index_snapshot and related configs.
+    // [not thread-safe]
+    bool need_snapshot() const;
+
+    // Serialize the in-memory index to |content|, which is a consistent copy of the index to be written by
+    // write_snapshot() later. |rowsets| are the rowsets of the applied |version|, whose rows are all in the index.
+    // [not thread-safe]
+    Status dump_snapshot(int64_t version, const std::vector<RowsetSharedPtr>& rowsets, std::string* content);
+
+    // Write |content| got by dump_snapshot() to the snapshot file in |dir| and sync it.
+    // [thread-safe]
+    static Status write_snapshot(const std::string& dir, const std::string& content);
+
     // only for ut
     void set_status(bool loaded, Status st) {
         _loaded = loaded;
@@ -165,6 +179,14 @@ protected:
 private:
     Status _do_load(Tablet* tablet);
 
+    // Restore the in-memory index from the snapshot file of |tablet|. Entries of rowsets not in |rowsets| or
+    // deleted after the snapshot are dropped, and rowsets not in the snapshot are returned by |missing_rowsets|.
+    Status _load_snapshot(Tablet* tablet, int64_t apply_version, const std::vector<RowsetSharedPtr>& rowsets,
+                          std::vector<RowsetSharedPtr>* missing_rowsets);
+
+    Status _insert_rowsets(Tablet* tablet, const Schema& pkey_schema, int64_t apply_version,
+                           const std::vector<RowsetSharedPtr>& rowsets, const std::vector<uint32_t>& rowset_ids);
+
     Status _build_persistent_values(uint32_t rssid, uint32_t rowid_start, uint32_t idx_begin, uint32_t idx_end,
                                     std::vector<uint64_t>* values) const;
 
@@ -179,6 +201,9 @@ private:
     Status _upsert_into_persistent_index(uint32_t rssid, uint32_t rowid_start, const Column& pks, uint32_t idx_begin,
                                          uint32_t idx_end, DeletesMap* deletes, IOStat* stat);
 
+    Status _upsert_into_hash_index(uint32_t rssid, uint32_t rowid_start, const Column& pks, uint32_t idx_begin,
+                                   uint32_t idx_end, DeletesMap* deletes);
+
     Status _erase_persistent_index(const Column& key_col, DeletesMap* deletes);
 
     Status _get_from_persistent_index(const Column& key_col, std::vector<uint64_t>* rowids) const;
@@ -208,6 +233,7 @@ private:
     LogicalType _enc_pk_type = TYPE_UNKNOWN;
     std::unique_ptr<HashIndex> _pkey_to_rssid_rowid;
     std::atomic<size_t> _memory_usage{0};
+    int64_t _last_snapshot_ms = 0;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const PrimaryIndex& o) {
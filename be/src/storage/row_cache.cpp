@@ -0,0 +1,179 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/row_cache.h"
+
+#include "column/binary_column.h"
+#include "common/config.h"
+#include "gutil/casts.h"
+#include "runtime/current_thread.h"
+#include "util/lru_cache.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+namespace {
+
+struct RowCacheValue {
+    int64_t epoch;
+    int32_t schema_version;
+    std::string row;
+};
+
+void delete_row_cache_value(const CacheKey& key, void* value) {
+    delete static_cast<RowCacheValue*>(value);
+}
+
+Slice get_key_slice(const Column& pks, size_t idx) {
+    if (pks.is_binary()) {
+        return down_cast<const BinaryColumn&>(pks).get_slice(idx);
+    }
+    size_t size = pks.type_size();
+    return {pks.raw_data() + idx * size, size};
+}
+
+} // namespace
+
+RowCache::RowCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+RowCache::~RowCache() = default;
+
+bool RowCache::enabled() {
+    size_t capacity = std::max<int64_t>(config::primary_key_row_cache_capacity, 0);
+    if (capacity != _cache->get_capacity()) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+        _cache->set_capacity(capacity);
+    }
+    return capacity > 0;
+}
+
+RowCache::TabletState& RowCache::_get_tablet_state(int64_t tablet_id) {
+    auto iter = _tablet_states.find(tablet_id);
+    if (iter == _tablet_states.end()) {
+        int64_t sequence = ++_next_sequence;
+        iter = _tablet_states.emplace(tablet_id, TabletState{.epoch = sequence, .sequence = sequence}).first;
+    }
+    return iter->second;
+}
+
+std::string RowCache::_encode_key(int64_t tablet_id, const Slice& pk) {
+    std::string key;
+    key.reserve(sizeof(tablet_id) + pk.size);
+    key.append(reinterpret_cast<const char*>(&tablet_id), sizeof(tablet_id));
+    key.append(pk.data, pk.size);
+    return key;
+}
+
+int64_t RowCache::tablet_sequence(int64_t tablet_id) {
+    std::lock_guard l(_lock);
+    return _get_tablet_state(tablet_id).sequence;
+}
+
+size_t RowCache::lookup(int64_t tablet_id, int32_t schema_version, const Column& pks, std::vector<bool>* hits,
+                        std::vector<std::string>* rows) {
+    int64_t epoch = 0;
+    {
+        std::lock_guard l(_lock);
+        epoch = _get_tablet_state(tablet_id).epoch;
+    }
+    size_t n = pks.size();
+    hits->assign(n, false);
+    rows->resize(n);
+    size_t num_hits = 0;
+    for (size_t i = 0; i < n; i++) {
+        auto* handle = _cache->lookup(_encode_key(tablet_id, get_key_slice(pks, i)));
+        if (handle == nullptr) {
+            continue;
+        }
+        auto* value = static_cast<RowCacheValue*>(_cache->value(handle));
+        if (value->epoch == epoch && value->schema_version == schema_version) {
+            (*hits)[i] = true;
+            (*rows)[i] = value->row;
+            num_hits++;
+        }
+        _cache->release(handle);
+    }
+    _lookup_count += n;
+    _hit_count += num_hits;
+    StarRocksMetrics::instance()->primary_key_row_cache_lookup_total.increment(n);
+    StarRocksMetrics::instance()->primary_key_row_cache_hit_total.increment(num_hits);
+    return num_hits;
+}
+
+void RowCache::insert(int64_t tablet_id, int32_t schema_version, int64_t sequence, const Column& pks,
+                      const BinaryColumn& rows) {
+    DCHECK_EQ(pks.size(), rows.size());
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    // hold the lock so that the erase of apply can not happen between the check of sequence and the insertion.
+    std::lock_guard l(_lock);
+    const auto& state = _get_tablet_state(tablet_id);
+    if (state.sequence != sequence) {
+        return;
+    }
+    for (size_t i = 0; i < pks.size(); i++) {
+        std::string key = _encode_key(tablet_id, get_key_slice(pks, i));
+        Slice row = rows.get_slice(i);
+        auto* value = new RowCacheValue{.epoch = state.epoch, .schema_version = schema_version,
+                                        .row = std::string(row.data, row.size)};
+        size_t charge = key.size() + row.size + sizeof(RowCacheValue);
+        auto* handle = _cache->insert(key, value, charge, delete_row_cache_value);
+        _cache->release(handle);
+    }
+    StarRocksMetrics::instance()->primary_key_row_cache_bytes_total.set_value(_cache->get_memory_usage());
+}
+
+void RowCache::erase(int64_t tablet_id, const Column& pks) {
+    // nothing can be cached while the cache is disabled, and readers take the sequence after enabling it.
+    if (_cache->get_capacity() == 0) {
+        return;
+    }
+    {
+        std::lock_guard l(_lock);
+        _get_tablet_state(tablet_id).sequence = ++_next_sequence;
+    }
+    // rows cached before the sequence changes are erased below, and rows read after it are read from
+    // the updated index, so it's safe to erase without the lock.
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+    if (_cache->get_memory_usage() == 0) {
+        return;
+    }
+    for (size_t i = 0; i < pks.size(); i++) {
+        _cache->erase(_encode_key(tablet_id, get_key_slice(pks, i)));
+    }
+}
+
+void RowCache::invalidate_tablet(int64_t tablet_id) {
+    std::lock_guard l(_lock);
+    // state is created again with new epoch and sequence when the tablet is used.
+    _tablet_states.erase(tablet_id);
+}
+
+size_t RowCache::capacity() const {
+    return _cache->get_capacity();
+}
+
+size_t RowCache::memory_usage() const {
+    return _cache->get_memory_usage();
+}
+
+uint64_t RowCache::lookup_count() const {
+    return _lookup_count;
+}
+
+uint64_t RowCache::hit_count() const {
+    return _hit_count;
+}
+
+} // namespace starrocks
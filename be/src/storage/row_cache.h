@@ -0,0 +1,91 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class Cache;
+class MemTracker;
+
+// RowCache caches rows of primary key tablets for point lookups, keyed by (tablet, encoded primary key).
+// A row is the value columns encoded by RowStoreEncoder, and only valid for the schema version it is encoded with.
+//
+// Apply erases the rows of the upserted and deleted keys from the cache, and reload of a tablet invalidates
+// all rows of it. To avoid caching a row read before an invalidation, reader takes the sequence of the tablet
+// before reading from storage, and the row is cached only if the sequence does not change.
+class RowCache {
+public:
+    RowCache(MemTracker* mem_tracker, size_t capacity);
+    ~RowCache();
+
+    // capacity is controlled by config::primary_key_row_cache_capacity, 0 means disabled.
+    bool enabled();
+
+    int64_t tablet_sequence(int64_t tablet_id);
+
+    // Lookup rows of encoded primary keys `pks`, hits[i] is set to true and rows[i] to the row if found.
+    // Return the number of hits.
+    size_t lookup(int64_t tablet_id, int32_t schema_version, const Column& pks, std::vector<bool>* hits,
+                  std::vector<std::string>* rows);
+
+    // Cache rows of encoded primary keys, `rows` has the same size as `pks`.
+    // Nothing is cached if the tablet is invalidated after `sequence` is taken.
+    void insert(int64_t tablet_id, int32_t schema_version, int64_t sequence, const Column& pks,
+                const BinaryColumn& rows);
+
+    // Erase rows of the encoded primary keys, called when they are upserted or deleted.
+    void erase(int64_t tablet_id, const Column& pks);
+
+    // Invalidate all rows of the tablet.
+    void invalidate_tablet(int64_t tablet_id);
+
+    size_t capacity() const;
+    size_t memory_usage() const;
+    uint64_t lookup_count() const;
+    uint64_t hit_count() const;
+
+private:
+    struct TabletState {
+        // rows cached with other epoch are invalid.
+        int64_t epoch = 0;
+        int64_t sequence = 0;
+    };
+
+    TabletState& _get_tablet_state(int64_t tablet_id);
+    static std::string _encode_key(int64_t tablet_id, const Slice& pk);
+
+    MemTracker* _mem_tracker = nullptr;
+    std::unique_ptr<Cache> _cache;
+
+    std::mutex _lock;
+    std::unordered_map<int64_t, TabletState> _tablet_states;
+    // both epoch and sequence are taken from it, so that they never repeat even if state of tablet is removed.
+    int64_t _next_sequence = 0;
+
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
+};
+
+} // namespace starrocks
@@ -166,6 +166,9 @@ public:
 
     virtual bool has_original_bloom_filter_index() const { return false; }
     virtual bool has_ngram_bloom_filter_index() const { return false; }
+    // whether the flattened sub-columns of a json column have bloom filter index, which can be used by
+    // predicates on json paths, e.g. `get_json_string(c, '$.a') = 'x'`.
+    virtual bool has_json_flat_bloom_filter_index() const { return false; }
     /// Treat the relationship between |predicates| as `(s_pred_1 OR s_pred_2 OR ... OR s_pred_n) AND (ns_pred_1 AND ns_pred_2 AND ... AND ns_pred_n)`,
     /// where s_pred_i denotes a predicate which supports bloom filter, and ns_pred_i denotes a predicate which does not support bloom filter.
     /// That is,
@@ -36,7 +36,9 @@
 
 #include <fmt/format.h>
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "column/column.h"
@@ -45,7 +47,10 @@
 #include "column/datum_convert.h"
 #include "common/compiler_util.h"
 #include "common/logging.h"
+#include "common/object_pool.h"
+#include "gutil/casts.h"
 #include "runtime/types.h"
+#include "storage/column_expr_predicate.h"
 #include "storage/column_predicate.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/inverted/inverted_plugin_factory.h"
@@ -145,6 +150,9 @@ Status ColumnReader::_init(ColumnMetaPB* meta, const TabletColumn* column) {
                                          _ordinal_index_meta->SpaceUsedLong());
                 _meta_mem_usage.fetch_add(_ordinal_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
                 _ordinal_index = std::make_unique<OrdinalIndexReader>();
+                if (!_ordinal_index_meta->root_page().is_root_data_page()) {
+                    _ordinal_index_page = PagePointer(_ordinal_index_meta->root_page().root_page());
+                }
                 break;
             case ZONE_MAP_INDEX:
                 _zonemap_index_meta.reset(index_meta->release_zone_map_index());
@@ -200,6 +208,11 @@ Status ColumnReader::_init(ColumnMetaPB* meta, const TabletColumn* column) {
                 RETURN_IF_ERROR(res);
                 _sub_readers->emplace_back(std::move(res).value());
             }
+            // the first sub-column of a nullable json column is the null flags, see FlatJsonColumnWriter
+            for (size_t i = is_nullable() ? 1 : 0; i < _sub_readers->size(); i++) {
+                if ((*_sub_readers)[i]->has_zone_map()) _flags |= kHasJsonFlatZoneMapMask;
+                if ((*_sub_readers)[i]->has_bloom_filter_index()) _flags |= kHasJsonFlatBloomFilterMask;
+            }
             return Status::OK();
         }
         return Status::OK();
@@ -597,6 +610,9 @@ Status ColumnReader::_zone_map_filter(const std::vector<const ColumnPredicate*>&
 }
 
 bool ColumnReader::segment_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates) const {
+    if (has_json_flat_zone_map()) {
+        return _json_flat_segment_zone_map_filter(predicates);
+    }
     if (_segment_zone_map == nullptr || predicates.empty()) {
         return true;
     }
@@ -608,6 +624,126 @@ bool ColumnReader::segment_zone_map_filter(const std::vector<const ColumnPredica
     return std::all_of(predicates.begin(), predicates.end(), filter);
 }
 
+bool ColumnReader::has_json_flat_path(const std::string& path) const {
+    if (_column_type != TYPE_JSON || _sub_readers == nullptr) {
+        return false;
+    }
+    for (size_t i = is_nullable() ? 1 : 0; i < _sub_readers->size(); i++) {
+        if ((*_sub_readers)[i]->name() == path) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Status ColumnReader::_rewrite_json_flat_predicates(
+        const std::vector<const ColumnPredicate*>& predicates, ObjectPool* pool,
+        std::map<ColumnReader*, std::vector<const ColumnPredicate*>>* sub_predicates, size_t* num_skipped) const {
+    DCHECK(_sub_readers != nullptr);
+    const size_t start = is_nullable() ? 1 : 0;
+    auto find_sub_reader = [&](const std::string& name) -> ColumnReader* {
+        for (size_t i = start; i < _sub_readers->size(); i++) {
+            if ((*_sub_readers)[i]->name() == name) {
+                return (*_sub_readers)[i].get();
+            }
+        }
+        return nullptr;
+    };
+    auto flat_type_of = [&](const std::string& name) {
+        auto* rd = find_sub_reader(name);
+        return rd != nullptr ? rd->column_type() : TYPE_UNKNOWN;
+    };
+
+    *num_skipped = 0;
+    for (const auto* pred : predicates) {
+        const ColumnPredicate* flat_pred = nullptr;
+        std::string flat_path;
+        if (pred->type() == PredicateType::kExpr) {
+            const auto* expr_pred = down_cast<const ColumnExprPredicate*>(pred);
+            RETURN_IF_ERROR(expr_pred->try_to_rewrite_for_json_flat_column(pool, flat_type_of, &flat_path, &flat_pred));
+        }
+        if (flat_pred == nullptr) {
+            (*num_skipped)++;
+            continue;
+        }
+        (*sub_predicates)[find_sub_reader(flat_path)].emplace_back(flat_pred);
+    }
+    return Status::OK();
+}
+
+bool ColumnReader::_json_flat_segment_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates) const {
+    ObjectPool pool;
+    std::map<ColumnReader*, std::vector<const ColumnPredicate*>> sub_predicates;
+    size_t num_skipped = 0;
+    auto st = _rewrite_json_flat_predicates(predicates, &pool, &sub_predicates, &num_skipped);
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to rewrite predicates for flat json column " << _name << ": " << st;
+        return true;
+    }
+    // predicates are in conjunction here, the skipped ones just can't filter anything
+    return std::all_of(sub_predicates.begin(), sub_predicates.end(), [](const auto& entry) {
+        return !entry.first->has_zone_map() || entry.first->segment_zone_map_filter(entry.second);
+    });
+}
+
+Status ColumnReader::json_flat_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                               SparseRange<>* row_ranges, const IndexReadOptions& opts,
+                                               CompoundNodeType pred_relation) {
+    DCHECK(row_ranges->empty());
+    const SparseRange<> full_range(0, num_rows());
+    ObjectPool pool;
+    std::map<ColumnReader*, std::vector<const ColumnPredicate*>> sub_predicates;
+    size_t num_skipped = 0;
+    RETURN_IF_ERROR(_rewrite_json_flat_predicates(predicates, &pool, &sub_predicates, &num_skipped));
+    if (sub_predicates.empty() || (pred_relation == CompoundNodeType::OR && num_skipped > 0)) {
+        // any row may satisfy an OR node if one of its predicates can't be checked by zone map
+        *row_ranges = full_range;
+        return Status::OK();
+    }
+
+    std::optional<SparseRange<>> result;
+    for (auto& [sub_reader, preds] : sub_predicates) {
+        SparseRange<> cur_ranges;
+        if (sub_reader->has_zone_map()) {
+            std::unordered_set<uint32_t> del_partial_filtered_pages;
+            RETURN_IF_ERROR(sub_reader->load_ordinal_index(opts));
+            RETURN_IF_ERROR(sub_reader->zone_map_filter(preds, nullptr, &del_partial_filtered_pages, &cur_ranges,
+                                                        opts, pred_relation));
+        } else {
+            cur_ranges = full_range;
+        }
+        if (!result.has_value()) {
+            result = std::move(cur_ranges);
+        } else if (pred_relation == CompoundNodeType::AND) {
+            result.value() &= cur_ranges;
+        } else {
+            result.value() |= cur_ranges;
+        }
+    }
+    *row_ranges = std::move(result.value());
+    return Status::OK();
+}
+
+Status ColumnReader::json_flat_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                            SparseRange<>* row_ranges, const IndexReadOptions& opts) {
+    ObjectPool pool;
+    std::map<ColumnReader*, std::vector<const ColumnPredicate*>> sub_predicates;
+    size_t num_skipped = 0;
+    RETURN_IF_ERROR(_rewrite_json_flat_predicates(predicates, &pool, &sub_predicates, &num_skipped));
+    // the relation between |predicates| is unknown here, only a single sub-column is safe to check
+    if (num_skipped > 0 || sub_predicates.size() != 1) {
+        return Status::OK();
+    }
+    auto& [sub_reader, preds] = *sub_predicates.begin();
+    const bool support =
+            std::ranges::all_of(preds, [](const auto* pred) { return pred->support_original_bloom_filter(); });
+    if (!support || !sub_reader->has_bloom_filter_index()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(sub_reader->load_ordinal_index(opts));
+    return sub_reader->original_bloom_filter(preds, row_ranges, opts);
+}
+
 void ColumnReader::_update_sub_reader_pos(const TabletColumn* column, int pos) {
     if (column == nullptr) {
         return;
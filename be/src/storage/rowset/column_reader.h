@@ -66,6 +66,7 @@ class MemTracker;
 
 class ColumnPredicate;
 class Column;
+class ObjectPool;
 class ZoneMapDetail;
 
 class BitmapIndexIterator;
@@ -142,6 +143,12 @@ public:
         return _bloom_filter_index != nullptr && _segment->tablet_schema().has_index(_column_unique_id, NGRAMBF);
     }
 
+    // whether the flattened sub-columns of a json column have zone map / bloom filter index
+    bool has_json_flat_zone_map() const { return _flags & kHasJsonFlatZoneMapMask; }
+    bool has_json_flat_bloom_filter_index() const { return _flags & kHasJsonFlatBloomFilterMask; }
+    // whether the json path |path| is flattened to a sub-column in this segment
+    bool has_json_flat_path(const std::string& path) const;
+
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
     PagePointer get_dict_page_pointer() const { return _dict_page_pointer; }
@@ -179,8 +186,24 @@ public:
     Status ngram_bloom_filter(const std::vector<const ::starrocks::ColumnPredicate*>& p, SparseRange<>* ranges,
                               const IndexReadOptions& opts);
 
+    // page-level zone map filter of a flat json column, |p| are predicates on the json column which are
+    // rewritten to predicates on the flattened sub-columns, see ColumnExprPredicate::try_to_rewrite_for_json_flat_column.
+    Status json_flat_zone_map_filter(const std::vector<const ::starrocks::ColumnPredicate*>& p, SparseRange<>* ranges,
+                                     const IndexReadOptions& opts, CompoundNodeType pred_relation);
+
+    // bloom filter of a flat json column, only applied when all of |p| can be rewritten to equality predicates
+    // on the same flattened sub-column.
+    Status json_flat_bloom_filter(const std::vector<const ::starrocks::ColumnPredicate*>& p, SparseRange<>* ranges,
+                                  const IndexReadOptions& opts);
+
     Status load_ordinal_index(const IndexReadOptions& opts);
 
+    // The index page that load_ordinal_index() still has to read, or an empty pointer if the
+    // ordinal index is loaded already or does not need any page read.
+    PagePointer ordinal_index_page() const {
+        return _ordinal_index != nullptr && !_ordinal_index->loaded() ? _ordinal_index_page : PagePointer();
+    }
+
     Status new_inverted_index_iterator(const std::shared_ptr<TabletIndex>& index_meta, InvertedIndexIterator** iterator,
                                        const SegmentReadOptions& opts);
 
@@ -206,6 +229,8 @@ private:
     constexpr static uint8_t kIsNullableMask = 1;
     constexpr static uint8_t kHasAllDictEncodedMask = 2;
     constexpr static uint8_t kAllDictEncodedMask = 4;
+    constexpr static uint8_t kHasJsonFlatZoneMapMask = 8;
+    constexpr static uint8_t kHasJsonFlatBloomFilterMask = 16;
 
     Status _init(ColumnMetaPB* meta, const TabletColumn* column);
 
@@ -221,6 +246,14 @@ private:
     Status _zone_map_filter(const std::vector<const ColumnPredicate*>& predicates, const ColumnPredicate* del_predicate,
                             std::unordered_set<uint32_t>* del_partial_filtered_pages, std::vector<uint32_t>* pages);
 
+    // Group the predicates by the flattened sub-column they can be rewritten to, predicates which
+    // can't be rewritten are skipped and counted in |num_skipped|.
+    Status _rewrite_json_flat_predicates(const std::vector<const ColumnPredicate*>& predicates, ObjectPool* pool,
+                                         std::map<ColumnReader*, std::vector<const ColumnPredicate*>>* sub_predicates,
+                                         size_t* num_skipped) const;
+
+    bool _json_flat_segment_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates) const;
+
     Status _load_inverted_index(const std::shared_ptr<TabletIndex>& index_meta, const SegmentReadOptions& opts);
 
     NgramBloomFilterReaderOptions _get_reader_options_for_ngram() const;
@@ -247,6 +280,8 @@ private:
 
     std::unique_ptr<ZoneMapIndexPB> _zonemap_index_meta;
     std::unique_ptr<OrdinalIndexPB> _ordinal_index_meta;
+    // root index page of a multi-page ordinal index, kept after |_ordinal_index_meta| is released
+    PagePointer _ordinal_index_page;
     std::unique_ptr<BitmapIndexPB> _bitmap_index_meta;
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta;
 
@@ -85,6 +85,8 @@ struct ColumnWriterOptions {
     GlobalDictMap* global_dict = nullptr;
 
     bool need_flat = false;
+    // json paths to flatten first, most important first, see JsonFlatPathStats
+    std::vector<std::string> flat_json_hot_paths;
 
     std::string field_name;
 };
@@ -26,6 +26,7 @@
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "common/statusor.h"
@@ -78,6 +79,11 @@ public:
                                                     const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
                                                     CompoundNodeType pred_relation) override;
 
+    bool has_json_flat_bloom_filter_index() const override { return _reader->has_json_flat_bloom_filter_index(); }
+
+    [[nodiscard]] Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                        SparseRange<>* row_ranges) override;
+
     [[nodiscard]] Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
 
 private:
@@ -265,8 +271,29 @@ Status JsonFlatColumnIterator::seek_to_ordinal(ordinal_t ord) {
 Status JsonFlatColumnIterator::get_row_ranges_by_zone_map(const std::vector<const ColumnPredicate*>& predicates,
                                                           const ColumnPredicate* del_predicate,
                                                           SparseRange<>* row_ranges, CompoundNodeType pred_relation) {
-    row_ranges->add({0, static_cast<rowid_t>(_reader->num_rows())});
-    return Status::OK();
+    if (!_reader->has_json_flat_zone_map()) {
+        row_ranges->add({0, static_cast<rowid_t>(_reader->num_rows())});
+        return Status::OK();
+    }
+    IndexReadOptions opts;
+    opts.use_page_cache = config::enable_zonemap_index_memory_page_cache || !config::disable_storage_page_cache;
+    opts.kept_in_memory = config::enable_zonemap_index_memory_page_cache;
+    opts.lake_io_opts = _opts.lake_io_opts;
+    opts.read_file = _opts.read_file;
+    opts.stats = _opts.stats;
+    return _reader->json_flat_zone_map_filter(predicates, row_ranges, opts, pred_relation);
+}
+
+Status JsonFlatColumnIterator::get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                              SparseRange<>* row_ranges) {
+    RETURN_IF(!_reader->has_json_flat_bloom_filter_index(), Status::OK());
+    IndexReadOptions opts;
+    opts.use_page_cache = !config::disable_storage_page_cache;
+    opts.kept_in_memory = false;
+    opts.lake_io_opts = _opts.lake_io_opts;
+    opts.read_file = _opts.read_file;
+    opts.stats = _opts.stats;
+    return _reader->json_flat_bloom_filter(predicates, row_ranges, opts);
 }
 
 class JsonDynamicFlatIterator final : public ColumnIterator {
@@ -299,6 +326,13 @@ public:
                                                     const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
                                                     CompoundNodeType pred_relation) override;
 
+    bool has_json_flat_bloom_filter_index() const override { return _json_iter->has_json_flat_bloom_filter_index(); }
+
+    [[nodiscard]] Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                        SparseRange<>* row_ranges) override {
+        return _json_iter->get_row_ranges_by_bloom_filter(predicates, row_ranges);
+    }
+
     [[nodiscard]] Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
 
 private:
@@ -84,6 +84,7 @@ private:
     std::vector<std::string> _flat_paths;
     std::vector<LogicalType> _flat_types;
     std::vector<ColumnPtr> _flat_columns;
+    std::vector<std::string> _hot_paths;
 };
 
 FlatJsonColumnWriter::FlatJsonColumnWriter(const ColumnWriterOptions& opts, const TypeInfoPtr& type_info,
@@ -91,7 +92,8 @@ FlatJsonColumnWriter::FlatJsonColumnWriter(const ColumnWriterOptions& opts, cons
         : ColumnWriter(std::move(type_info), opts.meta->length(), opts.meta->is_nullable()),
           _json_column_writer(std::move(json_writer)),
           _json_meta(opts.meta),
-          _wfile(wfile) {}
+          _wfile(wfile),
+          _hot_paths(opts.flat_json_hot_paths) {}
 
 Status FlatJsonColumnWriter::append(const Column& column) {
     RETURN_IF_ERROR(_json_column_writer->append(column));
@@ -105,7 +107,7 @@ Status FlatJsonColumnWriter::append(const Column& column) {
 
 void FlatJsonColumnWriter::_flat_column(std::vector<ColumnPtr>& json_datas) {
     JsonFlattener flattener;
-    flattener.derived_paths(json_datas);
+    flattener.derived_paths(json_datas, _hot_paths);
 
     _flat_paths = flattener.get_flat_paths();
     _flat_types = flattener.get_flat_types();
@@ -209,6 +211,13 @@ Status FlatJsonColumnWriter::finish() {
             }
 
             opts.need_flat = false;
+            // JSON-typed sub-columns hold mixed values, only the scalar ones have meaningful indexes
+            if (_flat_types[i] != LogicalType::TYPE_JSON) {
+                opts.need_zone_map = config::enable_json_flat_zone_map;
+                // bloom filter doesn't support floating point types
+                opts.need_bloom_filter =
+                        config::enable_json_flat_bloom_filter && _flat_types[i] != LogicalType::TYPE_DOUBLE;
+            }
 
             TabletColumn col(StorageAggregateType::STORAGE_AGGREGATE_NONE, _flat_types[i], true);
             ASSIGN_OR_RETURN(auto fw, ColumnWriter::create(opts, &col, _wfile));
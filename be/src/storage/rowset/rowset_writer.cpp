@@ -122,6 +122,7 @@ Status RowsetWriter::init() {
 
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
+    _writer_options.tablet_id = _context.tablet_id;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS &&
         (_context.is_partial_update || !_context.merge_condition.empty() || _context.miss_auto_increment_column)) {
@@ -662,6 +663,44 @@ Status HorizontalRowsetWriter::add_rowset_for_linked_schema_change(RowsetSharedP
     return add_rowset(rowset);
 }
 
+Status HorizontalRowsetWriter::link_segment(const RowsetSharedPtr& rowset, uint32_t segment_id) {
+    if (_segment_writer != nullptr) {
+        return Status::InternalError("link segment with unflushed rows");
+    }
+    if (segment_id >= rowset->num_segments()) {
+        return Status::InvalidArgument(
+                fmt::format("segment {} out of range of rowset {}", segment_id, rowset->rowset_id().to_string()));
+    }
+    RETURN_IF_ERROR(rowset->load());
+    const auto& segment = rowset->segments()[segment_id];
+    std::string src_path = Rowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), segment_id);
+    ASSIGN_OR_RETURN(auto segment_size, _fs->get_file_size(src_path));
+    std::string dst_path;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        dst_path = Rowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, _num_segment);
+        ++_num_segment;
+    }
+    RETURN_IF_ERROR(_fs->link_file(src_path, dst_path));
+    _num_rows_written += segment->num_rows();
+    _num_rows_flushed = _num_rows_written;
+    _num_rows_of_tmp_segment_files.push_back(segment->num_rows());
+    // the linked file keeps its own index, split the size by the ratio of the source rowset
+    int64_t index_size = 0;
+    if (rowset->rowset_meta()->data_disk_size() > 0) {
+        index_size = static_cast<int64_t>(segment_size * rowset->rowset_meta()->index_disk_size() /
+                                          rowset->rowset_meta()->data_disk_size());
+    }
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _total_row_size += static_cast<int64_t>(rowset->total_row_size() * segment->num_rows() /
+                                                std::max<int64_t>(1, rowset->num_rows()));
+        _total_data_size += static_cast<int64_t>(segment_size);
+        _total_index_size += index_size;
+    }
+    return Status::OK();
+}
+
 Status HorizontalRowsetWriter::flush() {
     if (_segment_writer != nullptr) {
         return _flush_segment_writer(&_segment_writer);
@@ -142,6 +142,13 @@ public:
         return Status::NotSupported("RowsetWriter::add_rowset_for_linked_schema_change");
     }
 
+    // Hard link segment `segment_id` of `rowset` as the next segment of the rowset we're building.
+    // Precondition: buffered rows have been flushed, and the caller keeps the segments in key order
+    // if the rowset we're building is NONOVERLAPPING
+    virtual Status link_segment(const RowsetSharedPtr& rowset, uint32_t segment_id) {
+        return Status::NotSupported("RowsetWriter::link_segment");
+    }
+
     // explicit flush all buffered rows into segment file.
     virtual Status flush() { return Status::NotSupported("RowsetWriter::flush"); }
 
@@ -232,6 +239,8 @@ public:
     Status add_rowset(RowsetSharedPtr rowset) override;
     Status add_rowset_for_linked_schema_change(RowsetSharedPtr rowset, const SchemaMapping& schema_mapping) override;
 
+    Status link_segment(const RowsetSharedPtr& rowset, uint32_t segment_id) override;
+
     Status flush() override;
 
     StatusOr<RowsetSharedPtr> build() override;
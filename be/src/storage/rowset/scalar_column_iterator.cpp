@@ -375,17 +375,20 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(const std::vector<const
                                                         const ColumnPredicate* del_predicate, SparseRange<>* row_ranges,
                                                         CompoundNodeType pred_relation) {
     DCHECK(row_ranges->empty());
-    if (_reader->has_zone_map()) {
-        if (!_delete_partial_satisfied_pages.has_value()) {
-            _delete_partial_satisfied_pages.emplace();
-        }
-
+    if (_reader->has_zone_map() || _reader->has_json_flat_zone_map()) {
         IndexReadOptions opts;
         opts.use_page_cache = config::enable_zonemap_index_memory_page_cache || !config::disable_storage_page_cache;
         opts.kept_in_memory = config::enable_zonemap_index_memory_page_cache;
         opts.lake_io_opts = _opts.lake_io_opts;
         opts.read_file = _opts.read_file;
         opts.stats = _opts.stats;
+        if (!_reader->has_zone_map()) {
+            return _reader->json_flat_zone_map_filter(predicates, row_ranges, opts, pred_relation);
+        }
+
+        if (!_delete_partial_satisfied_pages.has_value()) {
+            _delete_partial_satisfied_pages.emplace();
+        }
         RETURN_IF_ERROR(_reader->zone_map_filter(predicates, del_predicate, &_delete_partial_satisfied_pages.value(),
                                                  row_ranges, opts, pred_relation));
     } else {
@@ -402,8 +405,21 @@ bool ScalarColumnIterator::has_ngram_bloom_filter_index() const {
     return _reader->has_ngram_bloom_filter_index();
 }
 
+bool ScalarColumnIterator::has_json_flat_bloom_filter_index() const {
+    return _reader->has_json_flat_bloom_filter_index();
+}
+
 Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                                             SparseRange<>* row_ranges) {
+    if (_reader->has_json_flat_bloom_filter_index()) {
+        IndexReadOptions opts;
+        opts.use_page_cache = !config::disable_storage_page_cache;
+        opts.kept_in_memory = false;
+        opts.lake_io_opts = _opts.lake_io_opts;
+        opts.read_file = _opts.read_file;
+        opts.stats = _opts.stats;
+        return _reader->json_flat_bloom_filter(predicates, row_ranges, opts);
+    }
     RETURN_IF(!_reader->has_bloom_filter_index(), Status::OK());
 
     bool support_original_bloom_filter = false;
@@ -44,6 +44,8 @@
 #include "column/schema.h"
 #include "common/logging.h"
 #include "gutil/strings/substitute.h"
+#include "io/array_input_stream.h"
+#include "io/shared_buffered_input_stream.h"
 #include "segment_iterator.h"
 #include "segment_options.h"
 #include "storage/lake/tablet_manager.h"
@@ -57,6 +59,7 @@
 #include "storage/type_utils.h"
 #include "storage/utils.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
 
 bvar::Adder<int> g_open_segments;    // NOLINT
@@ -86,8 +89,9 @@ StatusOr<std::shared_ptr<Segment>> Segment::open(std::shared_ptr<FileSystem> fs,
 }
 
 StatusOr<size_t> Segment::parse_segment_footer(RandomAccessFile* read_file, SegmentFooterPB* footer,
-                                               size_t* footer_length_hint,
-                                               const FooterPointerPB* partial_rowset_footer) {
+                                               size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer,
+                                               std::string* tail_buffer, uint64_t* tail_offset) {
+    DCHECK((tail_buffer == nullptr) == (tail_offset == nullptr));
     // Footer := SegmentFooterPB, FooterPBSize(4), FooterPBChecksum(4), MagicNumber(4)
     ASSIGN_OR_RETURN(auto file_size, read_file->get_size());
 
@@ -173,6 +177,10 @@ StatusOr<size_t> Segment::parse_segment_footer(RandomAccessFile* read_file, Segm
                                     read_file->filename(), actual_checksum, checksum));
     }
 
+    if (tail_buffer != nullptr) {
+        *tail_offset = read_pos;
+        *tail_buffer = std::move(buff);
+    }
     return footer_length + 12;
 }
 
@@ -234,7 +242,30 @@ Status Segment::_open(size_t* footer_length_hint, const FooterPointerPB* partial
                                  .buffer_size = lake_io_opts.buffer_size};
 
     ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(opts, _segment_file_info));
-    RETURN_IF_ERROR(Segment::parse_segment_footer(read_file.get(), &footer, footer_length_hint, partial_rowset_footer));
+
+    // Every read of a lake segment is a remote request, so read a larger tail speculatively:
+    // the short key index page is written right before the footer and usually comes along.
+    const bool prefetch_tail = _tablet_manager != nullptr && partial_rowset_footer == nullptr &&
+                               config::lake_segment_open_prefetch_tail_bytes > 0;
+    if (!prefetch_tail) {
+        RETURN_IF_ERROR(
+                Segment::parse_segment_footer(read_file.get(), &footer, footer_length_hint, partial_rowset_footer));
+    } else {
+        size_t read_size = std::max<size_t>(footer_length_hint ? *footer_length_hint : 4096,
+                                            config::lake_segment_open_prefetch_tail_bytes);
+        std::string tail;
+        uint64_t tail_offset = 0;
+        RETURN_IF_ERROR(Segment::parse_segment_footer(read_file.get(), &footer, &read_size, nullptr, &tail,
+                                                      &tail_offset));
+        if (footer_length_hint != nullptr && read_size > *footer_length_hint) {
+            *footer_length_hint = read_size;
+        }
+        PagePointer sk_page(footer.short_key_index_page());
+        if (sk_page.size > 0 && sk_page.offset >= tail_offset &&
+            sk_page.offset + sk_page.size <= tail_offset + tail.size()) {
+            _prefetched_sk_index_page.assign(tail.data() + (sk_page.offset - tail_offset), sk_page.size);
+        }
+    }
     RETURN_IF_ERROR(_create_column_readers(&footer));
     _num_rows = footer.num_rows();
     _short_key_index_page = PagePointer(footer.short_key_index_page());
@@ -274,7 +305,8 @@ struct SegmentZoneMapPruner {
         if (const auto it = parent->_column_readers.find(column_unique_id); it == parent->_column_readers.end()) {
             return false;
         } else {
-            return it->second->has_zone_map() && !it->second->segment_zone_map_filter({col_pred}) &&
+            return (it->second->has_zone_map() || it->second->has_json_flat_zone_map()) &&
+                   !it->second->segment_zone_map_filter({col_pred}) &&
                    (tablet_column.is_key() || parent->_use_segment_zone_map_filter(read_options));
         }
     }
@@ -346,14 +378,24 @@ Status Segment::load_index(const LakeIOOptions& lake_io_opts) {
 
 Status Segment::_load_index(const LakeIOOptions& lake_io_opts) {
     // read and parse short key index page
-    RandomAccessFileOptions file_opts{.skip_fill_local_cache = !lake_io_opts.fill_data_cache,
-                                      .buffer_size = lake_io_opts.buffer_size};
-    ASSIGN_OR_RETURN(auto read_file, _fs->new_random_access_file(file_opts, _segment_file_info));
-
+    std::unique_ptr<io::SeekableInputStream> read_file;
     PageReadOptions opts;
-    opts.use_page_cache = !config::disable_storage_page_cache;
+    if (!_prefetched_sk_index_page.empty()) {
+        // The page was fetched together with the footer. It is not put into the page cache because
+        // it is addressed by its offset within the buffer rather than within the file.
+        read_file = std::make_unique<io::ArrayInputStream>(_prefetched_sk_index_page.data(),
+                                                           _prefetched_sk_index_page.size());
+        opts.use_page_cache = false;
+        opts.page_pointer = PagePointer(0, _short_key_index_page.size);
+    } else {
+        RandomAccessFileOptions file_opts{.skip_fill_local_cache = !lake_io_opts.fill_data_cache,
+                                          .buffer_size = lake_io_opts.buffer_size};
+        ASSIGN_OR_RETURN(read_file, _fs->new_random_access_file(file_opts, _segment_file_info));
+        opts.use_page_cache = !config::disable_storage_page_cache;
+        opts.page_pointer = _short_key_index_page;
+    }
+    DeferOp release_prefetched([this] { std::string().swap(_prefetched_sk_index_page); });
     opts.read_file = read_file.get();
-    opts.page_pointer = _short_key_index_page;
     opts.codec = nullptr; // short key index page uses NO_COMPRESSION for now
     OlapReaderStatistics tmp_stats;
     opts.stats = &tmp_stats;
@@ -378,6 +420,49 @@ bool Segment::has_loaded_index() const {
     return invoked(_load_index_once);
 }
 
+Status Segment::load_ordinal_indexes(const std::vector<ColumnUID>& column_uids, const LakeIOOptions& lake_io_opts,
+                                     OlapReaderStatistics* stats) {
+    std::vector<ColumnReader*> readers;
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (ColumnUID uid : column_uids) {
+        auto* reader = column_with_uid(uid);
+        if (reader == nullptr) {
+            continue;
+        }
+        PagePointer page = reader->ordinal_index_page();
+        if (page.size == 0) {
+            continue;
+        }
+        readers.emplace_back(reader);
+        ranges.emplace_back(page.offset, page.size);
+    }
+    // Nothing to coalesce, the column iterators will load their own index.
+    if (readers.size() < 2) {
+        return Status::OK();
+    }
+
+    RandomAccessFileOptions file_opts{.skip_fill_local_cache = !lake_io_opts.fill_data_cache,
+                                      .buffer_size = lake_io_opts.buffer_size};
+    ASSIGN_OR_RETURN(auto rfile, _fs->new_random_access_file(file_opts, _segment_file_info));
+    ASSIGN_OR_RETURN(auto file_size, rfile->get_size());
+    io::SharedBufferedInputStream stream(rfile->stream(), file_name(), file_size);
+    stream.set_coalesce_options(
+            io::SharedBufferedInputStream::CoalesceOptions{.max_dist_size = config::io_coalesce_read_max_distance_size,
+                                                           .max_buffer_size = config::io_coalesce_read_max_buffer_size});
+    RETURN_IF_ERROR(stream.set_io_ranges(ranges));
+
+    IndexReadOptions index_opts;
+    index_opts.use_page_cache = config::enable_ordinal_index_memory_page_cache || !config::disable_storage_page_cache;
+    index_opts.kept_in_memory = config::enable_ordinal_index_memory_page_cache;
+    index_opts.lake_io_opts = lake_io_opts;
+    index_opts.read_file = &stream;
+    index_opts.stats = stats;
+    for (auto* reader : readers) {
+        RETURN_IF_ERROR(reader->load_ordinal_index(index_opts));
+    }
+    return Status::OK();
+}
+
 Status Segment::_create_column_readers(SegmentFooterPB* footer) {
     std::unordered_map<uint32_t, uint32_t> column_id_to_footer_ordinal;
     for (uint32_t ordinal = 0, sz = footer->columns().size(); ordinal < sz; ++ordinal) {
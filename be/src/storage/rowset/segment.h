@@ -64,6 +64,7 @@ class IndexReadOptions;
 class Schema;
 class SegmentIterator;
 class SegmentReadOptions;
+struct OlapReaderStatistics;
 
 class BitmapIndexIterator;
 class ColumnReader;
@@ -90,9 +91,13 @@ public:
                                                    const LakeIOOptions& lake_io_opts = {},
                                                    lake::TabletManager* tablet_manager = nullptr);
 
+    // If |tail_buffer| is not null, it receives the bytes read from the file except the trailing
+    // 12 bytes, and |tail_offset| receives their starting offset in the file.
     [[nodiscard]] static StatusOr<size_t> parse_segment_footer(RandomAccessFile* read_file, SegmentFooterPB* footer,
                                                                size_t* footer_length_hint,
-                                                               const FooterPointerPB* partial_rowset_footer);
+                                                               const FooterPointerPB* partial_rowset_footer,
+                                                               std::string* tail_buffer = nullptr,
+                                                               uint64_t* tail_offset = nullptr);
 
     [[nodiscard]] static Status write_segment_footer(WritableFile* write_file, const SegmentFooterPB& footer);
 
@@ -104,6 +109,11 @@ public:
     Status open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer,
                 const LakeIOOptions& lake_io_opts);
 
+    // Load the ordinal indexes of |column_uids| that still need to read an index page. For lake
+    // segments the pages are fetched through one coalesced stream instead of one request per column.
+    Status load_ordinal_indexes(const std::vector<ColumnUID>& column_uids, const LakeIOOptions& lake_io_opts,
+                                OlapReaderStatistics* stats);
+
     // may return EndOfFile
     StatusOr<ChunkIteratorPtr> new_iterator(const Schema& schema, const SegmentReadOptions& read_options);
 
@@ -283,6 +293,9 @@ private:
     uint32_t _segment_id = 0;
     uint32_t _num_rows = 0;
     PagePointer _short_key_index_page;
+    // Raw short key index page prefetched together with the footer of a lake segment,
+    // released once the short key index is loaded.
+    std::string _prefetched_sk_index_page;
 
     // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
     // This means that this segment has no data for that column, which may be added
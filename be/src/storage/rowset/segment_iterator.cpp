@@ -40,6 +40,7 @@
 #include "storage/column_predicate_rewriter.h"
 #include "storage/del_vector.h"
 #include "storage/inverted/index_descriptor.hpp"
+#include "storage/json_flat_path_stats.h"
 #include "storage/lake/update_manager.h"
 #include "storage/olap_runtime_range_pruner.hpp"
 #include "storage/projection_iterator.h"
@@ -279,6 +280,8 @@ private:
     // This function is a unified entry for creating column iterators.
     // `ucid` means unique column id, use it for searching delta column group.
     Status _init_column_iterator_by_cid(const ColumnId cid, const ColumnUID ucid, bool check_dict_enc);
+    // record the json paths read by queries, used to decide the paths to flatten, see JsonFlatPathStats
+    void _record_json_path_reads(const TabletColumn& column, const ColumnAccessPath* access_path);
 
     void _update_stats(io::SeekableInputStream* rfile);
 
@@ -541,6 +544,24 @@ void SegmentIterator::_init_column_access_paths() {
     }
 }
 
+void SegmentIterator::_record_json_path_reads(const TabletColumn& column, const ColumnAccessPath* access_path) {
+    if (column.type() != TYPE_JSON || access_path == nullptr || access_path->children().empty() ||
+        _opts.tablet_id == 0 || is_compaction(_opts.reader_type)) {
+        return;
+    }
+    const ColumnReader* reader = _segment->column_with_uid(column.unique_id());
+    if (reader == nullptr) {
+        return;
+    }
+    std::vector<std::string> paths;
+    std::vector<bool> from_flat;
+    for (const auto& child : access_path->children()) {
+        paths.emplace_back(child->path());
+        from_flat.emplace_back(reader->has_json_flat_path(child->path()));
+    }
+    JsonFlatPathStats::instance()->record_reads(_opts.tablet_id, column.unique_id(), paths, from_flat);
+}
+
 Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const ColumnUID ucid, bool check_dict_enc) {
     ColumnIteratorOptions iter_opts;
     iter_opts.stats = _opts.stats;
@@ -568,6 +589,7 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
     if (col_iter == nullptr) {
         // not found in delta column group, create normal column iterator
         ASSIGN_OR_RETURN(_column_iterators[cid], _segment->new_column_iterator_or_default(col, access_path));
+        _record_json_path_reads(col, access_path);
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
         if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
             _segment->lake_tablet_manager() != nullptr) {
@@ -608,6 +630,17 @@ Status SegmentIterator::_init_column_iterators(const Schema& schema) {
         _column_decoders.resize(n);
     }
 
+    if (config::io_coalesce_lake_read_enable && _segment->lake_tablet_manager() != nullptr) {
+        // Fetch the ordinal index pages of all new columns together before the iterators load them one by one.
+        std::vector<ColumnUID> uids;
+        for (const FieldPtr& f : schema.fields()) {
+            if (_column_iterators[f->id()] == nullptr) {
+                uids.emplace_back(f->uid());
+            }
+        }
+        RETURN_IF_ERROR(_segment->load_ordinal_indexes(uids, _opts.lake_io_opts, _opts.stats));
+    }
+
     bool has_predicate = !_opts.pred_tree.empty();
     _predicate_need_rewrite.resize(n, false);
     for (const FieldPtr& f : schema.fields()) {
@@ -1946,7 +1979,9 @@ struct BloomFilterSupportChecker {
         const bool support =
                 (column_iterators[cid]->has_original_bloom_filter_index() &&
                  col_pred->support_original_bloom_filter()) ||
-                (column_iterators[cid]->has_ngram_bloom_filter_index() && col_pred->support_ngram_bloom_filter());
+                (column_iterators[cid]->has_ngram_bloom_filter_index() && col_pred->support_ngram_bloom_filter()) ||
+                (column_iterators[cid]->has_json_flat_bloom_filter_index() &&
+                 col_pred->type() == PredicateType::kExpr);
         if (support) {
             used_nodes.emplace(&node);
         }
@@ -46,6 +46,7 @@
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
 #include "storage/inverted/index_descriptor.hpp"
+#include "storage/json_flat_path_stats.h"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
 #include "storage/rowset/page_io.h"
@@ -198,6 +199,11 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         }
 
         opts.need_flat = config::enable_json_flat;
+        if (column.type() == LogicalType::TYPE_JSON && opts.need_flat && config::enable_json_flat_hot_paths &&
+            _opts.tablet_id > 0) {
+            opts.flat_json_hot_paths = JsonFlatPathStats::instance()->hot_paths(_opts.tablet_id, column.unique_id(),
+                                                                                config::json_flat_column_max);
+        }
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
         RETURN_IF_ERROR(writer->init());
         _column_writers.push_back(std::move(writer));
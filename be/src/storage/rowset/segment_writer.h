@@ -76,6 +76,8 @@ struct SegmentWriterOptions {
     GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
     SegmentFileMark segment_file_mark;
+    // used to look up the hot json paths of the tablet, 0 if unknown
+    int64_t tablet_id = 0;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -65,6 +65,17 @@ bool SizeTieredCompactionPolicy::need_compaction(double* score, CompactionType*
     return _compaction_type != INVALID_COMPACTION;
 }
 
+int64_t SizeTieredCompactionPolicy::input_rowsets_size() const {
+    if (_compaction_type == INVALID_COMPACTION) {
+        return 0;
+    }
+    int64_t size = 0;
+    for (const auto& rowset : _rowsets) {
+        size += rowset->data_disk_size();
+    }
+    return size;
+}
+
 std::shared_ptr<CompactionTask> SizeTieredCompactionPolicy::create_compaction(TabletSharedPtr tablet) {
     if (_compaction_type != INVALID_COMPACTION) {
         Version output_version;
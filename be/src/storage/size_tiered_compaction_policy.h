@@ -30,6 +30,8 @@ public:
     // used to judge whether a tablet should do compaction or not
     bool need_compaction(double* score, CompactionType* type) override;
 
+    int64_t input_rowsets_size() const override;
+
     // used to generate a CompactionTask for tablet
     std::shared_ptr<CompactionTask> create_compaction(TabletSharedPtr tablet) override;
 
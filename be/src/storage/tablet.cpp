@@ -53,6 +53,7 @@
 #include "storage/compaction_manager.h"
 #include "storage/compaction_task.h"
 #include "storage/default_compaction_policy.h"
+#include "storage/json_flat_path_stats.h"
 #include "storage/olap_common.h"
 #include "storage/olap_define.h"
 #include "storage/rowset/rowset_factory.h"
@@ -1351,6 +1352,11 @@ void Tablet::get_compaction_status(std::string* json_result) {
     rowsets_count.SetUint64(rowsets.size());
     root.AddMember("rowsets_count", rowsets_count, root.GetAllocator());
 
+    // fraction of json path reads served from flat json sub-columns, -1 if no json path is read
+    rapidjson::Value json_flat_read_ratio;
+    json_flat_read_ratio.SetDouble(JsonFlatPathStats::instance()->flat_read_ratio(tablet_id()));
+    root.AddMember("json_flat_read_ratio", json_flat_read_ratio, root.GetAllocator());
+
     rapidjson::Value rowset_details(rapidjson::kArrayType);
     rowset_details.Reserve(rowsets.size(), root.GetAllocator());
     for (int i = 0; i < rowsets.size(); i++) {
@@ -1646,8 +1652,10 @@ bool Tablet::need_compaction() {
         // only the size tiered strategy supports the parallelization of compaction tasks under one tablet
         _compaction_context->type = INVALID_COMPACTION;
         if (_compaction_context->policy->need_compaction(&_compaction_context->score, &_compaction_context->type)) {
+            _compaction_context->input_bytes = _compaction_context->policy->input_rowsets_size();
             return true;
         }
+        _compaction_context->input_bytes = 0;
     }
     return false;
 }
@@ -1658,8 +1666,10 @@ bool Tablet::force_base_compaction() {
         // only the size tiered strategy supports the parallelization of compaction tasks under one tablet
         _compaction_context->type = BASE_COMPACTION;
         if (_compaction_context->policy->need_compaction(&_compaction_context->score, &_compaction_context->type)) {
+            _compaction_context->input_bytes = _compaction_context->policy->input_rowsets_size();
             return true;
         }
+        _compaction_context->input_bytes = 0;
     }
     return false;
 }
@@ -1674,6 +1684,82 @@ double Tablet::compaction_score() {
     return _compaction_context ? _compaction_context->score : 0;
 }
 
+int64_t Tablet::compaction_input_bytes() {
+    if (_updates != nullptr) {
+        return _updates->compaction_input_bytes();
+    }
+    std::lock_guard lock(_compaction_task_lock);
+    return _compaction_context ? _compaction_context->input_bytes : 0;
+}
+
+void Tablet::update_read_stats(const OlapReaderStatistics& stats) {
+    _decay_read_stats();
+    _read_scans.fetch_add(1, std::memory_order_relaxed);
+    _read_segments.fetch_add(stats.segments_read_count, std::memory_order_relaxed);
+    _read_rows_merged.fetch_add(stats.rows_merged, std::memory_order_relaxed);
+    _read_rows_del_vec_filtered.fetch_add(stats.rows_del_vec_filtered, std::memory_order_relaxed);
+}
+
+void Tablet::reset_read_stats() {
+    _read_scans.store(0, std::memory_order_relaxed);
+    _read_segments.store(0, std::memory_order_relaxed);
+    _read_rows_merged.store(0, std::memory_order_relaxed);
+    _read_rows_del_vec_filtered.store(0, std::memory_order_relaxed);
+    _read_stats_decay_time_s.store(UnixSeconds(), std::memory_order_relaxed);
+}
+
+void Tablet::_decay_read_stats() {
+    const int64_t interval = config::compaction_read_amp_decay_interval_sec;
+    if (interval <= 0) {
+        return;
+    }
+    const int64_t now = UnixSeconds();
+    int64_t last = _read_stats_decay_time_s.load(std::memory_order_relaxed);
+    if (last == 0) {
+        // the first scan since the tablet is loaded
+        _read_stats_decay_time_s.compare_exchange_strong(last, now, std::memory_order_relaxed);
+        return;
+    }
+    const int64_t periods = (now - last) / interval;
+    if (periods <= 0 ||
+        !_read_stats_decay_time_s.compare_exchange_strong(last, last + periods * interval, std::memory_order_relaxed)) {
+        return;
+    }
+    // The counters are halved one by one, the concurrent updates may be halved or not, which doesn't matter
+    // for an estimation.
+    const int shift = static_cast<int>(std::min<int64_t>(periods, 62));
+    for (auto* counter : {&_read_scans, &_read_segments, &_read_rows_merged, &_read_rows_del_vec_filtered}) {
+        counter->store(counter->load(std::memory_order_relaxed) >> shift, std::memory_order_relaxed);
+    }
+}
+
+double Tablet::read_amp_score() {
+    return _read_amp_score(compaction_input_bytes());
+}
+
+double Tablet::_read_amp_score(int64_t rewrite_bytes) {
+    _decay_read_stats();
+    int64_t scans = _read_scans.load(std::memory_order_relaxed);
+    if (scans == 0) {
+        return 0;
+    }
+    // After a compaction each scan is expected to open about one segment, merge nothing and
+    // skip no deleted rows, so everything above that is the cost a compaction would save.
+    int64_t extra_segments = std::max<int64_t>(0, _read_segments.load(std::memory_order_relaxed) - scans);
+    double saved_rows = static_cast<double>(extra_segments) * config::compaction_read_amp_segment_cost_rows +
+                        _read_rows_merged.load(std::memory_order_relaxed) +
+                        _read_rows_del_vec_filtered.load(std::memory_order_relaxed);
+    return saved_rows / std::max<int64_t>(1, rewrite_bytes);
+}
+
+double Tablet::read_amp_score_factor() {
+    double weight = config::compaction_read_amp_score_weight;
+    if (weight <= 0) {
+        return 1.0;
+    }
+    return std::min(1.0 + weight * read_amp_score(), std::max(1.0, config::compaction_read_amp_max_score_factor));
+}
+
 void Tablet::stop_compaction() {
     std::lock_guard lock(_compaction_task_lock);
     StorageEngine::instance()->compaction_manager()->stop_compaction(
@@ -1694,6 +1780,8 @@ bool Tablet::enable_compaction() {
 }
 
 void Tablet::get_basic_info(TabletBasicInfo& info) {
+    // taken before _meta_lock, the compaction policies acquire _meta_lock under _compaction_task_lock
+    const int64_t compaction_input_bytes = this->compaction_input_bytes();
     std::shared_lock rdlock(_meta_lock);
     info.table_id = _tablet_meta->table_id();
     info.partition_id = _tablet_meta->partition_id();
@@ -1716,6 +1804,7 @@ void Tablet::get_basic_info(TabletBasicInfo& info) {
         info.num_row = _tablet_meta->num_rows();
         info.data_size = _tablet_meta->tablet_footprint();
     }
+    info.read_amp_score = _read_amp_score(compaction_input_bytes);
 }
 
 int64_t Tablet::data_size() {
@@ -227,6 +227,17 @@ public:
     int64_t last_base_compaction_success_time() { return _last_base_compaction_success_millis; }
     void set_last_base_compaction_success_time(int64_t millis) { _last_base_compaction_success_millis = millis; }
 
+    // Accumulate the read statistics of a finished query scan on this tablet.
+    void update_read_stats(const OlapReaderStatistics& stats);
+    // Clear the accumulated read statistics, called after a compaction changes the rowset layout.
+    void reset_read_stats();
+    // Rows that compacting this tablet is expected to save for the scans seen since the last
+    // compaction, divided by compaction_input_bytes(), the bytes the current candidate rewrites.
+    double read_amp_score();
+    // Factor applied to the compaction score to prefer tablets with a high read amplification,
+    // at most config::compaction_read_amp_max_score_factor.
+    double read_amp_score_factor();
+
     void delete_all_files();
 
     bool check_rowset_id(const RowsetId& rowset_id);
@@ -268,6 +279,9 @@ public:
 
     double compaction_score();
     CompactionType compaction_type();
+    // Bytes of the input rowsets of the compaction candidate found by the last need_compaction(), or by the last
+    // TabletUpdates::get_compaction_score() for primary key tablets. 0 if there is no candidate.
+    int64_t compaction_input_bytes();
 
     void set_compaction_context(std::unique_ptr<CompactionContext>& context);
 
@@ -342,6 +356,9 @@ private:
     bool _contains_rowset(const RowsetId rowset_id);
     Status _contains_version(const Version& version);
     Version _max_continuous_version_from_beginning_unlocked() const;
+    double _read_amp_score(int64_t rewrite_bytes);
+    // Halve the read statistics once per config::compaction_read_amp_decay_interval_sec elapsed.
+    void _decay_read_stats();
     void _delete_inc_rowset_by_version(const Version& version);
     /// Delete stale rowset by version. This method not only delete the version in expired rowset map,
     /// but also delete the version in rowset meta vector.
@@ -438,6 +455,13 @@ private:
 
     std::atomic<TStatusCode::type> _last_cumu_compaction_failure_status = TStatusCode::OK;
 
+    // read statistics of query scans since the last compaction, decayed by _decay_read_stats()
+    std::atomic<int64_t> _read_scans{0};
+    std::atomic<int64_t> _read_segments{0};
+    std::atomic<int64_t> _read_rows_merged{0};
+    std::atomic<int64_t> _read_rows_del_vec_filtered{0};
+    std::atomic<int64_t> _read_stats_decay_time_s{0};
+
     std::atomic<int64_t> _cumulative_point{0};
     std::atomic<int32_t> _newly_created_rowset_num{0};
     std::atomic<int64_t> _last_checkpoint_time{0};
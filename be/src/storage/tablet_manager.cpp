@@ -49,6 +49,7 @@
 #include "runtime/current_thread.h"
 #include "storage/compaction_manager.h"
 #include "storage/data_dir.h"
+#include "storage/json_flat_path_stats.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
@@ -396,6 +397,7 @@ Status TabletManager::drop_tablet(TTabletId tablet_id, TabletDropFlag flag) {
         dropped_tablet = it->second;
         tablet_map.erase(it);
         _remove_tablet_from_partition(*dropped_tablet);
+        JsonFlatPathStats::instance()->erase(tablet_id);
     }
     if (config::enable_event_based_compaction_framework) {
         dropped_tablet->stop_compaction();
@@ -462,6 +464,7 @@ Status TabletManager::drop_tablets_on_error_root_path(const std::vector<TabletIn
                 TabletMap& tablet_map = _get_tablet_map(tablet_id);
                 _remove_tablet_from_partition(*dropped_tablet);
                 tablet_map.erase(tablet_id);
+                JsonFlatPathStats::instance()->erase(tablet_id);
 
                 dropped_tablets.push_back(dropped_tablet);
             }
@@ -804,6 +807,7 @@ TabletSharedPtr TabletManager::find_best_tablet_to_do_update_compaction(DataDir*
             if (table_score <= 0) {
                 continue;
             }
+            table_score = static_cast<int64_t>(table_score * tablet_ptr->read_amp_score_factor());
 
             if (table_score > highest_score) {
                 highest_score = table_score;
@@ -1470,6 +1474,7 @@ Status TabletManager::_drop_tablet_unlocked(TTabletId tablet_id, TabletDropFlag
     TabletSharedPtr dropped_tablet = it->second;
     tablet_map.erase(it);
     _remove_tablet_from_partition(*dropped_tablet);
+    JsonFlatPathStats::instance()->erase(tablet_id);
     if (config::enable_event_based_compaction_framework) {
         dropped_tablet->stop_compaction();
         StorageEngine::instance()->compaction_manager()->remove_candidate(dropped_tablet->tablet_id());
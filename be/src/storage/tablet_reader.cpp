@@ -257,6 +257,10 @@ Status TabletReader::do_get_next(Chunk* chunk) {
         }
     }
     RETURN_IF_ERROR(_collect_iter->get_next(chunk));
+    if (_merge_read) {
+        // every row read from the segments goes through the merge heap
+        _stats.rows_merged = _stats.raw_rows_read;
+    }
     return Status::OK();
 }
 
@@ -356,6 +360,7 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
                seg_iters.size() > 1) {
         // when enable sorted by keys. we need call heap merge for DUP KEYS and PKS
         // but for UNIQ KEYS or AGG KEYS we need build new_aggregate_iterator for them.
+        _merge_read = true;
         if (params.profile != nullptr && (params.is_pipeline || params.profile->parent() != nullptr)) {
             RuntimeProfile* p;
             if (params.is_pipeline) {
@@ -399,6 +404,7 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
         //       |           |           |
         // SegmentIterator  ...    SegmentIterator
         //
+        _merge_read = seg_iters.size() > 1;
         if (params.profile != nullptr && (params.is_pipeline || params.profile->parent() != nullptr)) {
             RuntimeProfile* p;
             if (params.is_pipeline) {
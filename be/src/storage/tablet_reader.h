@@ -105,6 +105,8 @@ private:
     std::shared_ptr<ChunkIterator> _collect_iter;
 
     OlapReaderStatistics _stats;
+    // true if rows are produced by merging more than one segment iterator
+    bool _merge_read = false;
 
     // used for vertical compaction
     bool _is_vertical_merge = false;
@@ -45,6 +45,7 @@
 #include "storage/merge_iterator.h"
 #include "storage/persistent_index.h"
 #include "storage/primary_key_dump.h"
+#include "storage/row_cache.h"
 #include "storage/rows_mapper.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/rowset_factory.h"
@@ -370,6 +371,7 @@ Status TabletUpdates::_load_from_pb(const TabletUpdatesPB& tablet_updates_pb) {
     StorageEngine::instance()->update_manager()->clear_cached_del_vec(tsids_vec);
     StorageEngine::instance()->update_manager()->clear_cached_delta_column_group(tsids_vec);
     StorageEngine::instance()->update_manager()->index_cache().try_remove_by_key(_tablet.tablet_id());
+    StorageEngine::instance()->update_manager()->row_cache()->invalidate_tablet(_tablet.tablet_id());
 
     _update_total_stats(_edit_version_infos[_apply_version_idx]->rowsets, nullptr, nullptr);
     VLOG(1) << "load tablet " << _debug_string(false, true);
@@ -617,6 +619,56 @@ Status TabletUpdates::get_apply_version_and_rowsets(int64_t* version, std::vecto
     return Status::OK();
 }
 
+void TabletUpdates::_try_save_index_snapshot(PrimaryIndex& index, const EditVersionInfo& version_info) {
+    // at most one snapshot of a tablet is being written
+    if (_index_snapshot_running.load() || !index.need_snapshot()) {
+        return;
+    }
+    std::vector<RowsetSharedPtr> rowsets;
+    rowsets.reserve(version_info.rowsets.size());
+    {
+        std::lock_guard<std::mutex> lg(_rowsets_lock);
+        for (uint32_t rsid : version_info.rowsets) {
+            auto itr = _rowsets.find(rsid);
+            if (itr == _rowsets.end()) {
+                return;
+            }
+            rowsets.emplace_back(itr->second);
+        }
+    }
+    // The index is copied under _index_lock held by the apply, and the copy is written to the file in background,
+    // so the apply and the readers of the index are not blocked by the file io.
+    auto content = std::make_shared<std::string>();
+    const int64_t version = version_info.version.major_number();
+    auto st = index.dump_snapshot(version, rowsets, content.get());
+    if (!st.ok()) {
+        LOG(WARNING) << "dump primary index snapshot failed tablet:" << _tablet.tablet_id()
+                     << " version:" << version_info.version.to_string() << " " << st;
+        return;
+    }
+    _index_snapshot_running.store(true);
+    auto tablet = std::static_pointer_cast<Tablet>(_tablet.shared_from_this());
+    st = StorageEngine::instance()->update_manager()->pindex_snapshot_thread_pool()->submit_func(
+            [tablet, content, version]() {
+                MonotonicStopWatch timer;
+                timer.start();
+                auto st = PrimaryIndex::write_snapshot(tablet->schema_hash_path(), *content);
+                if (st.ok()) {
+                    LOG(INFO) << "save primary index snapshot tablet:" << tablet->tablet_id() << " version:" << version
+                              << " bytes:" << content->size() << " duration: " << timer.elapsed_time() / 1000000
+                              << "ms";
+                } else {
+                    LOG(WARNING) << "save primary index snapshot failed tablet:" << tablet->tablet_id()
+                                 << " version:" << version << " " << st;
+                }
+                tablet->updates()->_index_snapshot_running.store(false);
+            });
+    if (!st.ok()) {
+        _index_snapshot_running.store(false);
+        LOG(WARNING) << "submit primary index snapshot task failed tablet:" << _tablet.tablet_id() << " " << st;
+    }
+}
+
 Status TabletUpdates::rowset_commit(int64_t version, const RowsetSharedPtr& rowset, uint32_t wait_time,
                                     bool is_version_overwrite, bool is_double_write) {
     auto span = Tracer::Instance().start_trace("rowset_commit");
@@ -1025,6 +1077,11 @@ void TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo& v
         return;
     }
 
+    // values of the updated columns are changed without updating primary index, so invalidate the cached rows
+    // of the tablet before the new version is visible. Readers look up the index under _index_lock, so a reader
+    // that read the old values must have taken its sequence before this, and its rows are not cached.
+    manager->row_cache()->invalidate_tablet(tablet_id);
+
     // 4. write meta and make it apply.
     {
         std::lock_guard wl(_lock);
@@ -1086,7 +1143,6 @@ void TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo& v
         _apply_version_idx++;
         _apply_version_changed.notify_all();
     }
-
     st = index.on_commited();
     if (!st.ok()) {
         failure_handler("primary index on_commit failed", st);
@@ -1308,6 +1364,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                         failure_handler(msg, true);
                         return;
                     }
+                    manager->row_cache()->erase(tablet_id, *delete_pks);
                 }
             }
             state.release_upserts(i);
@@ -1333,6 +1390,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                 failure_handler(msg, true);
                 return;
             }
+            manager->row_cache()->erase(tablet_id, *deletes[i]);
             state.release_deletes(i);
         }
     } else {
@@ -1389,6 +1447,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                             failure_handler(msg, true);
                             return;
                         }
+                        manager->row_cache()->erase(tablet_id, *delete_pks);
                     }
                 }
                 i++;
@@ -1413,6 +1472,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
                     failure_handler(msg, true);
                     return;
                 }
+                manager->row_cache()->erase(tablet_id, *deletes[loaded_delfile]);
                 state.release_deletes(loaded_delfile);
                 i++;
                 loaded_delfile++;
@@ -1617,6 +1677,7 @@ void TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_i
         return;
     }
     _pk_index_write_amp_score.store(PersistentIndex::major_compaction_score(index_meta));
+    _try_save_index_snapshot(index, version_info);
 
     // if `enable_persistent_index` of tablet is change(maybe changed by alter table)
     // we should try to remove the index_entry from cache
@@ -1776,6 +1837,7 @@ Status TabletUpdates::_do_update(uint32_t rowset_id, int32_t upsert_idx, int32_t
         VLOG(2) << "primary index upsert tid: " << tablet_id << ", cost: " << watch.elapsed_time() << ", "
                 << iostat->print_str();
     }
+    StorageEngine::instance()->update_manager()->row_cache()->erase(tablet_id, *upserts[upsert_idx]);
 
     return Status::OK();
 }
@@ -2276,6 +2338,8 @@ void TabletUpdates::_apply_compaction_commit(const EditVersionInfo& version_info
         return;
     }
     _pk_index_write_amp_score.store(PersistentIndex::major_compaction_score(index_meta));
+    _try_save_index_snapshot(index, version_info);
+    _tablet.reset_read_stats();
 
     {
         // Update the stats of affected rowsets.
@@ -2497,6 +2561,7 @@ void TabletUpdates::remove_expired_versions(int64_t expire_time) {
 }
 
 int64_t TabletUpdates::get_compaction_score() {
+    _compaction_input_bytes.store(0, std::memory_order_relaxed);
     if (_compaction_running || _error) {
         // don't do compaction
         return -1;
@@ -2535,6 +2600,7 @@ int64_t TabletUpdates::get_compaction_score() {
     int64_t total_score = 0;
     size_t total_inputs = 0;
     size_t total_deletes = 0;
+    int64_t total_bytes = 0;
     bool has_error = false;
     std::map<int32_t, std::pair<size_t, size_t>> candidates_by_level;
     {
@@ -2553,6 +2619,7 @@ int64_t TabletUpdates::get_compaction_score() {
                 total_score += itr->second->compaction_score;
                 total_inputs += std::max(1UL, itr->second->num_segments);
                 total_deletes += itr->second->num_dels;
+                total_bytes += itr->second->byte_size;
                 if (config::enable_pk_size_tiered_compaction_strategy) {
                     int32_t level = _calc_compaction_level(itr->second.get());
                     auto candidate_itr = candidates_by_level.find(level);
@@ -2588,6 +2655,7 @@ int64_t TabletUpdates::get_compaction_score() {
             return -1;
         }
     }
+    _compaction_input_bytes.store(total_bytes, std::memory_order_relaxed);
     // scale score to a reasonable range relative to the number of files * 10
     return total_score / std::max(1L, config::update_compaction_size_threshold / 10);
 }
@@ -4849,6 +4917,7 @@ Status TabletUpdates::load_snapshot(const SnapshotMeta& snapshot_meta, bool rest
         index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
         index_entry->value().unload();
         index_cache.release(index_entry);
+        manager->row_cache()->invalidate_tablet(tablet_id);
 
         LOG(INFO) << "load full snapshot done " << _debug_string(false) << ss.str();
 
@@ -4917,6 +4986,7 @@ Status TabletUpdates::clear_meta() {
     // There maybe other thread still use primary index for example ingestion and schema change concurrently
     // If that, the primary index will be release by evict thread.
     StorageEngine::instance()->update_manager()->index_cache().try_remove_by_key(_tablet.tablet_id());
+    StorageEngine::instance()->update_manager()->row_cache()->invalidate_tablet(_tablet.tablet_id());
     STLClearObject(&_rowsets);
     STLClearObject(&_rowset_stats);
     // If this get cleared, every other thread that uses variable should recheck it's valid state after acquiring _lock
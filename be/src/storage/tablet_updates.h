@@ -187,6 +187,9 @@ public:
     // TODO(cbl): estimate more suitable values
     int64_t get_compaction_score();
 
+    // bytes of the rowsets counted by the last get_compaction_score() that found a candidate, otherwise 0
+    int64_t compaction_input_bytes() const { return _compaction_input_bytes.load(std::memory_order_relaxed); }
+
     // perform compaction, should only be called by compaction thread
     Status compaction(MemTracker* mem_tracker);
     Status compaction_for_size_tiered(MemTracker* mem_tracker);
@@ -409,6 +412,9 @@ private:
 
     void _apply_compaction_commit(const EditVersionInfo& version_info);
 
+    // dump the in-memory primary index to a snapshot file if needed, called after the index is committed
+    void _try_save_index_snapshot(PrimaryIndex& index, const EditVersionInfo& version_info);
+
     // wait a version to be applied, so reader can read this version
     // assuming _lock already hold
     Status _wait_for_version(const EditVersion& version, int64_t timeout_ms, std::unique_lock<std::mutex>& lock);
@@ -532,9 +538,12 @@ private:
     BlockingQueue<RowsetSharedPtr> _unused_rowsets;
 
     std::atomic<bool> _compaction_running{false};
+    // whether a snapshot of the primary index is being written in background
+    std::atomic<bool> _index_snapshot_running{false};
     int64_t _last_compaction_time_ms = 0;
     std::atomic<int64_t> _last_compaction_success_millis{0};
     std::atomic<int64_t> _last_compaction_failure_millis{0};
+    std::atomic<int64_t> _compaction_input_bytes{0};
 
     mutable std::mutex _rowset_stats_lock;
     // maintain current version(applied version) rowsets' stats
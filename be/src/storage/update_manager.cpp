@@ -62,6 +62,9 @@ UpdateManager::UpdateManager(MemTracker* mem_tracker)
     _del_vec_cache_mem_tracker = std::make_unique<MemTracker>(-1, "del_vec_cache", mem_tracker);
     _compaction_state_mem_tracker = std::make_unique<MemTracker>(-1, "compaction_state", mem_tracker);
     _delta_column_group_cache_mem_tracker = std::make_unique<MemTracker>(-1, "delta_column_group_cache");
+    _row_cache_mem_tracker = std::make_unique<MemTracker>(-1, "row_cache", mem_tracker);
+    _row_cache = std::make_unique<RowCache>(_row_cache_mem_tracker.get(),
+                                            std::max<int64_t>(config::primary_key_row_cache_capacity, 0));
 
     _index_cache.set_mem_tracker(_index_cache_mem_tracker.get());
     _update_state_cache.set_mem_tracker(_update_state_mem_tracker.get());
@@ -74,6 +77,10 @@ UpdateManager::UpdateManager(MemTracker* mem_tracker)
 
 UpdateManager::~UpdateManager() {
     clear_cache();
+    _row_cache.reset();
+    if (_row_cache_mem_tracker) {
+        _row_cache_mem_tracker.reset();
+    }
     if (_compaction_state_mem_tracker) {
         _compaction_state_mem_tracker.reset();
     }
@@ -103,6 +110,9 @@ Status UpdateManager::init() {
             config::get_pindex_worker_count > max_thread_cnt ? config::get_pindex_worker_count : max_thread_cnt * 2;
     RETURN_IF_ERROR(
             ThreadPoolBuilder("get_pindex").set_max_threads(max_get_thread_cnt).build(&_get_pindex_thread_pool));
+    RETURN_IF_ERROR(ThreadPoolBuilder("pindex_snapshot")
+                            .set_max_threads(std::max(1, config::primary_index_snapshot_worker_count))
+                            .build(&_pindex_snapshot_thread_pool));
 
     _persistent_index_compaction_mgr = std::make_unique<PersistentIndexCompactionManager>();
     RETURN_IF_ERROR(_persistent_index_compaction_mgr->init());
@@ -110,6 +120,9 @@ Status UpdateManager::init() {
 }
 
 void UpdateManager::stop() {
+    if (_pindex_snapshot_thread_pool) {
+        _pindex_snapshot_thread_pool->shutdown();
+    }
     if (_get_pindex_thread_pool) {
         _get_pindex_thread_pool->shutdown();
     }
@@ -409,12 +422,13 @@ void UpdateManager::evict_cache(int64_t memory_urgent_level, int64_t memory_high
 }
 
 string UpdateManager::memory_stats() {
-    return strings::Substitute("index:$0 rowset:$1 compaction:$2 delvec:$3 dcg:$4 total:$5/$6",
+    return strings::Substitute("index:$0 rowset:$1 compaction:$2 delvec:$3 dcg:$4 row:$5 total:$6/$7",
                                PrettyPrinter::print_bytes(_index_cache_mem_tracker->consumption()),
                                PrettyPrinter::print_bytes(_update_state_mem_tracker->consumption()),
                                PrettyPrinter::print_bytes(_compaction_state_mem_tracker->consumption()),
                                PrettyPrinter::print_bytes(_del_vec_cache_mem_tracker->consumption()),
                                PrettyPrinter::print_bytes(_delta_column_group_cache_mem_tracker->consumption()),
+                               PrettyPrinter::print_bytes(_row_cache_mem_tracker->consumption()),
                                PrettyPrinter::print_bytes(_update_mem_tracker->consumption()),
                                PrettyPrinter::print_bytes(_update_mem_tracker->limit()));
 }
@@ -21,6 +21,7 @@
 #include "storage/delta_column_group.h"
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
+#include "storage/row_cache.h"
 #include "util/dynamic_cache.h"
 #include "util/mem_info.h"
 #include "util/parse_util.h"
@@ -95,6 +96,7 @@ public:
 
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
     ThreadPool* get_pindex_thread_pool() { return _get_pindex_thread_pool.get(); }
+    ThreadPool* pindex_snapshot_thread_pool() { return _pindex_snapshot_thread_pool.get(); }
     PersistentIndexCompactionManager* get_pindex_compaction_mgr() { return _persistent_index_compaction_mgr.get(); }
 
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
@@ -103,6 +105,8 @@ public:
 
     DynamicCache<string, RowsetColumnUpdateState>& update_column_state_cache() { return _update_column_state_cache; }
 
+    RowCache* row_cache() { return _row_cache.get(); }
+
     Status get_delta_column_group(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
                                   DeltaColumnGroupList* dcgs);
 
@@ -164,6 +168,9 @@ private:
 
     std::unique_ptr<MemTracker> _compaction_state_mem_tracker;
 
+    std::unique_ptr<RowCache> _row_cache;
+    std::unique_ptr<MemTracker> _row_cache_mem_tracker;
+
     std::atomic<int64_t> _last_clear_expired_cache_millis{0};
 
     // DelVector related states
@@ -178,6 +185,7 @@ private:
 
     std::unique_ptr<ThreadPool> _apply_thread_pool;
     std::unique_ptr<ThreadPool> _get_pindex_thread_pool;
+    std::unique_ptr<ThreadPool> _pindex_snapshot_thread_pool;
     std::unique_ptr<PersistentIndexCompactionManager> _persistent_index_compaction_mgr;
 
     bool _keep_pindex_bf = true;
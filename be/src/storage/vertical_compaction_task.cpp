@@ -35,6 +35,7 @@ namespace starrocks {
 Status VerticalCompactionTask::run_impl() {
     Statistics statistics;
     RETURN_IF_ERROR(_shortcut_compact(&statistics));
+    RETURN_IF_ERROR(_segment_reuse_compact(&statistics));
     RETURN_IF_ERROR(_vertical_compaction_data(&statistics));
     TRACE_COUNTER_INCREMENT("merged_rows", statistics.merged_rows);
     TRACE_COUNTER_INCREMENT("filtered_rows", statistics.filtered_rows);
@@ -0,0 +1,163 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "types/ds_sketches.h"
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+DataSketchesKll::DataSketchesKll(const Slice& src) {
+    if (!deserialize(src)) {
+        LOG(WARNING) << "Failed to init DataSketchesKll from slice, will be reset to empty.";
+    }
+}
+
+bool DataSketchesKll::deserialize(const Slice& slice) {
+    DCHECK(_sketch.is_empty());
+    if (slice.size == 0) {
+        return false;
+    }
+    try {
+        _sketch = Sketch::deserialize(slice.data, slice.size);
+    } catch (std::exception& e) {
+        LOG(WARNING) << "DataSketchesKll deserialize error: " << e.what();
+        return false;
+    }
+    return true;
+}
+
+DataSketchesTheta::DataSketchesTheta()
+        : _sketch(UpdateSketch::builder().set_lg_k(DS_THETA_LG_K).build()),
+          _union(datasketches::theta_union::builder().set_lg_k(DS_THETA_LG_K).build()) {}
+
+DataSketchesTheta::DataSketchesTheta(const Slice& src) : DataSketchesTheta() {
+    if (!deserialize(src)) {
+        LOG(WARNING) << "Failed to init DataSketchesTheta from slice, will be reset to empty.";
+    }
+}
+
+void DataSketchesTheta::merge(const CompactSketch& other) {
+    _union.update(other);
+    _has_union = true;
+}
+
+void DataSketchesTheta::merge(const DataSketchesTheta& other) {
+    if (!other._sketch.is_empty()) {
+        _union.update(other._sketch);
+        _has_union = true;
+    }
+    if (other._has_union) {
+        _union.update(other._union.get_result());
+        _has_union = true;
+    }
+}
+
+bool DataSketchesTheta::deserialize(const Slice& slice) {
+    DCHECK(_sketch.is_empty() && !_has_union);
+    auto sketch = deserialize_compact(slice);
+    if (!sketch.has_value()) {
+        return false;
+    }
+    merge(sketch.value());
+    return true;
+}
+
+DataSketchesTheta::CompactSketch DataSketchesTheta::compact() const {
+    if (!_has_union) {
+        return _sketch.compact();
+    }
+    if (_sketch.is_empty()) {
+        return _union.get_result();
+    }
+    // Combine on a copy so that the state can keep accepting values afterwards.
+    auto u = _union;
+    u.update(_sketch);
+    return u.get_result();
+}
+
+std::string DataSketchesTheta::empty() {
+    static const std::string buf = [] {
+        std::string res;
+        serialize_compact(DataSketchesTheta().compact(), &res);
+        return res;
+    }();
+    return buf;
+}
+
+int64_t DataSketchesTheta::estimate_cardinality() const {
+    return static_cast<int64_t>(compact().get_estimate());
+}
+
+void DataSketchesTheta::clear() {
+    _sketch = UpdateSketch::builder().set_lg_k(DS_THETA_LG_K).build();
+    _union = datasketches::theta_union::builder().set_lg_k(DS_THETA_LG_K).build();
+    _has_union = false;
+}
+
+bool DataSketchesTheta::union_of(const Slice& lhs, const Slice& rhs, std::string* result) {
+    auto a = deserialize_compact(lhs);
+    auto b = deserialize_compact(rhs);
+    if (!a.has_value() || !b.has_value()) {
+        return false;
+    }
+    auto u = datasketches::theta_union::builder().set_lg_k(DS_THETA_LG_K).build();
+    u.update(a.value());
+    u.update(b.value());
+    serialize_compact(u.get_result(), result);
+    return true;
+}
+
+bool DataSketchesTheta::intersect_of(const Slice& lhs, const Slice& rhs, std::string* result) {
+    auto a = deserialize_compact(lhs);
+    auto b = deserialize_compact(rhs);
+    if (!a.has_value() || !b.has_value()) {
+        return false;
+    }
+    datasketches::theta_intersection intersection;
+    intersection.update(a.value());
+    intersection.update(b.value());
+    serialize_compact(intersection.get_result(), result);
+    return true;
+}
+
+bool DataSketchesTheta::a_not_b_of(const Slice& lhs, const Slice& rhs, std::string* result) {
+    auto a = deserialize_compact(lhs);
+    auto b = deserialize_compact(rhs);
+    if (!a.has_value() || !b.has_value()) {
+        return false;
+    }
+    datasketches::theta_a_not_b a_not_b;
+    serialize_compact(a_not_b.compute(a.value(), b.value()), result);
+    return true;
+}
+
+std::optional<DataSketchesTheta::CompactSketch> DataSketchesTheta::deserialize_compact(const Slice& slice) {
+    if (slice.size == 0) {
+        return std::nullopt;
+    }
+    try {
+        return CompactSketch::deserialize(slice.data, slice.size);
+    } catch (std::exception& e) {
+        LOG(WARNING) << "DataSketchesTheta deserialize error: " << e.what();
+        return std::nullopt;
+    }
+}
+
+void DataSketchesTheta::serialize_compact(const CompactSketch& sketch, std::string* result) {
+    auto bytes = sketch.serialize();
+    result->assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+} // namespace starrocks
@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "datasketches/kll_sketch.hpp"
+#include "datasketches/theta_a_not_b.hpp"
+#include "datasketches/theta_intersection.hpp"
+#include "datasketches/theta_sketch.hpp"
+#include "datasketches/theta_union.hpp"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// Accuracy parameter of the KLL sketch, k=200 gives a normalized rank error of about 1.65%.
+const static uint16_t DS_KLL_K = 200;
+// log2 of the nominal entries of the Theta sketch, 4096 entries gives a relative error of about 3%.
+const static uint8_t DS_THETA_LG_K = 12;
+
+// Quantile sketch over doubles, wraps datasketches::kll_sketch. Unlike t-digest (PercentileValue),
+// the rank error of KLL is guaranteed and independent of the data distribution, and merging sketches
+// is lossless with respect to that bound.
+class DataSketchesKll {
+public:
+    using Sketch = datasketches::kll_sketch<double>;
+
+    DataSketchesKll() = default;
+
+    // Deserialize failures are logged and leave an empty sketch.
+    explicit DataSketchesKll(const Slice& src);
+
+    // NaN values are ignored by the sketch.
+    void update(double value) { _sketch.update(value); }
+
+    void merge(const DataSketchesKll& other) { _sketch.merge(other._sketch); }
+
+    // Can be called only when the sketch is empty. Return false if the slice is not a valid KLL sketch.
+    bool deserialize(const Slice& slice);
+
+    std::vector<uint8_t> serialize() const { return _sketch.serialize(); }
+
+    bool is_empty() const { return _sketch.is_empty(); }
+
+    uint64_t count() const { return _sketch.get_n(); }
+
+    // |rank| must be in [0, 1] and the sketch must not be empty.
+    double quantile(double rank) const { return _sketch.get_quantile(rank); }
+
+    // Normalized rank of |value|, the sketch must not be empty.
+    double rank(double value) const { return _sketch.get_rank(value); }
+
+    std::string to_string() const { return _sketch.to_string(); }
+
+    void clear() { _sketch = Sketch(DS_KLL_K); }
+
+private:
+    Sketch _sketch{DS_KLL_K};
+};
+
+// Distinct count sketch that supports set operations, wraps datasketches theta sketches.
+// Raw values go into an update sketch, serialized sketches are merged into a theta union,
+// the two parts are only combined when the result is needed.
+class DataSketchesTheta {
+public:
+    using UpdateSketch = datasketches::update_theta_sketch;
+    using CompactSketch = datasketches::compact_theta_sketch;
+
+    DataSketchesTheta();
+
+    // Deserialize failures are logged and leave an empty sketch.
+    explicit DataSketchesTheta(const Slice& src);
+
+    // The value is hashed by the sketch, so callers pass the raw bytes.
+    void update(const void* data, size_t size) { _sketch.update(data, size); }
+
+    void merge(const CompactSketch& other);
+
+    void merge(const DataSketchesTheta& other);
+
+    // Can be called only when the sketch is empty. Return false if the slice is not a valid Theta sketch.
+    bool deserialize(const Slice& slice);
+
+    // Compact, ordered form of all values and sketches added so far.
+    CompactSketch compact() const;
+
+    std::vector<uint8_t> serialize() const { return compact().serialize(); }
+
+    // Serialized form of an empty sketch.
+    static std::string empty();
+
+    int64_t estimate_cardinality() const;
+
+    std::string to_string() const { return compact().to_string(); }
+
+    void clear();
+
+    // Set operations on two serialized sketches. Return false if any input is not a valid Theta sketch.
+    static bool union_of(const Slice& lhs, const Slice& rhs, std::string* result);
+    static bool intersect_of(const Slice& lhs, const Slice& rhs, std::string* result);
+    static bool a_not_b_of(const Slice& lhs, const Slice& rhs, std::string* result);
+
+private:
+    static std::optional<CompactSketch> deserialize_compact(const Slice& slice);
+    static void serialize_compact(const CompactSketch& sketch, std::string* result);
+
+    UpdateSketch _sketch;
+    datasketches::theta_union _union;
+    bool _has_union = false;
+};
+
+} // namespace starrocks
@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace starrocks {
+
+// Count-min sketch over 32-bit hash values, with conservative update.
+// The estimated count of a hash value is never smaller than its real count, and exceeds it by
+// about e * total() / width() at most with high probability.
+class CountMinSketch {
+public:
+    static constexpr uint32_t DEPTH = 4;
+
+    // Each of the DEPTH rows has (1 << log2_width) counters.
+    explicit CountMinSketch(uint32_t log2_width = 12)
+            : _shift(32 - log2_width), _width(1U << log2_width), _counters(DEPTH * _width, 0) {}
+
+    // Add one occurrence of hash, and return its estimated count after that.
+    uint32_t add(uint32_t hash) {
+        uint32_t indexes[DEPTH];
+        uint32_t count = std::numeric_limits<uint32_t>::max();
+        for (uint32_t row = 0; row < DEPTH; ++row) {
+            indexes[row] = row * _width + _index(row, hash);
+            count = std::min(count, _counters[indexes[row]]);
+        }
+        count++;
+        // Conservative update: only raise the counters that are below the new estimation.
+        for (uint32_t row = 0; row < DEPTH; ++row) {
+            _counters[indexes[row]] = std::max(_counters[indexes[row]], count);
+        }
+        _total++;
+        return count;
+    }
+
+    uint32_t estimate(uint32_t hash) const {
+        uint32_t count = std::numeric_limits<uint32_t>::max();
+        for (uint32_t row = 0; row < DEPTH; ++row) {
+            count = std::min(count, _counters[row * _width + _index(row, hash)]);
+        }
+        return count;
+    }
+
+    // Halve all the counts, so that the recent hash values weigh more than the old ones.
+    void decay() {
+        for (auto& counter : _counters) {
+            counter >>= 1;
+        }
+        _total >>= 1;
+    }
+
+    void clear() {
+        std::fill(_counters.begin(), _counters.end(), 0);
+        _total = 0;
+    }
+
+    uint64_t total() const { return _total; }
+    uint32_t width() const { return _width; }
+
+private:
+    // Multiplicative hashing with a different odd seed for each row.
+    uint32_t _index(uint32_t row, uint32_t hash) const { return (hash * SEEDS[row]) >> _shift; }
+
+    static constexpr uint32_t SEEDS[DEPTH] = {0x9E3779B1U, 0x85EBCA77U, 0xC2B2AE3DU, 0x27D4EB2FU};
+
+    const uint32_t _shift;
+    const uint32_t _width;
+    std::vector<uint32_t> _counters;
+    uint64_t _total = 0;
+};
+
+} // namespace starrocks
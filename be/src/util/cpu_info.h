@@ -80,6 +80,25 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the maximum number of NUMA nodes that will be online in the system.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the core with index 'core'.
+    static int get_numa_node_of_core(int core) {
+        DCHECK(core >= 0 && core < max_num_cores_);
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the cores in the NUMA node 'node'.
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK(node >= 0 && node < max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
+    /// Returns the NUMA node of the core that the current thread is running on. The same
+    /// caveat about migration as in get_current_core() applies.
+    static int get_current_numa_node() { return get_numa_node_of_core(get_current_core()); }
+
     static std::string debug_string();
 
 private:
@@ -188,6 +188,10 @@ struct FlatColumnDesc {
 };
 
 void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
+    derived_paths(json_datas, {});
+}
+
+void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas, const std::vector<std::string>& hot_paths) {
     _flat_paths.clear();
     _flat_types.clear();
 
@@ -256,7 +260,15 @@ void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
         }
     }
 
-    if (derived_maps.size() <= config::json_flat_internal_column_min_limit) {
+    // rank of hot paths, the smaller the more important
+    std::unordered_map<std::string_view, size_t> hot_ranks;
+    for (size_t i = 0; i < hot_paths.size(); i++) {
+        if (derived_maps.contains(hot_paths[i])) {
+            hot_ranks.emplace(hot_paths[i], i);
+        }
+    }
+
+    if (hot_ranks.empty() && derived_maps.size() <= config::json_flat_internal_column_min_limit) {
         VLOG(8) << "flat json, internal column too less: " << derived_maps.size()
                 << ", at least: " << config::json_flat_internal_column_min_limit;
         return;
@@ -272,8 +284,18 @@ void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
 
     // sort by hit, casts
     std::vector<pair<std::string_view, FlatColumnDesc>> top_hits(derived_maps.begin(), derived_maps.end());
+    auto hot_rank = [&](std::string_view name) {
+        auto iter = hot_ranks.find(name);
+        return iter != hot_ranks.end() ? iter->second : hot_paths.size();
+    };
     std::sort(top_hits.begin(), top_hits.end(),
-              [](const pair<std::string_view, FlatColumnDesc>& a, const pair<std::string_view, FlatColumnDesc>& b) {
+              [&](const pair<std::string_view, FlatColumnDesc>& a, const pair<std::string_view, FlatColumnDesc>& b) {
+                  // check hot paths, the more frequently read, the higher the priority.
+                  size_t a_rank = hot_rank(a.first);
+                  size_t b_rank = hot_rank(b.first);
+                  if (a_rank != b_rank) {
+                      return a_rank < b_rank;
+                  }
                   // check hits, the higher the hit rate, the higher the priority.
                   if (a.second.hits != b.second.hits) {
                       return a.second.hits > b.second.hits;
@@ -295,7 +317,9 @@ void JsonFlattener::derived_paths(std::vector<ColumnPtr>& json_datas) {
         const auto& [name, desc] = top_hits[i];
         // check sparsity
         // same key may appear many times in json, so we need avoid duplicate compute hits
-        if (desc.multi_times <= 0 && desc.hits >= total_rows * config::json_flat_sparsity_factor) {
+        // hot paths are always flattened, so segments of a tablet share the same flat schema after compaction
+        bool dense = desc.hits >= total_rows * config::json_flat_sparsity_factor;
+        if (desc.multi_times <= 0 && (dense || hot_ranks.contains(name))) {
             _flat_paths.emplace_back(name);
             _flat_types.emplace_back(desc.type);
         }
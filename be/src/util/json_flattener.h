@@ -47,6 +47,11 @@ public:
 
     void derived_paths(std::vector<ColumnPtr>& json_datas);
 
+    // same as above, but |hot_paths| (most important first) are preferred to other paths and
+    // are flattened as long as they appear in the data, regardless of the sparsity and the
+    // number of keys.
+    void derived_paths(std::vector<ColumnPtr>& json_datas, const std::vector<std::string>& hot_paths);
+
     std::vector<std::string>& get_flat_paths() { return _flat_paths; }
 
     std::vector<LogicalType> get_flat_types();
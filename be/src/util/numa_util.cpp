@@ -0,0 +1,167 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/numa_util.h"
+
+#include <linux/mempolicy.h>
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "util/cpu_info.h"
+#include "util/errno.h"
+
+namespace starrocks {
+
+static thread_local int tls_numa_node = -1;
+
+// The cores that the process is allowed to run on (cgroup cpuset, taskset). It is computed before
+// any thread is bound, by the first call of node_cpu_sets(), while the affinity is still the one of the process.
+static const cpu_set_t& process_cpu_set() {
+    static const cpu_set_t cpu_set = [] {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+            LOG(WARNING) << "Fail to get the cpu affinity of the process. err: " << errno_to_string(errno);
+            for (int core = 0; core < CpuInfo::get_max_num_cores() && core < CPU_SETSIZE; ++core) {
+                CPU_SET(core, &allowed);
+            }
+        }
+        return allowed;
+    }();
+    return cpu_set;
+}
+
+// The cores of each node that the process is allowed to run on.
+static const std::vector<cpu_set_t>& node_cpu_sets() {
+    static const std::vector<cpu_set_t> cpu_sets = [] {
+        const cpu_set_t& allowed = process_cpu_set();
+        std::vector<cpu_set_t> res(CpuInfo::get_max_num_numa_nodes());
+        for (int node = 0; node < res.size(); ++node) {
+            CPU_ZERO(&res[node]);
+            for (int core : CpuInfo::get_cores_of_numa_node(node)) {
+                if (core < CPU_SETSIZE && CPU_ISSET(core, &allowed)) {
+                    CPU_SET(core, &res[node]);
+                }
+            }
+        }
+        return res;
+    }();
+    return cpu_sets;
+}
+
+bool NumaUtil::is_numa_aware_scheduling_enabled() {
+    return config::enable_pipeline_numa_aware_scheduling && num_nodes() > 1;
+}
+
+int NumaUtil::num_nodes() {
+    return CpuInfo::get_max_num_numa_nodes();
+}
+
+int NumaUtil::next_node() {
+    static std::atomic<uint32_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed) % num_nodes();
+}
+
+Status NumaUtil::bind_current_thread(int node) {
+    if (node == tls_numa_node) {
+        return Status::OK();
+    }
+    const auto& cpu_sets = node_cpu_sets();
+    if (node < 0 || node >= cpu_sets.size()) {
+        return Status::InvalidArgument(strings::Substitute("invalid NUMA node $0", node));
+    }
+    if (CPU_COUNT(&cpu_sets[node]) == 0) {
+        return Status::NotSupported(strings::Substitute("no allowed core in NUMA node $0", node));
+    }
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &cpu_sets[node]) != 0) {
+        return Status::InternalError(strings::Substitute("fail to bind thread to NUMA node $0, err: $1", node,
+                                                         errno_to_string(errno)));
+    }
+    tls_numa_node = node;
+
+    // Pages are placed on the node of the first touch anyway, the preferred policy also covers
+    // the pages touched while the thread is temporarily running elsewhere. It is only a hint.
+    constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> node_mask(node / kBitsPerWord + 1, 0);
+    node_mask[node / kBitsPerWord] |= 1UL << (node % kBitsPerWord);
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, node_mask.data(), node_mask.size() * kBitsPerWord + 1) != 0) {
+        VLOG(2) << "Fail to set the memory policy of NUMA node " << node << ". err: " << errno_to_string(errno);
+    }
+    return Status::OK();
+}
+
+Status NumaUtil::unbind_current_thread() {
+    if (tls_numa_node < 0) {
+        return Status::OK();
+    }
+    // The thread is bound, so node_cpu_sets() and then process_cpu_set() are already computed.
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &process_cpu_set()) != 0) {
+        return Status::InternalError(
+                strings::Substitute("fail to unbind thread from NUMA node $0, err: $1", tls_numa_node,
+                                    errno_to_string(errno)));
+    }
+    tls_numa_node = -1;
+    if (syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0) != 0) {
+        VLOG(2) << "Fail to reset the memory policy. err: " << errno_to_string(errno);
+    }
+    return Status::OK();
+}
+
+int NumaUtil::current_thread_node() {
+    return tls_numa_node;
+}
+
+NumaRemoteAccessCounter::NumaRemoteAccessCounter() {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_NODE | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // Count the calling thread on any cpu.
+    _fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (_fd < 0) {
+        VLOG(2) << "NUMA node-load-misses event is not available. err: " << errno_to_string(errno);
+    }
+}
+
+NumaRemoteAccessCounter::~NumaRemoteAccessCounter() {
+    if (_fd >= 0) {
+        close(_fd);
+    }
+}
+
+int64_t NumaRemoteAccessCounter::read() const {
+    if (_fd < 0) {
+        return 0;
+    }
+    uint64_t value = 0;
+    if (::read(_fd, &value, sizeof(value)) != sizeof(value)) {
+        return 0;
+    }
+    return static_cast<int64_t>(value);
+}
+
+} // namespace starrocks
@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+// Helpers of the NUMA aware scheduling (config::enable_pipeline_numa_aware_scheduling).
+//
+// A fragment instance is assigned to one NUMA node, and the executor threads bind themselves to the cores
+// of the node whose work they are running. Memory is then allocated node-locally, since jemalloc uses
+// per-cpu arenas and pages are placed on the node of the first touch (and the bound threads also prefer
+// the node in their memory policy).
+class NumaUtil {
+public:
+    // Whether the config is on and the machine has more than one NUMA node.
+    static bool is_numa_aware_scheduling_enabled();
+
+    static int num_nodes();
+
+    // Pick a node for a new fragment instance, in a round-robin way.
+    static int next_node();
+
+    // Bind the calling thread to the cores of |node| that the process is allowed to run on,
+    // and prefer |node| when allocating memory. Do nothing if the thread is already bound to |node|.
+    static Status bind_current_thread(int node);
+
+    // Restore the affinity of the process and the default memory policy of the calling thread,
+    // if it is bound by bind_current_thread(). Do nothing otherwise.
+    static Status unbind_current_thread();
+
+    // The node the calling thread is bound to by bind_current_thread(), or -1.
+    static int current_thread_node();
+};
+
+// Counts the loads of the calling thread that missed the local NUMA node, i.e. were served by the memory
+// of a remote node. It relies on the node-load-misses hardware cache event, which is not exposed by every
+// CPU/kernel and may be forbidden by perf_event_paranoid, in which case the counter is invalid.
+class NumaRemoteAccessCounter {
+public:
+    NumaRemoteAccessCounter();
+    ~NumaRemoteAccessCounter();
+
+    NumaRemoteAccessCounter(const NumaRemoteAccessCounter&) = delete;
+    NumaRemoteAccessCounter& operator=(const NumaRemoteAccessCounter&) = delete;
+
+    bool valid() const { return _fd >= 0; }
+
+    // Total number of remote loads since the counter is created, 0 if the counter is invalid.
+    int64_t read() const;
+
+private:
+    int _fd = -1;
+};
+
+} // namespace starrocks
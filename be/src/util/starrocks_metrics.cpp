@@ -70,6 +70,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
 
     REGISTER_STARROCKS_METRIC(memtable_flush_total);
     REGISTER_STARROCKS_METRIC(memtable_finalize_duration_us);
+    REGISTER_STARROCKS_METRIC(memtable_sorted_input_total);
     REGISTER_STARROCKS_METRIC(memtable_flush_duration_us);
     REGISTER_STARROCKS_METRIC(memtable_flush_io_time_us);
     REGISTER_STARROCKS_METRIC(memtable_flush_memory_bytes_total);
@@ -96,6 +97,9 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(delta_column_group_get_hit_cache);
     REGISTER_STARROCKS_METRIC(delta_column_group_get_non_pk_total);
     REGISTER_STARROCKS_METRIC(delta_column_group_get_non_pk_hit_cache);
+    REGISTER_STARROCKS_METRIC(primary_key_row_cache_lookup_total);
+    REGISTER_STARROCKS_METRIC(primary_key_row_cache_hit_total);
+    REGISTER_STARROCKS_METRIC(primary_key_row_cache_bytes_total);
 
     // push request
     _metrics.register_metric("push_requests_total", MetricLabels().add("status", "SUCCESS"),
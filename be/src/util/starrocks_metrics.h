@@ -131,6 +131,12 @@ public:
     METRIC_DEFINE_INT_COUNTER(report_datacache_metrics_requests_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(report_datacache_metrics_requests_failed, MetricUnit::REQUESTS);
 
+    // progress of the datacache warm-up after restart
+    METRIC_DEFINE_INT_GAUGE(datacache_warmup_total_blocks, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(datacache_warmup_cached_blocks, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(datacache_warmup_loaded_blocks, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(datacache_warmup_failed_blocks, MetricUnit::NOUNIT);
+
     METRIC_DEFINE_INT_COUNTER(schema_change_requests_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(schema_change_requests_failed, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(create_rollup_requests_total, MetricUnit::REQUESTS);
@@ -230,6 +236,8 @@ public:
 
     METRIC_DEFINE_INT_COUNTER(memtable_flush_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(memtable_finalize_duration_us, MetricUnit::MICROSECONDS);
+    // memtables finalized without sort because the loaded rows are in order
+    METRIC_DEFINE_INT_COUNTER(memtable_sorted_input_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(memtable_flush_duration_us, MetricUnit::MICROSECONDS);
     METRIC_DEFINE_INT_COUNTER(memtable_flush_io_time_us, MetricUnit::MICROSECONDS);
     // total memory size of memtables
@@ -258,6 +266,9 @@ public:
     METRIC_DEFINE_INT_COUNTER(delta_column_group_get_hit_cache, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(delta_column_group_get_non_pk_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(delta_column_group_get_non_pk_hit_cache, MetricUnit::REQUESTS);
+    METRIC_DEFINE_INT_COUNTER(primary_key_row_cache_lookup_total, MetricUnit::REQUESTS);
+    METRIC_DEFINE_INT_COUNTER(primary_key_row_cache_hit_total, MetricUnit::REQUESTS);
+    METRIC_DEFINE_UINT_GAUGE(primary_key_row_cache_bytes_total, MetricUnit::BYTES);
 
     // Gauges
     METRIC_DEFINE_INT_GAUGE(memory_pool_bytes_total, MetricUnit::BYTES);
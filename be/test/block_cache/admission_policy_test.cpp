@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/admission_policy.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+TEST(AdmissionPolicyTest, create) {
+    ASSERT_EQ(nullptr, AdmissionPolicy::create("none", 1024));
+    ASSERT_EQ(nullptr, AdmissionPolicy::create("", 1024));
+    ASSERT_NE(nullptr, AdmissionPolicy::create("frequency", 1024));
+}
+
+TEST(AdmissionPolicyTest, admit_on_second_access) {
+    FrequencyAdmissionPolicy policy(65536);
+    for (int i = 0; i < 100; i++) {
+        std::string key = fmt::format("file_{}/0", i);
+        ASSERT_FALSE(policy.admit(key));
+        ASSERT_TRUE(policy.admit(key));
+        ASSERT_TRUE(policy.admit(key));
+    }
+    ASSERT_EQ(3, policy.estimate("file_0/0"));
+    ASSERT_EQ(0, policy.estimate("file_not_accessed/0"));
+}
+
+TEST(AdmissionPolicyTest, min_frequency) {
+    int32_t old_frequency = config::datacache_admission_min_frequency;
+    config::datacache_admission_min_frequency = 3;
+    FrequencyAdmissionPolicy policy(1024);
+    ASSERT_FALSE(policy.admit("key"));
+    ASSERT_FALSE(policy.admit("key"));
+    ASSERT_TRUE(policy.admit("key"));
+
+    config::datacache_admission_min_frequency = 1;
+    ASSERT_TRUE(policy.admit("other_key"));
+    config::datacache_admission_min_frequency = old_frequency;
+}
+
+TEST(AdmissionPolicyTest, aging) {
+    FrequencyAdmissionPolicy policy(64);
+    for (int i = 0; i < 15; i++) {
+        policy.admit("hot_key");
+    }
+    ASSERT_EQ(15, policy.estimate("hot_key"));
+    // enough distinct accesses to trigger the periodic halving of all counters
+    for (int i = 0; i < 64 * 10; i++) {
+        policy.admit(fmt::format("cold_key_{}", i));
+    }
+    ASSERT_LT(policy.estimate("hot_key"), 15);
+}
+
+} // namespace starrocks
@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/cache_warmup.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "common/config.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class CacheWarmupTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::create_directories(_dir);
+        _old_max_blocks = config::datacache_warmup_max_blocks;
+    }
+    void TearDown() override {
+        std::filesystem::remove_all(_dir);
+        config::datacache_warmup_max_blocks = _old_max_blocks;
+    }
+
+    const std::string _dir = "./cache_warmup_test";
+    int64_t _old_max_blocks = 0;
+};
+
+TEST_F(CacheWarmupTest, save_and_load_manifest) {
+    std::string manifest = _dir + "/warmup_manifest";
+    {
+        CacheWarmup warmup(nullptr, manifest);
+        warmup.record("s3://bucket/a.parquet", 1 << 20, 100, {0, 262144});
+        warmup.record("s3://bucket/a.parquet", 1 << 20, 100, {0});
+        warmup.record("hdfs://nn/path with\tspace/b.orc", 4096, 0, {0});
+        ASSERT_EQ(3, warmup.num_blocks());
+        ASSERT_OK(warmup.save_manifest());
+    }
+
+    CacheWarmup warmup(nullptr, manifest);
+    ASSERT_OK(warmup.load_manifest());
+    ASSERT_EQ(3, warmup.num_blocks());
+    // the loaded access counts are kept, a new version of a file drops its old blocks
+    warmup.record("s3://bucket/a.parquet", 2 << 20, 200, {524288});
+    ASSERT_EQ(2, warmup.num_blocks());
+}
+
+TEST_F(CacheWarmupTest, load_missing_or_invalid_manifest) {
+    CacheWarmup warmup(nullptr, _dir + "/not_exist");
+    ASSERT_TRUE(warmup.load_manifest().is_not_found());
+
+    std::string manifest = _dir + "/invalid_manifest";
+    {
+        CacheWarmup writer(nullptr, manifest);
+        writer.record("file", 100, 1, {0});
+        ASSERT_OK(writer.save_manifest());
+    }
+    FILE* fp = fopen(manifest.c_str(), "a");
+    ASSERT_NE(nullptr, fp);
+    fputs("not a valid line\n1\t2\t3\tfile2\n", fp);
+    fclose(fp);
+
+    CacheWarmup reader(nullptr, manifest);
+    ASSERT_OK(reader.load_manifest());
+    ASSERT_EQ(1, reader.num_blocks());
+}
+
+TEST_F(CacheWarmupTest, keep_hot_blocks) {
+    config::datacache_warmup_max_blocks = 10;
+    CacheWarmup warmup(nullptr, _dir + "/manifest");
+    for (int i = 0; i < 3; i++) {
+        warmup.record("hot", 1 << 30, 1, {0, 1, 2, 3, 4});
+    }
+    for (int i = 0; i < 30; i++) {
+        warmup.record("cold", 1 << 30, 1, {i});
+    }
+    ASSERT_OK(warmup.save_manifest());
+    ASSERT_EQ(10, warmup.num_blocks());
+
+    CacheWarmup reader(nullptr, _dir + "/manifest");
+    ASSERT_OK(reader.load_manifest());
+    ASSERT_EQ(10, reader.num_blocks());
+    // the hot blocks survive the shrink, a new record of them does not add any block
+    reader.record("hot", 1 << 30, 1, {0, 1, 2, 3, 4});
+    ASSERT_EQ(10, reader.num_blocks());
+}
+
+} // namespace starrocks
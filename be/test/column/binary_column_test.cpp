@@ -291,6 +291,55 @@ PARALLEL_TEST(BinaryColumnTest, test_filter_range) {
     ASSERT_EQ(data[64], "c");
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_append_selective_and_filter_range_mixed_sizes) {
+    // Mix empty, short (<= 16 bytes) and long strings.
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 200; i++) {
+        strings.emplace_back(i % 7 == 0 ? 40 + i % 13 : i % 18, static_cast<char>('a' + i % 26));
+    }
+    auto src = BinaryColumn::create();
+    for (const auto& str : strings) {
+        src->append(Slice(str));
+    }
+
+    std::vector<uint32_t> indexes;
+    for (uint32_t i = 0; i < strings.size(); i += 3) {
+        indexes.push_back(strings.size() - 1 - i);
+    }
+    auto column = BinaryColumn::create();
+    column->append(Slice("prefix"));
+    column->append_selective(*src, indexes.data(), 1, indexes.size() - 1);
+    ASSERT_EQ(indexes.size(), column->size());
+    ASSERT_EQ("prefix", column->get_slice(0).to_string());
+    for (size_t i = 1; i < indexes.size(); i++) {
+        ASSERT_EQ(strings[indexes[i]], column->get_slice(i).to_string());
+    }
+
+    Buffer<uint8_t> filter(strings.size());
+    for (size_t i = 0; i < filter.size(); i++) {
+        filter[i] = i % 5 != 1;
+    }
+    size_t new_size = src->filter_range(filter, 0, filter.size());
+    size_t j = 0;
+    for (size_t i = 0; i < strings.size(); i++) {
+        if (filter[i]) {
+            ASSERT_EQ(strings[i], src->get_slice(j++).to_string());
+        }
+    }
+    ASSERT_EQ(j, new_size);
+    ASSERT_EQ(new_size, src->size());
+
+    // All the strings are empty.
+    auto empty_src = BinaryColumn::create();
+    empty_src->append_default(10);
+    std::vector<uint32_t> empty_indexes{0, 2, 4, 6, 8};
+    auto empty_column = BinaryColumn::create();
+    empty_column->append_selective(*empty_src, empty_indexes.data(), 0, 5);
+    ASSERT_EQ(5, empty_column->size());
+    ASSERT_EQ(0, empty_column->get_bytes().size());
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(BinaryColumnTest, test_resize) {
     auto c = BinaryColumn::create();
@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/binary_view.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace starrocks {
+
+static int sign(int x) {
+    return (x > 0) - (x < 0);
+}
+
+// NOLINTNEXTLINE
+TEST(BinaryViewTest, test_inline) {
+    std::string short_str = "abcdefghijkl";
+    std::string long_str = "abcdefghijklm";
+
+    BinaryView empty;
+    ASSERT_EQ(0, empty.size());
+    ASSERT_TRUE(empty.is_inlined());
+    ASSERT_EQ(BinaryView(Slice()), empty);
+
+    BinaryView short_view(short_str);
+    ASSERT_TRUE(short_view.is_inlined());
+    ASSERT_NE(short_str.data(), short_view.data());
+    ASSERT_EQ(short_str, short_view.to_slice().to_string());
+
+    BinaryView long_view(long_str);
+    ASSERT_FALSE(long_view.is_inlined());
+    ASSERT_EQ(long_str.data(), long_view.data());
+    ASSERT_EQ(long_str, long_view.to_slice().to_string());
+}
+
+// NOLINTNEXTLINE
+TEST(BinaryViewTest, test_compare) {
+    // Strings sharing prefixes, containing zero bytes and crossing the inline size.
+    std::vector<std::string> values = {"",
+                                       std::string("\0", 1),
+                                       std::string("a\0", 2),
+                                       "a",
+                                       "ab",
+                                       "abc",
+                                       "abcd",
+                                       std::string("abcd\0", 5),
+                                       "abcde",
+                                       "abcdefghijkl",
+                                       "abcdefghijklm",
+                                       "abcdefghijklmn",
+                                       "abcdefghijklmz",
+                                       "abce",
+                                       "b",
+                                       "\xff",
+                                       "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff"};
+
+    for (const auto& lhs : values) {
+        for (const auto& rhs : values) {
+            BinaryView lhs_view{Slice(lhs)};
+            BinaryView rhs_view{Slice(rhs)};
+            ASSERT_EQ(sign(Slice(lhs).compare(Slice(rhs))), sign(lhs_view.compare(rhs_view))) << lhs << " " << rhs;
+            ASSERT_EQ(lhs == rhs, lhs_view == rhs_view) << lhs << " " << rhs;
+        }
+    }
+}
+
+} // namespace starrocks
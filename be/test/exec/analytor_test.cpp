@@ -16,7 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exprs/function_context.h"
+#include "runtime/mem_pool.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 class AnalytorTest : public ::testing::Test {
@@ -126,4 +132,152 @@ TEST_F(AnalytorTest, find_partition_end) {
     ASSERT_EQ(analytor3._partition.end, 0);
 }
 
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, segment_tree_process) {
+    TPlanNode plan_node;
+    RowDescriptor row_desc;
+    Analytor analytor(plan_node, row_desc, nullptr, false);
+
+    const auto* max_fn = get_window_function("max", TYPE_INT, TYPE_INT, true, TFunctionBinaryType::BUILTIN, 3);
+    const auto* min_fn = get_window_function("min", TYPE_INT, TYPE_INT, true, TFunctionBinaryType::BUILTIN, 3);
+    ASSERT_NE(max_fn, nullptr);
+    ASSERT_NE(min_fn, nullptr);
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+
+    const int64_t num_rows = 2000;
+    auto data = Int32Column::create();
+    auto nulls = NullColumn::create();
+    for (int64_t i = 0; i < num_rows; i++) {
+        data->append((i * 7919) % 1013);
+        // A run of nulls longer than the frame, and some scattered ones.
+        nulls->append((i >= 600 && i < 800) || i % 11 == 0);
+    }
+    ColumnPtr input = NullableColumn::create(std::move(data), std::move(nulls));
+
+    analytor._agg_functions = {max_fn, min_fn};
+    analytor._agg_fn_ctxs = {ctx.get(), ctx.get()};
+    analytor._agg_fn_types = {{TypeDescriptor(TYPE_INT), true, true}, {TypeDescriptor(TYPE_INT), true, true}};
+    analytor._agg_intput_columns = {{input}, {input}};
+    const size_t min_offset = (max_fn->size() + min_fn->alignof_size() - 1) / min_fn->alignof_size() *
+                              min_fn->alignof_size();
+    analytor._agg_states_offsets = {0, min_offset};
+    analytor._agg_states_total_size = min_offset + min_fn->size();
+    analytor._max_agg_state_align_size = std::max(max_fn->alignof_size(), min_fn->alignof_size());
+    analytor._rows_start_offset = -150;
+    analytor._rows_end_offset = 20;
+
+    MemPool pool;
+    auto allocate = [&]() {
+        return pool.allocate_aligned(analytor._agg_states_total_size, analytor._max_agg_state_align_size);
+    };
+    analytor._managed_fn_states.emplace_back(
+            std::make_unique<ManagedFunctionStates>(&analytor._agg_fn_ctxs, allocate(), &analytor));
+    analytor._managed_fn_states.emplace_back(
+            std::make_unique<ManagedFunctionStates>(&analytor._agg_fn_ctxs, allocate(), &analytor));
+    ManagedFunctionStates expected_states(&analytor._agg_fn_ctxs, allocate(), &analytor);
+
+    const int32_t old_fanout = config::pipeline_analytic_segment_tree_fanout;
+    config::pipeline_analytic_segment_tree_fanout = 4;
+    DeferOp restore([&]() { config::pipeline_analytic_segment_tree_fanout = old_fanout; });
+    analytor._init_segment_tree();
+    ASSERT_EQ(analytor._segment_tree_levels.size(), 3);
+
+    analytor._partition.start = 0;
+    analytor._partition.end = num_rows;
+    analytor._partition.is_real = true;
+
+    int64_t removed = 0;
+    for (int64_t row = 0; row < num_rows; row++) {
+        // Simulate the streaming process which removes the buffered rows before the frame.
+        if (row == 1000) {
+            removed = 700;
+            input->remove_first_n_values(removed);
+            analytor._partition.remove_first_n(removed);
+        }
+        const int64_t position = row - removed;
+        const int64_t frame_start = position + analytor._rows_start_offset;
+        const int64_t frame_end = position + analytor._rows_end_offset + 1;
+
+        analytor._reset_window_state();
+        analytor._update_window_batch_with_segment_tree(frame_start, frame_end);
+
+        for (size_t i = 0; i < 2; i++) {
+            analytor._agg_functions[i]->reset(ctx.get(), analytor._agg_intput_columns[i],
+                                              expected_states.mutable_data() + analytor._agg_states_offsets[i]);
+        }
+        analytor._update_window_batch_for_states(expected_states.mutable_data(),
+                                                 std::max(frame_start, analytor._partition.start),
+                                                 std::min(frame_end, analytor._partition.end));
+
+        for (size_t i = 0; i < 2; i++) {
+            auto actual = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+            auto expected = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+            const size_t offset = analytor._agg_states_offsets[i];
+            analytor._agg_functions[i]->finalize_to_column(
+                    ctx.get(), analytor._managed_fn_states[0]->data() + offset, actual.get());
+            analytor._agg_functions[i]->finalize_to_column(ctx.get(), expected_states.data() + offset,
+                                                           expected.get());
+            ASSERT_EQ(expected->debug_item(0), actual->debug_item(0)) << "row=" << row << ", function=" << i;
+        }
+    }
+
+    analytor._reset_segment_tree();
+    for (const auto& level : analytor._segment_tree_levels) {
+        ASSERT_EQ(level.first_node, 0);
+        ASSERT_EQ(level.nodes[0]->size(), 0);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, offload_input_chunks) {
+    TPlanNode plan_node;
+    RowDescriptor row_desc;
+    Analytor analytor(plan_node, row_desc, nullptr, false);
+
+    auto make_chunk = [](int32_t num_rows) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < num_rows; i++) {
+            column->append(i);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 0);
+        return chunk;
+    };
+    for (int32_t num_rows : {3, 5, 7}) {
+        analytor._input_chunk_first_row_positions.emplace_back(analytor._input_rows);
+        analytor._input_rows += num_rows;
+        analytor._input_chunks.emplace_back(make_chunk(num_rows));
+    }
+    // The first chunk has been output.
+    analytor._input_chunks[0].reset();
+    analytor._output_chunk_index = 1;
+    ASSERT_FALSE(analytor.is_offloading_input_chunks());
+    ASSERT_EQ(analytor.first_offloaded_chunk_index(), -1);
+
+    std::vector<ChunkPtr> offloaded;
+    ASSERT_OK(analytor.offload_input_chunks([&](const ChunkPtr& chunk) {
+        offloaded.emplace_back(chunk);
+        return Status::OK();
+    }));
+    ASSERT_TRUE(analytor.is_offloading_input_chunks());
+    ASSERT_EQ(analytor.first_offloaded_chunk_index(), 1);
+    ASSERT_EQ(analytor.offloadable_bytes(), 0);
+    ASSERT_EQ(offloaded.size(), 2);
+    ASSERT_EQ(offloaded[0]->num_rows(), 5);
+    ASSERT_EQ(offloaded[1]->num_rows(), 7);
+    ASSERT_EQ(analytor._input_chunks[1], nullptr);
+    ASSERT_EQ(analytor._input_chunks[2], nullptr);
+
+    // Chunk size is still available after the chunk is offloaded.
+    ASSERT_EQ(analytor._current_chunk_size(), 5);
+    analytor._output_chunk_index = 2;
+    ASSERT_EQ(analytor._current_chunk_size(), 7);
+
+    // Output chunk of offloaded input chunk only contains the results of window functions.
+    analytor._limit = -1;
+    ChunkPtr output;
+    ASSERT_OK(analytor._output_result_chunk(&output));
+    ASSERT_EQ(output->num_columns(), 0);
+}
+
 } // namespace starrocks
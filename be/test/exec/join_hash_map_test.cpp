@@ -69,9 +69,10 @@ protected:
     static void check_probe_state(const JoinHashTableItems& table_items, const HashTableProbeState& probe_state,
                                   JoinMatchFlag match_flag, uint32_t step, uint32_t match_count,
                                   uint32_t probe_row_count);
-    static void check_build_index(const Buffer<uint32_t>& first, const Buffer<uint32_t>& next, uint32_t row_count);
-    static void check_build_index(const Buffer<uint8_t>& nulls, const Buffer<uint32_t>& first,
-                                  const Buffer<uint32_t>& next, uint32_t row_count);
+    static void check_build_index(const JoinHashTableBuffer& first, const JoinHashTableBuffer& next,
+                                  uint32_t row_count);
+    static void check_build_index(const Buffer<uint8_t>& nulls, const JoinHashTableBuffer& first,
+                                  const JoinHashTableBuffer& next, uint32_t row_count);
     static void check_build_slice(const Buffer<Slice>& slices, uint32_t row_count);
     static void check_build_slice(const Buffer<uint8_t>& nulls, const Buffer<Slice>& slices, uint32_t row_count);
     static void check_build_column(const ColumnPtr& build_column, uint32_t row_count);
@@ -501,7 +502,7 @@ void JoinHashMapTest::check_build_column(const ColumnPtr& build_column, uint32_t
     }
 }
 
-void JoinHashMapTest::check_build_index(const Buffer<uint32_t>& first, const Buffer<uint32_t>& next,
+void JoinHashMapTest::check_build_index(const JoinHashTableBuffer& first, const JoinHashTableBuffer& next,
                                         uint32_t row_count) {
     ASSERT_EQ(first.size(), JoinHashMapHelper::calc_bucket_size(row_count));
     ASSERT_EQ(next.size(), row_count + 1);
@@ -526,8 +527,8 @@ void JoinHashMapTest::check_build_index(const Buffer<uint32_t>& first, const Buf
     }
 }
 
-void JoinHashMapTest::check_build_index(const Buffer<uint8_t>& nulls, const Buffer<uint32_t>& first,
-                                        const Buffer<uint32_t>& next, uint32_t row_count) {
+void JoinHashMapTest::check_build_index(const Buffer<uint8_t>& nulls, const JoinHashTableBuffer& first,
+                                        const JoinHashTableBuffer& next, uint32_t row_count) {
     ASSERT_EQ(first.size(), JoinHashMapHelper::calc_bucket_size(row_count));
     ASSERT_EQ(next.size(), row_count + 1);
     ASSERT_EQ(next[0], 0);
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "exprs/json_functions.h"
 #include "testutil/assert.h"
@@ -563,4 +564,61 @@ PARALLEL_TEST(JsonParserTest, test_big_json) {
     ASSERT_TRUE(st.is_end_of_file());
 }
 
+PARALLEL_TEST(JsonParserTest, test_json_array_stream_splitter) {
+    // the array is split inside of element, string and escape.
+    std::vector<std::string> pieces = {R"(  [{"key": 1, "s": "a,]}"}, {"k)", R"(ey": 2, "s": "b\)", R"(", [x"}, )",
+                                       R"({"key": 3, "arr": [1, 2]}])", "  \n"};
+
+    JsonArrayStreamSplitter splitter;
+    simdjson::ondemand::parser simdjson_parser;
+    std::vector<int64_t> keys;
+    for (const auto& piece : pieces) {
+        ASSERT_OK(splitter.append(piece.data(), piece.size()));
+
+        char* data = nullptr;
+        size_t len = 0;
+        size_t allocated = 0;
+        auto st = splitter.next_batch(&data, &len, &allocated);
+        if (st.is_end_of_file()) {
+            continue;
+        }
+        ASSERT_OK(st);
+        ASSERT_GE(allocated, len + simdjson::SIMDJSON_PADDING);
+
+        JsonDocumentStreamParser parser(&simdjson_parser);
+        ASSERT_OK(parser.parse(data, len, allocated));
+        simdjson::ondemand::object row;
+        while (true) {
+            ASSERT_OK(parser.get_current(&row));
+            keys.push_back(row.find_field("key").get_int64());
+            st = parser.advance();
+            if (st.is_end_of_file()) {
+                break;
+            }
+            ASSERT_OK(st);
+        }
+    }
+    ASSERT_TRUE(splitter.finish().is_end_of_file());
+    ASSERT_EQ((std::vector<int64_t>{1, 2, 3}), keys);
+}
+
+PARALLEL_TEST(JsonParserTest, test_json_array_stream_splitter_illegal) {
+    {
+        JsonArrayStreamSplitter splitter;
+        std::string input = R"({"key": 1})";
+        ASSERT_TRUE(splitter.append(input.data(), input.size()).is_data_quality_error());
+    }
+    {
+        JsonArrayStreamSplitter splitter;
+        std::string input = R"([{"key": 1}, {"key": 2})";
+        ASSERT_OK(splitter.append(input.data(), input.size()));
+        ASSERT_TRUE(splitter.finish().is_data_quality_error());
+    }
+    {
+        JsonArrayStreamSplitter splitter;
+        std::string input = R"([{"key": 1}] [)";
+        ASSERT_TRUE(splitter.append(input.data(), input.size()).is_data_quality_error());
+    }
+}
+
 } // namespace starrocks
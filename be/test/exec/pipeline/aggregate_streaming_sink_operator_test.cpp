@@ -0,0 +1,242 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/aggregate/aggregate_streaming_sink_operator.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+#include "testutil/exprs_test_helper.h"
+#include "testutil/scoped_updater.h"
+
+namespace starrocks::pipeline {
+
+// key -> (count(v), sum(v))
+using AggResult = std::map<int64_t, std::pair<int64_t, int64_t>>;
+
+// SELECT k, count(v), sum(v) FROM t GROUP BY k, as the first phase of a streaming aggregation in the AUTO mode.
+class AggregateStreamingSinkOperatorTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        _runtime_state = _obj_pool.add(new RuntimeState(TUniqueId(), query_options, TQueryGlobals(), nullptr));
+        _runtime_state->set_query_ctx(_query_ctx.get());
+        // The slots of the input tuple are 0 and 1, and the ones of the intermediate tuple are 2, 3 and 4.
+        auto* desc_tbl = DescTblHelper::generate_desc_tbl(
+                _runtime_state, _obj_pool,
+                DescTblHelper::create_slot_type_desc_info_arrays(
+                        {{{"k", TYPE_BIGINT, false}, {"v", TYPE_BIGINT, false}},
+                         {{"k", TYPE_BIGINT, false}, {"cnt", TYPE_BIGINT, false}, {"sum", TYPE_BIGINT, false}},
+                         {{"k", TYPE_BIGINT, false}, {"cnt", TYPE_BIGINT, false}, {"sum", TYPE_BIGINT, false}}}));
+        _runtime_state->set_desc_tbl(desc_tbl);
+    }
+
+protected:
+    AggregatorPtr _create_aggregator();
+    // Push the chunks of the phases, each of WindowChunks chunks, and check the mode of the heavy-hitter
+    // pre-aggregation after each phase if it is on.
+    void _push_phases(AggregateStreamingSinkOperator* op, const std::vector<std::vector<ChunkPtr>>& phases,
+                      const std::vector<AggrHeavyHitterMode>& modes, AggResult* result);
+    void _run(bool enable_heavy_hitter, const std::vector<AggrHeavyHitterMode>& modes, AggResult* result);
+
+    static void _merge(const ChunkPtr& chunk, AggResult* result);
+
+    // Half of the rows are of the heavy keys [0, NumHeavyKeys), the others are of unique keys.
+    std::vector<ChunkPtr> _make_mixed_chunks();
+    std::vector<ChunkPtr> _make_unique_chunks();
+    std::vector<ChunkPtr> _make_heavy_chunks();
+    std::vector<ChunkPtr> _make_chunks(const std::function<int64_t(size_t)>& key_of_row);
+
+    static constexpr size_t ChunkRows = 1024;
+    static constexpr int64_t NumHeavyKeys = 4;
+
+    ObjectPool _obj_pool;
+    std::unique_ptr<QueryContext> _query_ctx = std::make_unique<QueryContext>();
+    RuntimeState* _runtime_state = nullptr;
+    int64_t _next_unique_key = 1000000;
+    int64_t _next_value = 0;
+    AggResult _expected;
+};
+
+AggregatorPtr AggregateStreamingSinkOperatorTest::_create_aggregator() {
+    auto params = std::make_shared<AggregatorParams>();
+    params->needs_finalize = false;
+    params->has_outer_join_child = false;
+    params->limit = -1;
+    params->enable_pipeline_share_limit = false;
+    params->streaming_preaggregation_mode = TStreamingPreaggregationMode::AUTO;
+    params->intermediate_tuple_id = 1;
+    params->output_tuple_id = 2;
+    params->sql_grouping_keys = "k";
+    params->sql_aggregate_functions = "count(v), sum(v)";
+    params->is_testing = true;
+    params->is_append_only = true;
+    params->is_generate_retract = false;
+    params->count_agg_idx = 0;
+
+    auto bigint = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BIGINT);
+    auto key = ExprsTestHelper::create_slot_expr_node(0, 0, bigint, false);
+    params->grouping_exprs = {ExprsTestHelper::create_slot_expr(key)};
+    for (const auto& name : {"count", "sum"}) {
+        auto value = ExprsTestHelper::create_slot_expr_node(0, 1, bigint, false);
+        auto fn = ExprsTestHelper::create_builtin_function(name, {bigint}, bigint, bigint);
+        params->aggregate_functions.emplace_back(ExprsTestHelper::create_aggregate_expr(fn, {value}));
+    }
+    params->init();
+    return std::make_shared<Aggregator>(std::move(params));
+}
+
+std::vector<ChunkPtr> AggregateStreamingSinkOperatorTest::_make_chunks(
+        const std::function<int64_t(size_t)>& key_of_row) {
+    std::vector<ChunkPtr> chunks;
+    for (size_t i = 0; i < AggrHeavyHitterContext::WindowChunks; ++i) {
+        auto keys = Int64Column::create();
+        auto values = Int64Column::create();
+        for (size_t row = 0; row < ChunkRows; ++row) {
+            const int64_t key = key_of_row(row);
+            const int64_t value = _next_value++ % 7 + 1;
+            keys->append(key);
+            values->append(value);
+            _expected[key].first += 1;
+            _expected[key].second += value;
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(keys), 0);
+        chunk->append_column(std::move(values), 1);
+        chunks.emplace_back(std::move(chunk));
+    }
+    return chunks;
+}
+
+std::vector<ChunkPtr> AggregateStreamingSinkOperatorTest::_make_mixed_chunks() {
+    return _make_chunks([this](size_t row) {
+        return row % 2 == 0 ? static_cast<int64_t>(row / 2) % NumHeavyKeys : _next_unique_key++;
+    });
+}
+
+std::vector<ChunkPtr> AggregateStreamingSinkOperatorTest::_make_unique_chunks() {
+    return _make_chunks([this](size_t row) { return _next_unique_key++; });
+}
+
+std::vector<ChunkPtr> AggregateStreamingSinkOperatorTest::_make_heavy_chunks() {
+    return _make_chunks([](size_t row) { return static_cast<int64_t>(row % NumHeavyKeys); });
+}
+
+void AggregateStreamingSinkOperatorTest::_merge(const ChunkPtr& chunk, AggResult* result) {
+    const auto& keys = chunk->get_column_by_index(0);
+    const auto& counts = chunk->get_column_by_index(1);
+    const auto& sums = chunk->get_column_by_index(2);
+    for (size_t i = 0; i < chunk->num_rows(); ++i) {
+        auto& entry = (*result)[keys->get(i).get_int64()];
+        entry.first += counts->get(i).get_int64();
+        entry.second += sums->get(i).get_int64();
+    }
+}
+
+void AggregateStreamingSinkOperatorTest::_push_phases(AggregateStreamingSinkOperator* op,
+                                                       const std::vector<std::vector<ChunkPtr>>& phases,
+                                                       const std::vector<AggrHeavyHitterMode>& modes,
+                                                       AggResult* result) {
+    auto& aggregator = op->_aggregator;
+    for (size_t phase = 0; phase < phases.size(); ++phase) {
+        for (const auto& chunk : phases[phase]) {
+            ASSERT_OK(op->push_chunk(_runtime_state, chunk));
+            // Drain the streamed chunks like the source operator.
+            while (!aggregator->is_chunk_buffer_empty()) {
+                _merge(aggregator->poll_chunk_buffer(), result);
+            }
+        }
+        if (op->_heavy_hitter_context != nullptr) {
+            ASSERT_EQ(AggrHeavyHitterContext::get_mode_string(modes[phase]),
+                      AggrHeavyHitterContext::get_mode_string(op->_heavy_hitter_context->mode))
+                    << "phase " << phase;
+        }
+    }
+}
+
+void AggregateStreamingSinkOperatorTest::_run(bool enable_heavy_hitter, const std::vector<AggrHeavyHitterMode>& modes,
+                                              AggResult* result) {
+    SCOPED_UPDATE(bool, config::enable_streaming_agg_heavy_hitter_preaggregation, enable_heavy_hitter);
+    auto aggregator = _create_aggregator();
+    AggregateStreamingSinkOperator op(nullptr, 1, 1, 0, aggregator);
+    ASSERT_OK(op.prepare(_runtime_state));
+    ASSERT_EQ(enable_heavy_hitter, op._heavy_hitter_context != nullptr);
+
+    _next_unique_key = 1000000;
+    _next_value = 0;
+    _expected.clear();
+    // Each phase takes a whole window, whose heavy ratio decides the mode of the next window:
+    // half heavy -> SPLIT, no heavy -> PASS_THROUGH, all heavy -> PREAGG, half heavy -> SPLIT.
+    std::vector<std::vector<ChunkPtr>> phases;
+    phases.emplace_back(_make_mixed_chunks());
+    phases.emplace_back(_make_unique_chunks());
+    phases.emplace_back(_make_heavy_chunks());
+    phases.emplace_back(_make_mixed_chunks());
+    ASSERT_NO_FATAL_FAILURE(_push_phases(&op, std::vector<std::vector<ChunkPtr>>(phases.begin(), phases.begin() + 1),
+                                         std::vector<AggrHeavyHitterMode>(modes.begin(), modes.begin() + 1), result));
+    if (enable_heavy_hitter) {
+        // Only the heavy rows are aggregated in the split, so the hash table holds few keys besides
+        // the heavy ones, while the unique keys are streamed.
+        EXPECT_GE(aggregator->hash_map_variant().size(), NumHeavyKeys);
+        EXPECT_LT(aggregator->hash_map_variant().size(), 64);
+        EXPECT_GT(aggregator->heavy_hitter_row_count()->value(), 0);
+        EXPECT_GT(aggregator->preagg_row_count()->value(), 0);
+        EXPECT_GT(aggregator->pass_through_row_count()->value(), 0);
+    }
+    ASSERT_NO_FATAL_FAILURE(_push_phases(&op, std::vector<std::vector<ChunkPtr>>(phases.begin() + 1, phases.end()),
+                                         std::vector<AggrHeavyHitterMode>(modes.begin() + 1, modes.end()), result));
+
+    ASSERT_OK(op.set_finishing(_runtime_state));
+    aggregator->hash_map_variant().visit(
+            [&](auto& hash_map_with_key) { aggregator->it_hash() = aggregator->_state_allocator.begin(); });
+    while (!aggregator->is_ht_eos()) {
+        ChunkPtr chunk = std::make_shared<Chunk>();
+        ASSERT_OK(aggregator->convert_hash_map_to_chunk(_runtime_state->chunk_size(), &chunk));
+        _merge(chunk, result);
+    }
+
+    const int64_t num_input_rows = phases.size() * AggrHeavyHitterContext::WindowChunks * ChunkRows;
+    EXPECT_EQ(num_input_rows, aggregator->num_input_rows());
+    if (enable_heavy_hitter) {
+        // The rows are either aggregated or streamed.
+        EXPECT_EQ(num_input_rows,
+                  aggregator->preagg_row_count()->value() + aggregator->pass_through_row_count()->value());
+        EXPECT_GT(aggregator->preagg_reduced_row_count()->value(), 0);
+    }
+    op.close(_runtime_state);
+}
+
+TEST_F(AggregateStreamingSinkOperatorTest, heavy_hitter_preaggregation) {
+    const std::vector<AggrHeavyHitterMode> modes = {AggrHeavyHitterMode::SPLIT, AggrHeavyHitterMode::PASS_THROUGH,
+                                                    AggrHeavyHitterMode::PREAGG, AggrHeavyHitterMode::SPLIT};
+
+    AggResult result_on;
+    ASSERT_NO_FATAL_FAILURE(_run(true, modes, &result_on));
+    ASSERT_EQ(_expected, result_on);
+
+    AggResult result_off;
+    ASSERT_NO_FATAL_FAILURE(_run(false, modes, &result_off));
+    ASSERT_EQ(_expected, result_off);
+    ASSERT_EQ(result_on, result_off);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,70 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/local_exchange.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace starrocks::pipeline {
+
+TEST(HeavyKeyDetectorTest, test_uniform_keys) {
+    HeavyKeyDetector detector(4);
+    std::mt19937 rng(0);
+    std::vector<uint32_t> hash_values(4096);
+    for (int i = 0; i < 64; ++i) {
+        for (auto& hash : hash_values) {
+            hash = rng();
+        }
+        detector.update(hash_values, hash_values.size());
+        ASSERT_FALSE(detector.has_heavy_keys());
+    }
+}
+
+TEST(HeavyKeyDetectorTest, test_skewed_keys) {
+    const size_t num_rows = 4096;
+    HeavyKeyDetector detector(4);
+    std::mt19937 rng(0);
+    std::vector<uint32_t> hash_values(num_rows);
+
+    // Half of the rows have the key 7, which takes more than the share of one of the 4 partitions.
+    auto fill = [&](uint32_t heavy_key) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            hash_values[i] = (i % 2 == 0) ? heavy_key : rng();
+        }
+    };
+
+    fill(7);
+    detector.update(hash_values, num_rows);
+    // Not enough samples yet.
+    ASSERT_FALSE(detector.has_heavy_keys());
+
+    for (int i = 0; i < 32; ++i) {
+        fill(7);
+        detector.update(hash_values, num_rows);
+    }
+    ASSERT_EQ(std::vector<uint32_t>{7}, detector.heavy_keys());
+    ASSERT_TRUE(detector.is_heavy(7));
+    ASSERT_FALSE(detector.is_heavy(8));
+
+    // The heavy key changes, and the counts of the old one decay.
+    for (int i = 0; i < 1024; ++i) {
+        fill(8);
+        detector.update(hash_values, num_rows);
+    }
+    ASSERT_EQ(std::vector<uint32_t>{8}, detector.heavy_keys());
+}
+
+} // namespace starrocks::pipeline
@@ -165,6 +165,45 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(SubQuerySharedDriverQueueTest, test_numa_node_queues) {
+    SubQuerySharedDriverQueue queue;
+    queue.numa_node_queues.resize(2);
+
+    FragmentContext fragment_ctx0;
+    fragment_ctx0.set_numa_node(0);
+    FragmentContext fragment_ctx1;
+    fragment_ctx1.set_numa_node(1);
+    FragmentContext fragment_ctx_any;
+
+    auto driver0 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, &fragment_ctx0, nullptr, -1);
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, &fragment_ctx1, nullptr, -1);
+    auto driver_any = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, &fragment_ctx_any, nullptr, -1);
+
+    queue.put(driver0.get());
+    queue.put(driver1.get());
+    queue.put(driver_any.get());
+    ASSERT_EQ(3, queue.size());
+    ASSERT_EQ(1, queue.numa_node_queues[0].size());
+    ASSERT_EQ(1, queue.numa_node_queues[1].size());
+    ASSERT_EQ(1, queue.queue.size());
+
+    // The test thread is not bound to any node, so it takes the unassigned driver first and then steals the others.
+    ASSERT_EQ(driver_any.get(), queue.take(false));
+    ASSERT_EQ(driver1.get(), queue.take(false));
+    ASSERT_EQ(driver0.get(), queue.take(false));
+    ASSERT_TRUE(queue.empty());
+
+    // A cancelled driver in a node queue is skipped.
+    queue.put(driver0.get());
+    queue.put(driver1.get());
+    driver0->set_in_ready_queue(true);
+    queue.cancel(driver0.get());
+    ASSERT_EQ(driver0.get(), queue.take(false));
+    ASSERT_EQ(driver1.get(), queue.take(false));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_TRUE(queue.numa_node_queues[0].empty());
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
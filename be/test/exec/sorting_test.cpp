@@ -25,6 +25,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/merge_path.h"
+#include "exec/sorting/radix_sort.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exprs/column_ref.h"
@@ -551,6 +552,60 @@ static void test_merge_path(const size_t num_cols, const size_t left_start, cons
     success = true;
 }
 
+TEST(SortingTest, radix_sort_column) {
+    std::default_random_engine e(0);
+    std::uniform_int_distribution<int64_t> values(-100000, 100000);
+    std::uniform_int_distribution<int32_t> nulls(0, 9);
+    std::atomic<bool> cancel{false};
+
+    for (LogicalType type : {TYPE_INT, TYPE_BIGINT, TYPE_DATE, TYPE_DATETIME}) {
+        for (bool nullable : {false, true}) {
+            TypeDescriptor type_desc(type);
+            ColumnPtr column = ColumnHelper::create_column(type_desc, nullable);
+            for (int i = 0; i < 10000; i++) {
+                if (nullable && nulls(e) == 0) {
+                    column->append_nulls(1);
+                    continue;
+                }
+                int64_t value = values(e);
+                if (type == TYPE_INT) {
+                    column->append_datum(Datum((int32_t)value));
+                } else if (type == TYPE_BIGINT) {
+                    column->append_datum(Datum(value * 1000000007L));
+                } else if (type == TYPE_DATE) {
+                    column->append_datum(Datum(DateValue::create(2000 + value % 100, 1 + std::abs(value) % 12, 1)));
+                } else {
+                    column->append_datum(
+                            Datum(TimestampValue::create(2000 + value % 100, 1, 1, std::abs(value) % 24, 0, 0, 0)));
+                }
+            }
+
+            for (bool asc : {true, false}) {
+                for (bool null_first : {true, false}) {
+                    SortDesc desc(asc, null_first);
+                    Permutation radix_perm;
+                    ASSERT_OK(radix_sort_column(cancel, column, type, desc, &radix_perm));
+                    ASSERT_EQ(column->size(), radix_perm.size());
+
+                    Permutation expected_perm;
+                    SortDescs descs;
+                    descs.descs.push_back(desc);
+                    ASSERT_OK(sort_and_tie_columns(cancel, {column->clone_shared()}, descs, &expected_perm));
+
+                    ColumnPtr actual = column->clone_empty();
+                    ColumnPtr expected = column->clone_empty();
+                    materialize_column_by_permutation(actual.get(), {column}, radix_perm);
+                    materialize_column_by_permutation(expected.get(), {column}, expected_perm);
+                    for (size_t i = 0; i < column->size(); i++) {
+                        ASSERT_EQ(0, actual->compare_at(i, i, *expected, desc.null_first))
+                                << "type=" << type << " asc=" << asc << " null_first=" << null_first << " i=" << i;
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST(MergePathTest, test1) {
     for (size_t num_col = 1; num_col <= 2; num_col++) {
         for (size_t left_num_rows = 0; left_num_rows <= 4096; left_num_rows += 2048) {
@@ -39,6 +39,7 @@
 #include "runtime/time_types.h"
 #include "testutil/function_utils.h"
 #include "types/bitmap_value.h"
+#include "types/ds_sketches.h"
 #include "util/slice.h"
 #include "util/thrift_util.h"
 #include "util/unaligned_access.h"
@@ -1293,6 +1294,85 @@ TEST_F(AggregateTest, test_bitmap_nullable) {
     ASSERT_EQ(50, result_data.get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_ds_kll_sketch) {
+    const AggregateFunction* kll_function = get_aggregate_function("ds_kll_sketch", TYPE_DOUBLE, TYPE_VARBINARY, false);
+    const AggregateFunction* union_function =
+            get_aggregate_function("ds_kll_sketch_union", TYPE_VARBINARY, TYPE_VARBINARY, false);
+    auto state1 = ManagedAggrState::create(ctx, kll_function);
+    auto state2 = ManagedAggrState::create(ctx, kll_function);
+
+    auto data_column1 = DoubleColumn::create();
+    auto data_column2 = DoubleColumn::create();
+    for (int i = 0; i < 10000; i++) {
+        (i % 2 ? data_column1 : data_column2)->append(i);
+    }
+
+    const Column* row_column1 = data_column1.get();
+    const Column* row_column2 = data_column2.get();
+    kll_function->update_batch_single_state(ctx, data_column1->size(), &row_column1, state1->state());
+    kll_function->update_batch_single_state(ctx, data_column2->size(), &row_column2, state2->state());
+
+    auto serialized = BinaryColumn::create();
+    kll_function->serialize_to_column(ctx, state1->state(), serialized.get());
+    kll_function->serialize_to_column(ctx, state2->state(), serialized.get());
+
+    // merge the serialized sketches as a rollup would
+    auto union_state = ManagedAggrState::create(ctx, union_function);
+    const Column* serialized_column = serialized.get();
+    union_function->update_batch_single_state(ctx, serialized->size(), &serialized_column, union_state->state());
+
+    auto result_column = BinaryColumn::create();
+    union_function->finalize_to_column(ctx, union_state->state(), result_column.get());
+
+    DataSketchesKll kll(result_column->get_slice(0));
+    ASSERT_EQ(10000, kll.count());
+    // normalized rank error of k=200 is about 1.65%
+    ASSERT_NEAR(5000, kll.quantile(0.5), 10000 * 0.0165);
+    ASSERT_NEAR(9000, kll.quantile(0.9), 10000 * 0.0165);
+    ASSERT_NEAR(0.5, kll.rank(5000), 0.0165);
+}
+
+TEST_F(AggregateTest, test_ds_theta_sketch) {
+    const AggregateFunction* theta_function =
+            get_aggregate_function("ds_theta_sketch", TYPE_VARCHAR, TYPE_VARBINARY, false);
+    const AggregateFunction* union_function =
+            get_aggregate_function("ds_theta_sketch_union", TYPE_VARBINARY, TYPE_VARBINARY, false);
+    auto state = ManagedAggrState::create(ctx, theta_function);
+
+    auto data_column = BinaryColumn::create();
+    for (int i = 0; i < 1000; i++) {
+        data_column->append(std::to_string(i % 300));
+    }
+    const Column* row_column = data_column.get();
+    theta_function->update_batch_single_state(ctx, data_column->size(), &row_column, state->state());
+
+    // streaming pre-aggregation produces one sketch per row
+    ColumnPtr converted = BinaryColumn::create();
+    Columns src{data_column};
+    theta_function->convert_to_serialize_format(ctx, src, 100, &converted);
+    ASSERT_EQ(100, converted->size());
+
+    auto serialized = BinaryColumn::create();
+    theta_function->serialize_to_column(ctx, state->state(), serialized.get());
+    serialized->append(converted->get(0).get_slice());
+
+    auto merge_state = ManagedAggrState::create(ctx, theta_function);
+    theta_function->merge_batch_single_state(ctx, merge_state->state(), converted.get(), 0, converted->size());
+    theta_function->merge_batch_single_state(ctx, merge_state->state(), serialized.get(), 0, serialized->size());
+
+    auto union_state = ManagedAggrState::create(ctx, union_function);
+    const Column* serialized_column = serialized.get();
+    union_function->update_batch_single_state(ctx, serialized->size(), &serialized_column, union_state->state());
+
+    auto result_column = BinaryColumn::create();
+    theta_function->finalize_to_column(ctx, merge_state->state(), result_column.get());
+    union_function->finalize_to_column(ctx, union_state->state(), result_column.get());
+
+    // exact below the nominal entries
+    ASSERT_EQ(300, DataSketchesTheta(result_column->get_slice(0)).estimate_cardinality());
+    ASSERT_EQ(300, DataSketchesTheta(result_column->get_slice(1)).estimate_cardinality());
+}
+
 TEST_F(AggregateTest, test_group_concat) {
     const AggregateFunction* group_concat_function =
             get_aggregate_function("group_concat", TYPE_VARCHAR, TYPE_VARCHAR, false);
@@ -17,6 +17,9 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <functional>
+
+#include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
@@ -608,6 +611,60 @@ TEST_F(VectorizedBinaryPredicateStringTest, nullEqExpr) {
     }
 }
 
+// Compare a column with a constant on both sides, the strings share prefixes and contain zero bytes.
+TEST_F(VectorizedBinaryPredicateStringTest, cmpWithConstExpr) {
+    std::vector<std::string> values = {"",
+                                       std::string("\0", 1),
+                                       std::string("a\0", 2),
+                                       "a",
+                                       "ab",
+                                       "abc",
+                                       "abcd",
+                                       std::string("abcd\0", 5),
+                                       "abcde",
+                                       "abcdefghijklm",
+                                       "abce",
+                                       "b",
+                                       "\xff\xff\xff\xff\xff"};
+    auto column = BinaryColumn::create();
+    for (const auto& value : values) {
+        column->append(Slice(value));
+    }
+
+    std::vector<std::pair<TExprOpcode::type, std::function<bool(int)>>> ops = {
+            {TExprOpcode::EQ, [](int cmp) { return cmp == 0; }}, {TExprOpcode::NE, [](int cmp) { return cmp != 0; }},
+            {TExprOpcode::LT, [](int cmp) { return cmp < 0; }},  {TExprOpcode::LE, [](int cmp) { return cmp <= 0; }},
+            {TExprOpcode::GT, [](int cmp) { return cmp > 0; }},  {TExprOpcode::GE, [](int cmp) { return cmp >= 0; }}};
+    for (const auto& [opcode, expected_fn] : ops) {
+        expr_node.opcode = opcode;
+        for (const auto& constant : values) {
+            for (bool const_first : {false, true}) {
+                std::unique_ptr<Expr> expr(VectorizedBinaryPredicateFactory::from_thrift(expr_node));
+                MockColumnExpr col(expr_node, column);
+                MockConstVectorizedExpr<TYPE_VARCHAR> const_col(expr_node, Slice(constant));
+                if (const_first) {
+                    expr->_children.push_back(&const_col);
+                    expr->_children.push_back(&col);
+                } else {
+                    expr->_children.push_back(&col);
+                    expr->_children.push_back(&const_col);
+                }
+
+                ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+                ASSERT_FALSE(ptr->is_nullable());
+                auto v = std::static_pointer_cast<BooleanColumn>(ptr);
+                ASSERT_EQ(values.size(), v->size());
+                for (size_t j = 0; j < values.size(); ++j) {
+                    int cmp = const_first ? Slice(constant).compare(Slice(values[j]))
+                                          : Slice(values[j]).compare(Slice(constant));
+                    ASSERT_EQ(expected_fn(cmp), (bool)v->get_data()[j])
+                            << "opcode=" << opcode << " row=" << j << " const_first=" << const_first;
+                }
+            }
+        }
+    }
+}
+
 class VectorizedBinaryPredicateArrayTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -17,10 +17,21 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
 #include "exprs/exprs_test_helper.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -433,4 +444,73 @@ TEST_F(VectorizedCompoundPredicateTest, testOnlyNullAndZeroRow) {
     }
 }
 
+// Whether the OR predicate itself, not one of its children, evaluates the OR-chain by multi-pattern matching.
+static bool use_multi_pattern(const Expr* or_expr) {
+    std::string debug_string = or_expr->debug_string();
+    return debug_string.substr(0, debug_string.find(", expr (")).find("multi_pattern=1") != std::string::npos;
+}
+
+TEST_F(VectorizedCompoundPredicateTest, nestedOrOfLike) {
+    auto old_min_predicates = config::like_multi_pattern_min_predicates;
+    config::like_multi_pattern_min_predicates = 3;
+    DeferOp restore_config([&] { config::like_multi_pattern_min_predicates = old_min_predicates; });
+
+    ObjectPool pool;
+    const SlotId slot_id = 1;
+    auto* col_ref = pool.add(new ColumnRef(ExprsTestHelper::create_slot_expr_node(
+            0, slot_id, ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::VARCHAR), false)));
+    auto like = [&](const std::string& pattern) {
+        TExprNode node;
+        node.node_type = TExprNodeType::FUNCTION_CALL;
+        node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        node.num_children = 2;
+        TFunction fn;
+        TFunctionName fn_name;
+        fn_name.__set_function_name("like");
+        fn.__set_name(fn_name);
+        fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        fn.__set_fid(60010);
+        node.__set_fn(fn);
+        auto* expr = pool.add(new VectorizedFunctionCallExpr(node));
+        expr->add_child(col_ref);
+        expr->add_child(pool.add(new VectorizedLiteral(ColumnHelper::create_const_column<TYPE_VARCHAR>(pattern, 1),
+                                                       TypeDescriptor::create_varchar_type(pattern.size()))));
+        return expr;
+    };
+    expr_node.opcode = TExprOpcode::COMPOUND_OR;
+    auto make_or = [&](Expr* lhs, Expr* rhs) {
+        auto* expr = pool.add(VectorizedCompoundPredicateFactory::from_thrift(expr_node));
+        expr->add_child(lhs);
+        expr->add_child(rhs);
+        return expr;
+    };
+    // (((c like '%abc%' or c like '%ab%') or c like 'b%') or c like '%3%'), the middle OR has enough LIKEs
+    // to be evaluated by multi-pattern matching itself, but only the outermost one does it.
+    auto* inner = make_or(like("%abc%"), like("%ab%"));
+    auto* middle = make_or(inner, like("b%"));
+    auto* outer = make_or(middle, like("%3%"));
+
+    ExprContext context(outer);
+    ASSERT_OK(context.prepare(&runtime_state));
+    ASSERT_OK(context.open(&runtime_state));
+    DeferOp close_context([&] { context.close(&runtime_state); });
+    ASSERT_TRUE(use_multi_pattern(outer));
+    ASSERT_FALSE(use_multi_pattern(middle));
+    ASSERT_FALSE(use_multi_pattern(inner));
+
+    auto values = BinaryColumn::create();
+    for (const char* value : {"abc", "xaby", "bcd", "zzz", "k3x"}) {
+        values->append(value);
+    }
+    Chunk chunk;
+    chunk.append_column(values, slot_id);
+    ASSIGN_OR_ABORT(auto result, context.evaluate(&chunk));
+    ASSERT_EQ(5, result->size());
+    std::vector<uint8_t> expected = {1, 1, 1, 0, 1};
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(expected[i], result->get(i).get_uint8()) << i;
+    }
+}
+
 } // namespace starrocks
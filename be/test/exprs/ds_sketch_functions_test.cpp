@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/ds_sketch_functions.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/column_helper.h"
+#include "types/ds_sketches.h"
+
+namespace starrocks {
+
+class DataSketchesFunctionsTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        ctx_ptr.reset(FunctionContext::create_test_context());
+        ctx = ctx_ptr.get();
+    }
+
+protected:
+    static std::string theta_of_range(int begin, int end) {
+        DataSketchesTheta theta;
+        for (int64_t i = begin; i < end; ++i) {
+            theta.update(&i, sizeof(i));
+        }
+        auto bytes = theta.serialize();
+        return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+    }
+
+    std::unique_ptr<FunctionContext> ctx_ptr;
+    FunctionContext* ctx;
+};
+
+TEST_F(DataSketchesFunctionsTest, kllQuantileTest) {
+    DataSketchesKll kll;
+    for (int i = 1; i <= 100; ++i) {
+        kll.update(i);
+    }
+    auto bytes = kll.serialize();
+    auto empty_bytes = DataSketchesKll().serialize();
+
+    auto sketch = BinaryColumn::create();
+    sketch->append(Slice(bytes.data(), bytes.size()));
+    sketch->append(Slice(bytes.data(), bytes.size()));
+    sketch->append(Slice(empty_bytes.data(), empty_bytes.size()));
+    auto rank = DoubleColumn::create();
+    rank->append(0);
+    rank->append(1);
+    rank->append(0.5);
+
+    Columns columns{sketch, rank};
+    auto result = DataSketchesFunctions::ds_kll_quantile(ctx, columns).value();
+    ASSERT_EQ(3, result->size());
+    ASSERT_EQ(1, result->get(0).get_double());
+    ASSERT_EQ(100, result->get(1).get_double());
+    // empty sketch
+    ASSERT_TRUE(result->is_null(2));
+
+    auto ranks = DataSketchesFunctions::ds_kll_rank(ctx, columns).value();
+    ASSERT_EQ(0, ranks->get(0).get_double());
+    ASSERT_EQ(0.01, ranks->get(1).get_double());
+
+    rank->get_data()[0] = 1.5;
+    ASSERT_FALSE(DataSketchesFunctions::ds_kll_quantile(ctx, columns).ok());
+
+    auto invalid = BinaryColumn::create();
+    invalid->append("not a sketch");
+    Columns invalid_columns{invalid, ColumnHelper::create_const_column<TYPE_DOUBLE>(0.5, 1)};
+    ASSERT_FALSE(DataSketchesFunctions::ds_kll_quantile(ctx, invalid_columns).ok());
+}
+
+TEST_F(DataSketchesFunctionsTest, thetaSetOperationTest) {
+    auto lhs = BinaryColumn::create();
+    lhs->append(theta_of_range(0, 1000));
+    auto rhs = BinaryColumn::create();
+    rhs->append(theta_of_range(500, 2000));
+
+    Columns columns{lhs, rhs};
+    auto estimate = [&](const ColumnPtr& column) {
+        Columns args{column};
+        return DataSketchesFunctions::ds_theta_estimate(ctx, args).value()->get(0).get_int64();
+    };
+
+    ASSERT_EQ(1000, estimate(lhs));
+    ASSERT_EQ(2000, estimate(DataSketchesFunctions::ds_theta_union(ctx, columns).value()));
+    ASSERT_EQ(500, estimate(DataSketchesFunctions::ds_theta_intersect(ctx, columns).value()));
+    ASSERT_EQ(500, estimate(DataSketchesFunctions::ds_theta_a_not_b(ctx, columns).value()));
+
+    auto empty = BinaryColumn::create();
+    empty->append(DataSketchesTheta::empty());
+    Columns empty_columns{lhs, empty};
+    ASSERT_EQ(0, estimate(DataSketchesFunctions::ds_theta_intersect(ctx, empty_columns).value()));
+    ASSERT_EQ(1000, estimate(DataSketchesFunctions::ds_theta_a_not_b(ctx, empty_columns).value()));
+
+    auto invalid = BinaryColumn::create();
+    invalid->append("not a sketch");
+    Columns invalid_columns{lhs, invalid};
+    ASSERT_FALSE(DataSketchesFunctions::ds_theta_union(ctx, invalid_columns).ok());
+}
+
+} // namespace starrocks
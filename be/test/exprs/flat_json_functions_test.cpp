@@ -655,4 +655,23 @@ INSTANTIATE_TEST_SUITE_P(FlatJsonPathDeriver, FlatJsonDeriverPaths,
 ));
 // clang-format on
 
+TEST(FlatJsonDeriverHotPaths, hot_paths_first) {
+    auto json_column = JsonColumn::create();
+    ASSIGN_OR_ABORT(auto json1, JsonValue::parse(R"({"a": 1, "b": 2, "c": 3.5, "e": 1})"));
+    ASSIGN_OR_ABORT(auto json2, JsonValue::parse(R"({"a": 2, "b": 3, "d": "x", "e": 2.5})"));
+    json_column->append(&json1);
+    json_column->append(&json2);
+
+    Columns columns{json_column};
+    JsonFlattener jf;
+    const auto old_min_limit = config::json_flat_internal_column_min_limit;
+    DeferOp defer([&]() { config::json_flat_internal_column_min_limit = old_min_limit; });
+    config::json_flat_internal_column_min_limit = 0;
+    // "c" is sparse but hot, "d" is sparse and cold, "e" is promoted from int to double
+    jf.derived_paths(columns, {"c", "b", "not_exists"});
+
+    ASSERT_EQ(std::vector<std::string>({"c", "b", "a", "e"}), jf.get_flat_paths());
+    ASSERT_EQ(std::vector<LogicalType>({TYPE_DOUBLE, TYPE_BIGINT, TYPE_BIGINT, TYPE_DOUBLE}), jf.get_flat_types());
+}
+
 } // namespace starrocks
@@ -658,4 +658,35 @@ TEST_F(LikeTest, constValueLikeComplicateForHyperscan) {
                         .ok());
 }
 
+TEST_F(LikeTest, multiPatternMatch) {
+    std::vector<std::string> patterns;
+    patterns.emplace_back(LikePredicate::convert_like_pattern<true>(Slice("%abc%"), '\\'));
+    patterns.emplace_back(LikePredicate::convert_like_pattern<true>(Slice("x_z"), '\\'));
+    patterns.emplace_back(LikePredicate::convert_like_pattern<true>(Slice("100\\%"), '\\'));
+    patterns.emplace_back("^[0-9]+$");
+    auto state = LikePredicate::compile_multi_patterns(patterns);
+    ASSERT_TRUE(state.ok()) << state.status();
+
+    auto data = BinaryColumn::create();
+    auto null_data = NullColumn::create();
+    std::vector<std::pair<std::string, bool>> cases = {{"xxabcxx", true}, {"abc", true},   {"ab", false},
+                                                       {"xyz", true},     {"xyyz", false}, {"100%", true},
+                                                       {"1000", true},    {"100a", false}, {"", false}};
+    for (const auto& [value, matched] : cases) {
+        data->append(value);
+        null_data->append(0);
+    }
+    data->append("abc");
+    null_data->append(1);
+    auto column = NullableColumn::create(data, null_data);
+
+    auto result = LikePredicate::multi_pattern_match(state.value().get(), column).value();
+    ASSERT_EQ(cases.size() + 1, result->size());
+    for (size_t i = 0; i < cases.size(); i++) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(cases[i].second, result->get(i).get_uint8()) << cases[i].first;
+    }
+    ASSERT_TRUE(result->is_null(cases.size()));
+}
+
 } // namespace starrocks
@@ -37,6 +37,7 @@
 #include "runtime/descriptor_helper.h"
 #include "runtime/mem_tracker.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::parquet {
 
@@ -80,6 +81,8 @@ protected:
 
     HdfsScannerContext* _create_file_random_read_context(const std::string& file_path);
 
+    HdfsScannerContext* _create_bloom_filter_context(HdfsScanStats* stats);
+
     HdfsScannerContext* _create_file_struct_in_struct_read_context(const std::string& file_path);
 
     HdfsScannerContext* _create_file_struct_in_struct_prune_and_no_output_read_context(const std::string& file_path);
@@ -227,6 +230,14 @@ protected:
 
     std::shared_ptr<RowDescriptor> _row_desc = nullptr;
     RuntimeState* _runtime_state = nullptr;
+    // Description: A parquet file written by arrow with bloom filters and two row groups of 100 rows
+    //
+    // c1            c2                  c3
+    // -------------------------------------------
+    // 0, 2, ..198   c1 * 1000000007     "v_" + c1     row group 0
+    // 1, 3, ..199   c1 * 1000000007     "v_" + c1     row group 1
+    std::string _bloom_filter_file_path = "./be/test/formats/parquet/test_data/bloom_filter.parquet";
+
     ObjectPool _pool;
 };
 
@@ -596,6 +607,23 @@ HdfsScannerContext* FileReaderTest::_create_file_random_read_context(const std::
     return ctx;
 }
 
+HdfsScannerContext* FileReaderTest::_create_bloom_filter_context(HdfsScanStats* stats) {
+    auto ctx = _create_scan_context();
+    ctx->stats = stats;
+
+    Utils::SlotDesc slot_descs[] = {
+            {"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)},
+            {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)},
+            {"c3", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR)},
+            {""},
+    };
+    ctx->tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, slot_descs);
+    Utils::make_column_info_vector(ctx->tuple_desc, &ctx->materialized_columns);
+    ctx->scan_range = (_create_scan_range(_bloom_filter_file_path));
+
+    return ctx;
+}
+
 HdfsScannerContext* FileReaderTest::_create_file_struct_in_struct_read_context(const std::string& file_path) {
     auto ctx = _create_scan_context();
 
@@ -1058,6 +1086,65 @@ TEST_F(FileReaderTest, TestSkipRowGroup) {
     ASSERT_TRUE(status.is_end_of_file());
 }
 
+TEST_F(FileReaderTest, TestSkipRowGroupWithBloomFilter) {
+    const bool old_enable = config::parquet_reader_bloom_filter_enable;
+    DeferOp defer([&]() { config::parquet_reader_bloom_filter_enable = old_enable; });
+    config::parquet_reader_bloom_filter_enable = true;
+
+    auto file = _create_file(_bloom_filter_file_path);
+    const int64_t file_size = std::filesystem::file_size(_bloom_filter_file_path);
+    auto create_chunk = []() {
+        ChunkPtr chunk = std::make_shared<Chunk>();
+        _append_column_for_chunk(LogicalType::TYPE_INT, &chunk);
+        _append_column_for_chunk(LogicalType::TYPE_BIGINT, &chunk);
+        _append_column_for_chunk(LogicalType::TYPE_VARCHAR, &chunk);
+        return chunk;
+    };
+
+    // c1 = 100 is in the min/max of both row groups, but only the bloom filter of row group 0 may contain it.
+    {
+        HdfsScanStats stats;
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 100000);
+        auto* ctx = _create_bloom_filter_context(&stats);
+        _create_int_conjunct_ctxs(TExprOpcode::EQ, 0, 100, &ctx->conjunct_ctxs_by_slot[0]);
+        ASSERT_OK(file_reader->init(ctx));
+        ASSERT_EQ(1, file_reader->_row_group_readers.size());
+        ASSERT_EQ(1, stats.bloom_filter_skip_groups);
+        ASSERT_EQ(100, stats.bloom_filter_skip_rows);
+
+        auto chunk = create_chunk();
+        ASSERT_OK(file_reader->get_next(&chunk));
+        ASSERT_EQ(1, chunk->num_rows());
+        ASSERT_EQ(100, chunk->get_column_by_slot_id(0)->get(0).get_int32());
+        chunk = create_chunk();
+        ASSERT_TRUE(file_reader->get_next(&chunk).is_end_of_file());
+    }
+
+    // c3 = "v_1000" is rejected by the bloom filters of both row groups.
+    {
+        HdfsScanStats stats;
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 100000);
+        auto* ctx = _create_bloom_filter_context(&stats);
+        _create_string_conjunct_ctxs(TExprOpcode::EQ, 2, "v_1000", &ctx->conjunct_ctxs_by_slot[2]);
+        ASSERT_OK(file_reader->init(ctx));
+        ASSERT_EQ(0, file_reader->_row_group_readers.size());
+        ASSERT_EQ(2, stats.bloom_filter_skip_groups);
+        ASSERT_EQ(200, stats.bloom_filter_skip_rows);
+    }
+
+    // no row group is skipped when the bloom filter is disabled.
+    {
+        config::parquet_reader_bloom_filter_enable = false;
+        HdfsScanStats stats;
+        auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size, 100000);
+        auto* ctx = _create_bloom_filter_context(&stats);
+        _create_string_conjunct_ctxs(TExprOpcode::EQ, 2, "v_1000", &ctx->conjunct_ctxs_by_slot[2]);
+        ASSERT_OK(file_reader->init(ctx));
+        ASSERT_EQ(2, file_reader->_row_group_readers.size());
+        ASSERT_EQ(0, stats.bloom_filter_skip_groups);
+    }
+}
+
 TEST_F(FileReaderTest, TestMultiFilterWithMultiPage) {
     auto file = _create_file(_file3_path);
     auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
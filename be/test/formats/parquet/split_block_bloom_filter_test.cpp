@@ -0,0 +1,156 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/parquet/split_block_bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "fs/fs.h"
+#include "io/string_input_stream.h"
+#include "testutil/assert.h"
+#include "util/thrift_util.h"
+
+namespace starrocks::parquet {
+
+TEST(SplitBlockBloomFilterTest, test_insert_and_test) {
+    auto column = Int32Column::create();
+    for (int32_t i = 0; i < 100; i++) {
+        column->append(i);
+    }
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(SplitBlockBloomFilter::hash_values(*column, TYPE_INT, tparquet::Type::INT32, &hashes));
+    ASSERT_EQ(100, hashes.size());
+
+    SplitBlockBloomFilter filter(1024);
+    for (uint64_t hash : hashes) {
+        filter.insert_hash(hash);
+    }
+    for (uint64_t hash : hashes) {
+        ASSERT_TRUE(filter.test_hash(hash));
+    }
+
+    // the same value is hashed differently as INT64.
+    std::vector<uint64_t> hashes64;
+    ASSERT_TRUE(SplitBlockBloomFilter::hash_values(*column, TYPE_INT, tparquet::Type::INT64, &hashes64));
+    ASSERT_NE(hashes[0], hashes64[0]);
+
+    auto others = Int32Column::create();
+    for (int32_t i = 1000; i < 2000; i++) {
+        others->append(i);
+    }
+    hashes.clear();
+    ASSERT_TRUE(SplitBlockBloomFilter::hash_values(*others, TYPE_INT, tparquet::Type::INT32, &hashes));
+    size_t false_positives = 0;
+    for (uint64_t hash : hashes) {
+        false_positives += filter.test_hash(hash);
+    }
+    ASSERT_LT(false_positives, 50);
+
+    // unsupported type
+    ASSERT_FALSE(SplitBlockBloomFilter::hash_values(*others, TYPE_INT, tparquet::Type::FLOAT, &hashes));
+}
+
+TEST(SplitBlockBloomFilterTest, test_hash_string) {
+    auto column = BinaryColumn::create();
+    column->append(Slice("hello"));
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(SplitBlockBloomFilter::hash_values(*column, TYPE_VARCHAR, tparquet::Type::BYTE_ARRAY, &hashes));
+    ASSERT_EQ(SplitBlockBloomFilter::hash("hello", 5), hashes[0]);
+    ASSERT_FALSE(SplitBlockBloomFilter::hash_values(*column, TYPE_VARCHAR, tparquet::Type::INT32, &hashes));
+}
+
+TEST(SplitBlockBloomFilterTest, test_read) {
+    SplitBlockBloomFilter filter(4096);
+    std::vector<uint64_t> inserted;
+    for (int64_t i = 0; i < 300; i++) {
+        inserted.push_back(SplitBlockBloomFilter::hash(&i, sizeof(i)));
+        filter.insert_hash(inserted.back());
+    }
+
+    tparquet::BloomFilterHeader header;
+    header.numBytes = 4096;
+    header.algorithm.__set_BLOCK(tparquet::SplitBlockAlgorithm());
+    header.hash.__set_XXHASH(tparquet::XxHash());
+    header.compression.__set_UNCOMPRESSED(tparquet::Uncompressed());
+
+    ThriftSerializer ser(true, 100);
+    uint32_t len = 0;
+    uint8_t* header_ser = nullptr;
+    ASSERT_OK(ser.serialize(&header, &len, &header_ser));
+
+    std::string buffer = "PAR1";
+    buffer.append(reinterpret_cast<char*>(header_ser), len);
+    buffer.append(reinterpret_cast<const char*>(filter.data()), filter.num_bytes());
+    size_t file_size = buffer.size();
+
+    RandomAccessFile file(std::make_shared<io::StringInputStream>(std::move(buffer)), "string-file");
+    ASSIGN_OR_ABORT(auto read_filter, SplitBlockBloomFilter::read(&file, file_size, 4));
+    ASSERT_EQ(4096, read_filter->num_bytes());
+    for (uint64_t hash : inserted) {
+        ASSERT_TRUE(read_filter->test_hash(hash));
+    }
+
+    // corrupted offset and size
+    ASSERT_FALSE(SplitBlockBloomFilter::read(&file, file_size, file_size).ok());
+    ASSERT_FALSE(SplitBlockBloomFilter::read(&file, file_size - 100, 4).ok());
+}
+
+// bloom_filter.parquet is written by parquet-cpp-arrow 26.0.0 with two row groups of 100 rows:
+// row group 0 holds c1 = 0, 2, ..., 198 and row group 1 holds c1 = 1, 3, ..., 199,
+// c2 = c1 * 1000000007 as int64 and c3 = "v_" + c1 as string.
+// Each column chunk has a bloom filter of 128 bytes after a header of 16 bytes.
+TEST(SplitBlockBloomFilterTest, test_read_arrow_written_filter) {
+    const std::string file_path = "./be/test/formats/parquet/test_data/bloom_filter.parquet";
+    ASSIGN_OR_ABORT(auto file, FileSystem::Default()->new_random_access_file(file_path));
+    const int64_t file_size = std::filesystem::file_size(file_path);
+
+    // xxhash64 with seed 0 of the plain encoding.
+    int32_t value = 100;
+    ASSERT_EQ(0x52b4483e71c21342ULL, SplitBlockBloomFilter::hash(&value, sizeof(value)));
+    ASSERT_EQ(0x4f406c0501ec516bULL, SplitBlockBloomFilter::hash("v_100", 5));
+
+    // c1 of row group 0. All the written values are found, and the odd values are rejected
+    // except 85, which is a false positive of the bitset written by arrow.
+    ASSIGN_OR_ABORT(auto c1_filter, SplitBlockBloomFilter::read(file.get(), file_size, 5102));
+    ASSERT_EQ(128, c1_filter->num_bytes());
+    auto c1 = Int32Column::create();
+    for (int32_t i = 0; i < 200; i++) {
+        c1->append(i);
+    }
+    std::vector<uint64_t> hashes;
+    ASSERT_TRUE(SplitBlockBloomFilter::hash_values(*c1, TYPE_INT, tparquet::Type::INT32, &hashes));
+    for (int32_t i = 0; i < 200; i++) {
+        ASSERT_EQ(i % 2 == 0 || i == 85, c1_filter->test_hash(hashes[i])) << i;
+    }
+
+    // c3 of row group 1, whose false positive in [0, 200) is "v_122".
+    ASSIGN_OR_ABORT(auto c3_filter, SplitBlockBloomFilter::read(file.get(), file_size, 5822));
+    auto c3 = BinaryColumn::create();
+    for (int32_t i = 0; i < 200; i++) {
+        c3->append(Slice("v_" + std::to_string(i)));
+    }
+    c3->append(Slice("v_1000"));
+    hashes.clear();
+    ASSERT_TRUE(SplitBlockBloomFilter::hash_values(*c3, TYPE_VARCHAR, tparquet::Type::BYTE_ARRAY, &hashes));
+    for (int32_t i = 0; i < 200; i++) {
+        ASSERT_EQ(i % 2 == 1 || i == 122, c3_filter->test_hash(hashes[i])) << i;
+    }
+    ASSERT_FALSE(c3_filter->test_hash(hashes[200]));
+}
+
+} // namespace starrocks::parquet
@@ -16,9 +16,15 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -179,4 +185,71 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
-} // namespace starrocks::io
\ No newline at end of file
+// Fails the reads that overlap with each other, since the reads of a stream are not thread safe.
+class NonConcurrentInputStream : public TestInputStream {
+public:
+    using TestInputStream::TestInputStream;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        if (_reading.exchange(true)) {
+            return Status::InternalError("concurrent reads of the stream");
+        }
+        // make the overlapping of reads likely if they are not serialized.
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        auto st = TestInputStream::read_at_fully(offset, out, count);
+        _reading = false;
+        return st;
+    }
+
+private:
+    std::atomic<bool> _reading{false};
+};
+
+TEST_F(SharedBufferedInputStreamTest, test_prefetch) {
+    size_t len = 1 * 1024 * 1024; // 1MB
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_coalesce_options({.max_dist_size = 0, .max_buffer_size = 50 * 1024});
+
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("test_prefetch").set_min_threads(4).set_max_threads(4).build(&pool));
+    DeferOp shutdown_pool([&] { pool->shutdown(); });
+    // the prefetch stream must not be shared with the stream of foreground reads.
+    int open_count = 0;
+    sb_stream->set_prefetch_stream(pool.get(), [&]() -> StatusOr<std::shared_ptr<io::SeekableInputStream>> {
+        open_count++;
+        return std::make_shared<NonConcurrentInputStream>(rand_string, len);
+    });
+    ASSERT_TRUE(sb_stream->prefetch_enabled());
+
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (int64_t offset = 0; offset < 1000 * 1024; offset += 100 * 1024) {
+        ranges.emplace_back(offset, 50 * 1024);
+    }
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+    // the stream is opened by the first prefetch.
+    ASSERT_EQ(0, open_count);
+
+    // each call submits a task of the buffers not prefetched yet, so the tasks may run concurrently.
+    for (int64_t end_offset = 100 * 1024; end_offset <= 800 * 1024; end_offset += 100 * 1024) {
+        sb_stream->prefetch(end_offset);
+    }
+
+    // the first 8 buffers, which end before 800k, are prefetched, the last 2 buffers are read when used.
+    std::string buf(50 * 1024, 0);
+    for (int64_t offset = 100 * 1024; offset < 1000 * 1024; offset += 100 * 1024) {
+        ASSERT_OK(sb_stream->read_at_fully(offset, buf.data(), buf.size()));
+        ASSERT_EQ(rand_string.substr(offset, buf.size()), buf);
+    }
+    ASSERT_EQ(1, open_count);
+    ASSERT_EQ(7 * 50 * 1024, sb_stream->prefetch_hit_bytes());
+    ASSERT_EQ(9 * 50 * 1024, sb_stream->shared_io_bytes());
+
+    // the first range is released without being read.
+    sb_stream->release_to_offset(50 * 1024);
+    ASSERT_EQ(50 * 1024, sb_stream->prefetch_wasted_bytes());
+    ASSERT_FALSE(sb_stream->find_shared_buffer(0, 50 * 1024).ok());
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,84 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/huge_page_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+class HugePageAllocatorTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        _old_enable = config::enable_huge_page_for_join_hash_table;
+        _old_min_bytes = config::huge_page_alloc_min_bytes;
+        config::enable_huge_page_for_join_hash_table = true;
+        config::huge_page_alloc_min_bytes = HugePageAllocator::HUGE_PAGE_SIZE;
+    }
+
+    void TearDown() override {
+        config::enable_huge_page_for_join_hash_table = _old_enable;
+        config::huge_page_alloc_min_bytes = _old_min_bytes;
+    }
+
+private:
+    bool _old_enable = false;
+    int64_t _old_min_bytes = 0;
+};
+
+TEST_F(HugePageAllocatorTest, test_allocate) {
+    const size_t length = HugePageAllocator::HUGE_PAGE_SIZE + 100;
+    auto* ptr = static_cast<uint8_t*>(HugePageAllocator::allocate(length));
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % HugePageAllocator::HUGE_PAGE_SIZE);
+    ptr[0] = 1;
+    ptr[length - 1] = 2;
+    HugePageAllocator::free(ptr, length);
+}
+
+TEST_F(HugePageAllocatorTest, test_min_bytes) {
+    ASSERT_EQ(HugePageAllocator::HUGE_PAGE_SIZE, HugePageAllocator::min_bytes(HugePageUsage::JOIN_HASH_TABLE));
+    config::enable_huge_page_for_join_hash_table = false;
+    ASSERT_EQ(std::numeric_limits<size_t>::max(), HugePageAllocator::min_bytes(HugePageUsage::JOIN_HASH_TABLE));
+}
+
+TEST_F(HugePageAllocatorTest, test_buffer) {
+    using TestBuffer = HugePageBuffer<uint32_t, HugePageUsage::JOIN_HASH_TABLE>;
+    const size_t num_huge = HugePageAllocator::HUGE_PAGE_SIZE;
+
+    TestBuffer small(16, 1);
+    TestBuffer large(num_huge, 2);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large.data()) % HugePageAllocator::HUGE_PAGE_SIZE);
+
+    // The allocator captured the threshold when the buffers were created.
+    config::enable_huge_page_for_join_hash_table = false;
+    large.resize(num_huge * 2, 3);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large.data()) % HugePageAllocator::HUGE_PAGE_SIZE);
+    ASSERT_EQ(2, large[0]);
+    ASSERT_EQ(3, large.back());
+
+    TestBuffer plain;
+    plain = std::move(large);
+    ASSERT_EQ(num_huge * 2, plain.size());
+    plain.swap(small);
+    ASSERT_EQ(16, plain.size());
+    ASSERT_EQ(1, plain[15]);
+    ASSERT_EQ(num_huge * 2, small.size());
+}
+
+} // namespace starrocks
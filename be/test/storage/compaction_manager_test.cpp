@@ -31,6 +31,7 @@
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -143,6 +144,95 @@ TEST_F(CompactionManagerTest, test_candidates) {
     }
 }
 
+TEST_F(CompactionManagerTest, test_read_amp_score) {
+    DataDir data_dir("./data_dir");
+    TabletSharedPtr tablet = std::make_shared<Tablet>();
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    tablet_meta->set_tablet_id(1);
+    tablet->set_tablet_meta(tablet_meta);
+    tablet->set_data_dir(&data_dir);
+    tablet->set_tablet_state(TABLET_RUNNING);
+
+    ASSERT_EQ(0.0, tablet->read_amp_score());
+    ASSERT_EQ(1.0, tablet->read_amp_score_factor());
+
+    // a scan that reads a single segment has nothing to gain from compaction
+    OlapReaderStatistics stats;
+    stats.segments_read_count = 1;
+    stats.raw_rows_read = 1000;
+    tablet->update_read_stats(stats);
+    ASSERT_EQ(0.0, tablet->read_amp_score());
+
+    stats.segments_read_count = 5;
+    stats.rows_merged = 1000;
+    stats.rows_del_vec_filtered = 100;
+    tablet->update_read_stats(stats);
+    // 6 segments by 2 scans, no compaction candidate
+    double expect = 4 * config::compaction_read_amp_segment_cost_rows + 1000 + 100;
+    ASSERT_DOUBLE_EQ(expect, tablet->read_amp_score());
+
+    // divided by the input bytes of the candidate, not by the size of the tablet
+    tablet->_compaction_context = std::make_unique<CompactionContext>();
+    tablet->_compaction_context->input_bytes = 1000;
+    ASSERT_EQ(1000, tablet->compaction_input_bytes());
+    ASSERT_DOUBLE_EQ(expect / 1000, tablet->read_amp_score());
+    tablet->_compaction_context->input_bytes = 0;
+
+    auto old_weight = config::compaction_read_amp_score_weight;
+    auto old_max_factor = config::compaction_read_amp_max_score_factor;
+    DeferOp restore_config([&]() {
+        config::compaction_read_amp_score_weight = old_weight;
+        config::compaction_read_amp_max_score_factor = old_max_factor;
+    });
+    config::compaction_read_amp_score_weight = 0.5;
+    config::compaction_read_amp_max_score_factor = 1e9;
+    ASSERT_DOUBLE_EQ(1.0 + 0.5 * expect, tablet->read_amp_score_factor());
+    // the factor is capped
+    config::compaction_read_amp_max_score_factor = 4.0;
+    ASSERT_DOUBLE_EQ(4.0, tablet->read_amp_score_factor());
+    config::compaction_read_amp_score_weight = 0;
+    ASSERT_EQ(1.0, tablet->read_amp_score_factor());
+
+    tablet->reset_read_stats();
+    ASSERT_EQ(0.0, tablet->read_amp_score());
+}
+
+TEST_F(CompactionManagerTest, test_read_amp_score_decay) {
+    DataDir data_dir("./data_dir");
+    TabletSharedPtr tablet = std::make_shared<Tablet>();
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    tablet_meta->set_tablet_id(1);
+    tablet->set_tablet_meta(tablet_meta);
+    tablet->set_data_dir(&data_dir);
+    tablet->set_tablet_state(TABLET_RUNNING);
+
+    auto old_interval = config::compaction_read_amp_decay_interval_sec;
+    DeferOp restore_config([&]() { config::compaction_read_amp_decay_interval_sec = old_interval; });
+    config::compaction_read_amp_decay_interval_sec = 100;
+
+    OlapReaderStatistics stats;
+    stats.segments_read_count = 9;
+    stats.rows_merged = 4000;
+    stats.rows_del_vec_filtered = 400;
+    for (int i = 0; i < 4; i++) {
+        tablet->update_read_stats(stats);
+    }
+    // 36 segments by 4 scans
+    double expect = 32 * config::compaction_read_amp_segment_cost_rows + 16000 + 1600;
+    ASSERT_DOUBLE_EQ(expect, tablet->read_amp_score());
+
+    // two intervals have passed since the statistics were collected, so they are halved twice
+    tablet->_read_stats_decay_time_s -= 2 * config::compaction_read_amp_decay_interval_sec;
+    ASSERT_DOUBLE_EQ(expect / 4, tablet->read_amp_score());
+    // and not again within the same interval
+    ASSERT_DOUBLE_EQ(expect / 4, tablet->read_amp_score());
+
+    // no decay if disabled
+    config::compaction_read_amp_decay_interval_sec = 0;
+    tablet->_read_stats_decay_time_s -= 1000;
+    ASSERT_DOUBLE_EQ(expect / 4, tablet->read_amp_score());
+}
+
 TEST_F(CompactionManagerTest, test_candidates_exceede) {
     config::max_compaction_candidate_num = 10;
     std::vector<CompactionCandidate> candidates;
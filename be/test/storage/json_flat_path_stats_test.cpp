@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/json_flat_path_stats.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+TEST(JsonFlatPathStatsTest, hot_paths_and_ratio) {
+    auto* stats = JsonFlatPathStats::instance();
+    const int64_t tablet_id = 10001;
+    const int32_t column_uid = 3;
+    stats->erase(tablet_id);
+
+    EXPECT_EQ(-1, stats->flat_read_ratio(tablet_id));
+    EXPECT_TRUE(stats->hot_paths(tablet_id, column_uid, 10).empty());
+
+    for (int i = 0; i < 10; i++) {
+        stats->record_reads(tablet_id, column_uid, {"a", "b"}, {true, false});
+    }
+    stats->record_reads(tablet_id, column_uid, {"a"}, {true});
+    stats->record_reads(tablet_id, column_uid, {"rare"}, {false});
+    // another json column of the same tablet
+    stats->record_reads(tablet_id, column_uid + 1, {"x"}, {false});
+
+    // 11 of 23 reads are served from flat columns
+    EXPECT_DOUBLE_EQ(11.0 / 23, stats->flat_read_ratio(tablet_id));
+
+    const auto old_ratio = config::json_flat_hot_path_min_ratio;
+    DeferOp defer([&]() { config::json_flat_hot_path_min_ratio = old_ratio; });
+    config::json_flat_hot_path_min_ratio = 0.1;
+    EXPECT_EQ(std::vector<std::string>({"a", "b"}), stats->hot_paths(tablet_id, column_uid, 10));
+    EXPECT_EQ(std::vector<std::string>({"a"}), stats->hot_paths(tablet_id, column_uid, 1));
+    EXPECT_EQ(std::vector<std::string>({"x"}), stats->hot_paths(tablet_id, column_uid + 1, 10));
+    config::json_flat_hot_path_min_ratio = 0;
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "rare"}), stats->hot_paths(tablet_id, column_uid, 10));
+
+    stats->erase(tablet_id);
+    EXPECT_EQ(-1, stats->flat_read_ratio(tablet_id));
+    EXPECT_TRUE(stats->hot_paths(tablet_id, column_uid, 10).empty());
+}
+
+TEST(JsonFlatPathStatsTest, evict_least_read_path) {
+    auto* stats = JsonFlatPathStats::instance();
+    const int64_t tablet_id = 10002;
+    const int32_t column_uid = 1;
+    stats->erase(tablet_id);
+
+    for (int i = 0; i < 10; i++) {
+        stats->record_reads(tablet_id, column_uid, {"hot"}, {true});
+    }
+    // many distinct paths which are read once, e.g. keys of a map stored as json
+    for (size_t i = 0; i < JsonFlatPathStats::kMaxTrackedPaths * 2; i++) {
+        stats->record_reads(tablet_id, column_uid, {"cold_" + std::to_string(i)}, {false});
+    }
+    // a new path is still tracked when the table is full
+    for (int i = 0; i < 10; i++) {
+        stats->record_reads(tablet_id, column_uid, {"new"}, {true});
+    }
+
+    const auto& column_stats = stats->_shard(tablet_id).tablets[tablet_id].columns[column_uid];
+    EXPECT_EQ(JsonFlatPathStats::kMaxTrackedPaths, column_stats.path_reads.size());
+    EXPECT_EQ(10, column_stats.path_reads.at("hot"));
+    EXPECT_GE(column_stats.path_reads.at("new"), 10);
+
+    const auto old_ratio = config::json_flat_hot_path_min_ratio;
+    DeferOp defer([&]() { config::json_flat_hot_path_min_ratio = old_ratio; });
+    config::json_flat_hot_path_min_ratio = 0.01;
+    EXPECT_EQ(std::vector<std::string>({"new", "hot"}), stats->hot_paths(tablet_id, column_uid, 2));
+
+    stats->erase(tablet_id);
+}
+
+TEST(JsonFlatPathStatsTest, decay) {
+    auto* stats = JsonFlatPathStats::instance();
+    const int64_t tablet_id = 10003;
+    const int32_t column_uid = 1;
+    stats->erase(tablet_id);
+
+    const auto old_interval = config::json_flat_hot_path_decay_interval_sec;
+    const auto old_ratio = config::json_flat_hot_path_min_ratio;
+    DeferOp defer([&]() {
+        config::json_flat_hot_path_decay_interval_sec = old_interval;
+        config::json_flat_hot_path_min_ratio = old_ratio;
+    });
+    config::json_flat_hot_path_decay_interval_sec = 3600;
+    config::json_flat_hot_path_min_ratio = 0.2;
+
+    for (int i = 0; i < 8; i++) {
+        stats->record_reads(tablet_id, column_uid, {"old"}, {true});
+    }
+    stats->record_reads(tablet_id, column_uid, {"once"}, {false});
+    auto& column_stats = stats->_shard(tablet_id).tablets[tablet_id].columns[column_uid];
+    ASSERT_GT(column_stats.decay_time_s, 0);
+
+    // two intervals later, the counts are divided by 4 and "once" is forgotten
+    column_stats.decay_time_s -= 2 * 3600;
+    stats->record_reads(tablet_id, column_uid, {"new"}, {false});
+    EXPECT_EQ(2, column_stats.path_reads.at("old"));
+    EXPECT_EQ(1, column_stats.path_reads.at("new"));
+    EXPECT_EQ(0, column_stats.path_reads.count("once"));
+    EXPECT_EQ(3, column_stats.total_reads);
+
+    // the paths which keep being read take over
+    for (int i = 0; i < 10; i++) {
+        stats->record_reads(tablet_id, column_uid, {"new"}, {false});
+    }
+    EXPECT_EQ(std::vector<std::string>({"new"}), stats->hot_paths(tablet_id, column_uid, 10));
+
+    stats->erase(tablet_id);
+}
+
+} // namespace starrocks
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "column/datum_tuple.h"
@@ -35,6 +36,7 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
@@ -339,6 +341,40 @@ TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testSortedInputFastPath) {
+    const string path = "./MemTableTest_testSortedInputFastPath";
+    bool old_enable = config::enable_memtable_sorted_input_fast_path;
+    config::enable_memtable_sorted_input_fast_path = true;
+    DeferOp defer([&]() { config::enable_memtable_sorted_input_fast_path = old_enable; });
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 1000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    // insert the rows in order by two batches
+    ASSERT_TRUE(_mem_table->insert(*pchunk, indexes.data(), 0, n / 2).ok());
+    ASSERT_TRUE(_mem_table->insert(*pchunk, indexes.data(), n / 2, n - n / 2).ok());
+    ASSERT_TRUE(_mem_table->is_sorted_input());
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_EQ(n, _mem_table->get_result_chunk()->num_rows());
+    ASSERT_OK(_mem_table->flush());
+
+    // the duplicate key breaks the strict order of an unique keys table
+    auto mem_table =
+            std::make_unique<MemTable>(1, &_vectorized_schema, _slots, _mem_table_sink.get(), _mem_tracker.get());
+    ASSERT_TRUE(mem_table->insert(*pchunk, indexes.data(), 0, n).ok());
+    ASSERT_TRUE(mem_table->is_sorted_input());
+    ASSERT_TRUE(mem_table->insert(*pchunk, indexes.data(), n - 1, 1).ok());
+    ASSERT_FALSE(mem_table->is_sorted_input());
+    ASSERT_TRUE(mem_table->finalize().ok());
+    ASSERT_EQ(n, mem_table->get_result_chunk()->num_rows());
+    ASSERT_OK(mem_table->flush());
+
+    RowsetSharedPtr rowset = *_writer->build();
+    ASSERT_EQ(2 * n, rowset->num_rows());
+}
+
 TEST_F(MemTableTest, testPrimaryKeysWithDeletes) {
     const string path = "./MemTableTest_testPrimaryKeysWithDeletes";
     MySetUp(create_tablet_schema("pk bigint,v1 int", 1, KeysType::PRIMARY_KEYS), "pk bigint,v1 int,__op tinyint", path);
@@ -16,17 +16,20 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <random>
 
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_dump.h"
 #include "storage/primary_key_encoder.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 using namespace starrocks;
 
@@ -410,6 +413,74 @@ PARALLEL_TEST(PrimaryIndexTest, test_composite_key) {
     ASSERT_TRUE(pk_index->replace(3, 0, replace_indexes, *pk_column).ok());
 }
 
+template <LogicalType field_type>
+void test_parallel_upsert(const std::function<void(Column*, int64_t)>& append_key) {
+    auto old_num_threads = config::primary_index_parallel_upsert_num_threads;
+    auto old_min_rows = config::primary_index_parallel_upsert_min_rows;
+    DeferOp unset_config([&] {
+        config::primary_index_parallel_upsert_num_threads = old_num_threads;
+        config::primary_index_parallel_upsert_min_rows = old_min_rows;
+    });
+    config::primary_index_parallel_upsert_min_rows = 0;
+
+    auto f = std::make_shared<Field>(0, "c0", field_type, false);
+    f->set_is_key(true);
+    auto schema = std::make_shared<Schema>(Fields{f}, PRIMARY_KEYS, std::vector<ColumnId>{0});
+    auto sequential_index = TEST_create_primary_index(*schema);
+    auto parallel_index = TEST_create_primary_index(*schema);
+
+    constexpr int N = 10000;
+    auto chunk = ChunkHelper::new_chunk(*schema, N);
+    auto pk_col = chunk->get_column_by_index(0).get();
+    for (int64_t i = 0; i < N; i++) {
+        append_key(pk_col, i);
+    }
+    ASSERT_TRUE(sequential_index->insert(0, 0, *pk_col).ok());
+    ASSERT_TRUE(parallel_index->insert(0, 0, *pk_col).ok());
+
+    // [N/2, 2*N) with duplicate keys in the segment
+    pk_col->resize(0);
+    for (int64_t i = N / 2; i < 2 * N; i++) {
+        append_key(pk_col, i);
+    }
+    for (int64_t i = N; i < N + 100; i++) {
+        append_key(pk_col, i);
+    }
+    PrimaryIndex::DeletesMap sequential_deletes;
+    config::primary_index_parallel_upsert_num_threads = 1;
+    ASSERT_TRUE(sequential_index->upsert(1, 0, *pk_col, &sequential_deletes).ok());
+    PrimaryIndex::DeletesMap parallel_deletes;
+    config::primary_index_parallel_upsert_num_threads = 8;
+    ASSERT_TRUE(parallel_index->upsert(1, 0, *pk_col, &parallel_deletes).ok());
+
+    for (auto* deletes : {&sequential_deletes, &parallel_deletes}) {
+        for (auto& [rssid, rowids] : *deletes) {
+            std::sort(rowids.begin(), rowids.end());
+        }
+    }
+    ASSERT_EQ(sequential_deletes, parallel_deletes);
+    ASSERT_EQ(N / 2, parallel_deletes[0].size());
+    ASSERT_EQ(100, parallel_deletes[1].size());
+    ASSERT_EQ(sequential_index->size(), parallel_index->size());
+
+    std::vector<uint64_t> sequential_rowids(pk_col->size());
+    std::vector<uint64_t> parallel_rowids(pk_col->size());
+    ASSERT_TRUE(sequential_index->get(*pk_col, &sequential_rowids).ok());
+    ASSERT_TRUE(parallel_index->get(*pk_col, &parallel_rowids).ok());
+    ASSERT_EQ(sequential_rowids, parallel_rowids);
+}
+
+TEST(PrimaryIndexTest, test_parallel_upsert_bigint) {
+    test_parallel_upsert<TYPE_BIGINT>([](Column* col, int64_t i) { down_cast<Int64Column*>(col)->append(i); });
+}
+
+TEST(PrimaryIndexTest, test_parallel_upsert_varchar) {
+    // keys of different lengths, including ones longer than the fixed length shards
+    test_parallel_upsert<TYPE_VARCHAR>([](Column* col, int64_t i) {
+        down_cast<BinaryColumn*>(col)->append(std::string(i % 50, 'k') + std::to_string(i));
+    });
+}
+
 // TODO: test composite primary key
 
 } // namespace starrocks
@@ -0,0 +1,115 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/row_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+class RowCacheTest : public testing::Test {
+public:
+    void SetUp() override {
+        _old_capacity = config::primary_key_row_cache_capacity;
+        config::primary_key_row_cache_capacity = 1024 * 1024;
+        _mem_tracker = std::make_unique<MemTracker>();
+        _cache = std::make_unique<RowCache>(_mem_tracker.get(), config::primary_key_row_cache_capacity);
+    }
+
+    void TearDown() override { config::primary_key_row_cache_capacity = _old_capacity; }
+
+protected:
+    static std::unique_ptr<Int64Column> _pks(const std::vector<int64_t>& keys) {
+        auto pks = Int64Column::create_mutable();
+        for (auto k : keys) {
+            pks->append(k);
+        }
+        return pks;
+    }
+
+    static std::unique_ptr<BinaryColumn> _rows(const std::vector<std::string>& rows) {
+        auto column = BinaryColumn::create_mutable();
+        for (const auto& r : rows) {
+            column->append(Slice(r));
+        }
+        return column;
+    }
+
+    int64_t _old_capacity = 0;
+    std::unique_ptr<MemTracker> _mem_tracker;
+    std::unique_ptr<RowCache> _cache;
+};
+
+TEST_F(RowCacheTest, test_lookup_and_erase) {
+    const int64_t tablet_id = 10001;
+    ASSERT_TRUE(_cache->enabled());
+    int64_t sequence = _cache->tablet_sequence(tablet_id);
+    _cache->insert(tablet_id, 0, sequence, *_pks({1, 2, 3}), *_rows({"r1", "r2", "r3"}));
+
+    std::vector<bool> hits;
+    std::vector<std::string> rows;
+    ASSERT_EQ(2, _cache->lookup(tablet_id, 0, *_pks({1, 3, 4}), &hits, &rows));
+    ASSERT_EQ((std::vector<bool>{true, true, false}), hits);
+    ASSERT_EQ("r1", rows[0]);
+    ASSERT_EQ("r3", rows[1]);
+    // other tablet
+    ASSERT_EQ(0, _cache->lookup(tablet_id + 1, 0, *_pks({1}), &hits, &rows));
+    // other schema version
+    ASSERT_EQ(0, _cache->lookup(tablet_id, 1, *_pks({1}), &hits, &rows));
+
+    _cache->erase(tablet_id, *_pks({1}));
+    ASSERT_EQ(1, _cache->lookup(tablet_id, 0, *_pks({1, 2}), &hits, &rows));
+    ASSERT_EQ((std::vector<bool>{false, true}), hits);
+    ASSERT_EQ(7, _cache->lookup_count());
+    ASSERT_EQ(3, _cache->hit_count());
+}
+
+TEST_F(RowCacheTest, test_insert_after_invalidation) {
+    const int64_t tablet_id = 10002;
+    // rows read before the erase of apply are not cached
+    int64_t sequence = _cache->tablet_sequence(tablet_id);
+    _cache->erase(tablet_id, *_pks({5}));
+    _cache->insert(tablet_id, 0, sequence, *_pks({1}), *_rows({"r1"}));
+    std::vector<bool> hits;
+    std::vector<std::string> rows;
+    ASSERT_EQ(0, _cache->lookup(tablet_id, 0, *_pks({1}), &hits, &rows));
+
+    sequence = _cache->tablet_sequence(tablet_id);
+    _cache->insert(tablet_id, 0, sequence, *_pks({1}), *_rows({"r1"}));
+    ASSERT_EQ(1, _cache->lookup(tablet_id, 0, *_pks({1}), &hits, &rows));
+
+    // all rows of the tablet are invalid after invalidation
+    _cache->invalidate_tablet(tablet_id);
+    ASSERT_EQ(0, _cache->lookup(tablet_id, 0, *_pks({1}), &hits, &rows));
+    _cache->insert(tablet_id, 0, sequence, *_pks({2}), *_rows({"r2"}));
+    ASSERT_EQ(0, _cache->lookup(tablet_id, 0, *_pks({2}), &hits, &rows));
+}
+
+TEST_F(RowCacheTest, test_disabled) {
+    config::primary_key_row_cache_capacity = 0;
+    ASSERT_FALSE(_cache->enabled());
+    ASSERT_EQ(0, _cache->capacity());
+    // erase of apply does nothing while the cache is disabled.
+    const int64_t tablet_id = 10003;
+    int64_t sequence = _cache->tablet_sequence(tablet_id);
+    _cache->erase(tablet_id, *_pks({1}));
+    ASSERT_EQ(sequence, _cache->tablet_sequence(tablet_id));
+}
+
+} // namespace starrocks
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include "column/column_access_path.h"
@@ -19,20 +20,29 @@
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
 #include "common/config.h"
+#include "common/object_pool.h"
 #include "common/statusor.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
 #include "fs/fs_memory.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "gutil/casts.h"
+#include "runtime/runtime_state.h"
+#include "storage/column_expr_predicate.h"
+#include "storage/column_predicate.h"
 #include "storage/chunk_helper.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/column_writer.h"
 #include "storage/rowset/json_column_iterator.h"
 #include "storage/rowset/segment.h"
+#include "storage/range.h"
 #include "storage/tablet_schema_helper.h"
 #include "storage/types.h"
 #include "testutil/assert.h"
+#include "testutil/exprs_test_helper.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 #include "util/json.h"
 #include "util/json_flattener.h"
 
@@ -57,7 +67,8 @@ protected:
     }
 
     void test_json(const std::string& case_file, ColumnPtr& write_col, ColumnPtr& read_col, ColumnAccessPath* path) {
-        auto fs = std::make_shared<MemoryFileSystem>();
+        _fs = std::make_shared<MemoryFileSystem>();
+        auto& fs = _fs;
         ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
 
         TabletColumn json_tablet_column = create_with_default_value<TYPE_JSON>("");
@@ -65,7 +76,8 @@ protected:
         ColumnMetaPB meta;
 
         const std::string fname = TEST_DIR + case_file;
-        auto segment = create_dummy_segment(fs, fname);
+        _fname = fname;
+        _segment = create_dummy_segment(fs, fname);
 
         // write data
         {
@@ -90,18 +102,19 @@ protected:
             ASSERT_TRUE(writer->finish().ok());
             ASSERT_TRUE(writer->write_data().ok());
             ASSERT_TRUE(writer->write_ordinal_index().ok());
+            ASSERT_TRUE(writer->write_zone_map().ok());
 
             // close the file
             ASSERT_TRUE(wfile->close().ok());
         }
         LOG(INFO) << "Finish writing";
 
-        auto res = ColumnReader::create(&meta, segment.get(), nullptr);
+        auto res = ColumnReader::create(&meta, _segment.get(), nullptr);
         ASSERT_TRUE(res.ok());
-        auto reader = std::move(res).value();
+        _reader = std::move(res).value();
 
         {
-            ASSIGN_OR_ABORT(auto iter, reader->new_iterator(path));
+            ASSIGN_OR_ABORT(auto iter, _reader->new_iterator(path));
             ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
 
             ColumnIteratorOptions iter_opts;
@@ -120,6 +133,11 @@ protected:
         }
     }
 
+    std::shared_ptr<FileSystem> _fs;
+    std::string _fname;
+    std::shared_ptr<Segment> _segment;
+    std::unique_ptr<ColumnReader> _reader;
+
 private:
     std::shared_ptr<TabletSchema> _dummy_segment_schema;
 };
@@ -310,4 +328,273 @@ TEST_F(FlatJsonColumnRWTest, testEmptyObject) {
     EXPECT_EQ("{a: 4, b: 24}", read_json->debug_item(3));
 }
 
+TEST_F(FlatJsonColumnRWTest, testFlatJsonZoneMap) {
+    const auto old_min_limit = config::json_flat_internal_column_min_limit;
+    DeferOp restore_config([&]() { config::json_flat_internal_column_min_limit = old_min_limit; });
+    config::json_flat_internal_column_min_limit = 1;
+
+    ColumnPtr write_col = JsonColumn::create();
+    auto* json_col = down_cast<JsonColumn*>(write_col.get());
+
+    ASSIGN_OR_ABORT(auto jv1, JsonValue::parse(R"({"a": 1, "b": "x1", "c": 1.5})"));
+    ASSIGN_OR_ABORT(auto jv2, JsonValue::parse(R"({"a": 2, "b": "x2", "c": 2.5})"));
+    ASSIGN_OR_ABORT(auto jv3, JsonValue::parse(R"({"a": 3, "b": "x3", "c": 3.5})"));
+    json_col->append(&jv1);
+    json_col->append(&jv2);
+    json_col->append(&jv3);
+
+    ASSIGN_OR_ABORT(auto root_path, ColumnAccessPath::create(TAccessPathType::FIELD, "root", 0));
+    ASSIGN_OR_ABORT(auto f1_path, ColumnAccessPath::create(TAccessPathType::FIELD, "a", 0));
+    root_path->children().emplace_back(std::move(f1_path));
+
+    ColumnPtr read_col = JsonColumn::create();
+    test_json("/test_flat_json_zone_map.data", write_col, read_col, root_path.get());
+
+    ASSERT_TRUE(_reader->has_json_flat_zone_map());
+    EXPECT_FALSE(_reader->has_json_flat_bloom_filter_index());
+    ASSERT_EQ(3, _reader->sub_readers()->size());
+
+    ObjectPool pool;
+    for (const auto& sub_reader : *_reader->sub_readers()) {
+        ASSERT_TRUE(sub_reader->has_zone_map());
+        auto type_info = get_type_info(sub_reader->column_type());
+        if (sub_reader->name() == "a") {
+            ASSERT_EQ(TYPE_BIGINT, sub_reader->column_type());
+            auto* gt = pool.add(new_column_gt_predicate(type_info, 0, "3"));
+            auto* le = pool.add(new_column_le_predicate(type_info, 0, "1"));
+            EXPECT_FALSE(sub_reader->segment_zone_map_filter({gt}));
+            EXPECT_TRUE(sub_reader->segment_zone_map_filter({le}));
+        } else if (sub_reader->name() == "b") {
+            ASSERT_EQ(TYPE_VARCHAR, sub_reader->column_type());
+            auto* eq = pool.add(new_column_eq_predicate(type_info, 0, "x4"));
+            auto* ge = pool.add(new_column_ge_predicate(type_info, 0, "x3"));
+            EXPECT_FALSE(sub_reader->segment_zone_map_filter({eq}));
+            EXPECT_TRUE(sub_reader->segment_zone_map_filter({ge}));
+        } else {
+            ASSERT_EQ(TYPE_DOUBLE, sub_reader->column_type());
+            auto* lt = pool.add(new_column_lt_predicate(type_info, 0, "1.5"));
+            EXPECT_FALSE(sub_reader->segment_zone_map_filter({lt}));
+        }
+    }
+}
+
+// Build `fn(json, path) <op> literal` on the json column 0, as the scan node pushes it down to the storage.
+static StatusOr<const ColumnPredicate*> make_json_path_predicate(ObjectPool* pool, RuntimeState* state,
+                                                                 const std::string& fn_name, int64_t fid,
+                                                                 TPrimitiveType::type result_type,
+                                                                 const std::string& path, TExprOpcode::type op,
+                                                                 TExprNode literal) {
+    auto json_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::JSON);
+    auto varchar_type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::VARCHAR);
+    auto ret_type = ExprsTestHelper::create_scalar_type_desc(result_type);
+
+    TExprNode pred_node;
+    pred_node.node_type = TExprNodeType::BINARY_PRED;
+    pred_node.type = ExprsTestHelper::create_scalar_type_desc(TPrimitiveType::BOOLEAN);
+    pred_node.num_children = 2;
+    pred_node.__set_opcode(op);
+    pred_node.__set_child_type(result_type);
+
+    TExprNode fn_node;
+    fn_node.node_type = TExprNodeType::FUNCTION_CALL;
+    fn_node.type = ret_type;
+    fn_node.num_children = 2;
+    fn_node.__set_fn(ExprsTestHelper::create_builtin_function(fn_name, {json_type, varchar_type}, ret_type, ret_type));
+    fn_node.fn.__set_fid(fid);
+
+    TExprNode path_node;
+    path_node.node_type = TExprNodeType::STRING_LITERAL;
+    path_node.type = varchar_type;
+    path_node.num_children = 0;
+    TStringLiteral path_literal;
+    path_literal.__set_value(path);
+    path_node.__set_string_literal(path_literal);
+
+    literal.type = ret_type;
+    literal.num_children = 0;
+
+    TExpr texpr;
+    texpr.nodes = {pred_node, fn_node, ExprsTestHelper::create_slot_expr_node(0, 0, json_type, true), path_node,
+                   literal};
+    ExprContext* ctx = nullptr;
+    RETURN_IF_ERROR(Expr::create_expr_tree(pool, texpr, &ctx, state));
+    RETURN_IF_ERROR(ctx->prepare(state));
+    RETURN_IF_ERROR(ctx->open(state));
+    // the predicate clones the context
+    DeferOp close_ctx([&]() { ctx->close(state); });
+    ASSIGN_OR_RETURN(auto* pred, ColumnExprPredicate::make_column_expr_predicate(get_type_info(TYPE_JSON), 0, state,
+                                                                                  ctx, nullptr));
+    return pool->add(pred);
+}
+
+static TExprNode int_literal(int64_t value) {
+    TExprNode node;
+    node.node_type = TExprNodeType::INT_LITERAL;
+    TIntLiteral literal;
+    literal.__set_value(value);
+    node.__set_int_literal(literal);
+    return node;
+}
+
+static TExprNode float_literal(double value) {
+    TExprNode node;
+    node.node_type = TExprNodeType::FLOAT_LITERAL;
+    TFloatLiteral literal;
+    literal.__set_value(value);
+    node.__set_float_literal(literal);
+    return node;
+}
+
+static TExprNode string_literal(const std::string& value) {
+    TExprNode node;
+    node.node_type = TExprNodeType::STRING_LITERAL;
+    TStringLiteral literal;
+    literal.__set_value(value);
+    node.__set_string_literal(literal);
+    return node;
+}
+
+static bool contains_row(const SparseRange<>& ranges, rowid_t row) {
+    return (ranges & SparseRange<>(row, row + 1)).span_size() == 1;
+}
+
+TEST_F(FlatJsonColumnRWTest, testFlatJsonPredicatePruning) {
+    const auto old_min_limit = config::json_flat_internal_column_min_limit;
+    const auto old_bloom_filter = config::enable_json_flat_bloom_filter;
+    const auto old_page_size = config::data_page_size;
+    DeferOp restore_config([&]() {
+        config::json_flat_internal_column_min_limit = old_min_limit;
+        config::enable_json_flat_bloom_filter = old_bloom_filter;
+        config::data_page_size = old_page_size;
+    });
+    config::json_flat_internal_column_min_limit = 1;
+    config::enable_json_flat_bloom_filter = true;
+    // small pages, so that each sub-column has many pages with disjoint zone maps
+    config::data_page_size = 1024;
+
+    // a: i, b: "x%04d" of i, c: i + 0.5, all ascending by row
+    constexpr rowid_t num_rows = 1000;
+    ColumnPtr write_col = JsonColumn::create();
+    auto* json_col = down_cast<JsonColumn*>(write_col.get());
+    for (rowid_t i = 0; i < num_rows; i++) {
+        ASSIGN_OR_ABORT(auto jv, JsonValue::parse(fmt::format(R"({{"a": {}, "b": "x{:04d}", "c": {}.5}})", i, i, i)));
+        json_col->append(&jv);
+    }
+
+    ASSIGN_OR_ABORT(auto root_path, ColumnAccessPath::create(TAccessPathType::FIELD, "root", 0));
+    ASSIGN_OR_ABORT(auto f1_path, ColumnAccessPath::create(TAccessPathType::FIELD, "a", 0));
+    root_path->children().emplace_back(std::move(f1_path));
+
+    ColumnPtr read_col = JsonColumn::create();
+    test_json("/test_flat_json_predicate_pruning.data", write_col, read_col, root_path.get());
+    ASSERT_TRUE(_reader->has_json_flat_zone_map());
+    ASSERT_TRUE(_reader->has_json_flat_bloom_filter_index());
+
+    RuntimeState state;
+    ObjectPool pool;
+    auto make_pred = [&](const std::string& fn_name, const std::string& path, TExprOpcode::type op,
+                         const TExprNode& literal) {
+        if (fn_name == "get_json_int") {
+            return make_json_path_predicate(&pool, &state, fn_name, 110023, TPrimitiveType::BIGINT, path, op, literal);
+        } else if (fn_name == "get_json_double") {
+            return make_json_path_predicate(&pool, &state, fn_name, 110013, TPrimitiveType::DOUBLE, path, op, literal);
+        }
+        return make_json_path_predicate(&pool, &state, fn_name, 110014, TPrimitiveType::VARCHAR, path, op, literal);
+    };
+    ASSIGN_OR_ABORT(auto a_lt_100, make_pred("get_json_int", "$.a", TExprOpcode::LT, int_literal(100)));
+    ASSIGN_OR_ABORT(auto a_ge_900, make_pred("get_json_int", "$.a", TExprOpcode::GE, int_literal(900)));
+    ASSIGN_OR_ABORT(auto a_gt_5000, make_pred("get_json_int", "$.a", TExprOpcode::GT, int_literal(5000)));
+    ASSIGN_OR_ABORT(auto a_eq_500, make_pred("get_json_int", "$.a", TExprOpcode::EQ, int_literal(500)));
+    ASSIGN_OR_ABORT(auto c_lt_100, make_pred("get_json_double", "$.c", TExprOpcode::LT, float_literal(100)));
+    ASSIGN_OR_ABORT(auto b_eq_x0500, make_pred("get_json_string", "$.b", TExprOpcode::EQ, string_literal("x0500")));
+    ASSIGN_OR_ABORT(auto b_gt_y, make_pred("get_json_string", "$.b", TExprOpcode::GT, string_literal("y")));
+    // b is a VARCHAR sub-column, get_json_int() on it can't be rewritten
+    ASSIGN_OR_ABORT(auto b_as_int, make_pred("get_json_int", "$.b", TExprOpcode::EQ, int_literal(1)));
+    // nested paths are not flattened
+    ASSIGN_OR_ABORT(auto nested, make_pred("get_json_int", "$.a.b", TExprOpcode::EQ, int_literal(1)));
+
+    // segment zone map
+    EXPECT_FALSE(_reader->segment_zone_map_filter({a_gt_5000}));
+    EXPECT_FALSE(_reader->segment_zone_map_filter({b_gt_y}));
+    EXPECT_TRUE(_reader->segment_zone_map_filter({a_lt_100}));
+    EXPECT_TRUE(_reader->segment_zone_map_filter({b_as_int}));
+    EXPECT_TRUE(_reader->segment_zone_map_filter({nested}));
+    EXPECT_FALSE(_reader->segment_zone_map_filter({b_as_int, a_gt_5000}));
+
+    ASSIGN_OR_ABORT(auto iter, _reader->new_iterator(root_path.get()));
+    ASSIGN_OR_ABORT(auto read_file, _fs->new_random_access_file(_fname));
+    ColumnIteratorOptions iter_opts;
+    OlapReaderStatistics stats;
+    iter_opts.stats = &stats;
+    iter_opts.read_file = read_file.get();
+    ASSERT_OK(iter->init(iter_opts));
+
+    auto zone_map_ranges = [&](const std::vector<const ColumnPredicate*>& preds, CompoundNodeType relation) {
+        SparseRange<> ranges;
+        CHECK_OK(iter->get_row_ranges_by_zone_map(preds, nullptr, &ranges, relation));
+        return ranges;
+    };
+
+    // page zone map, AND
+    {
+        auto ranges = zone_map_ranges({a_lt_100}, CompoundNodeType::AND);
+        EXPECT_TRUE(contains_row(ranges, 0));
+        EXPECT_TRUE(contains_row(ranges, 99));
+        EXPECT_FALSE(contains_row(ranges, 500));
+        EXPECT_FALSE(contains_row(ranges, num_rows - 1));
+
+        for (const auto& sub_reader : *_reader->sub_readers()) {
+            if (sub_reader->name() == "a") {
+                // make sure that the pruning above is by pages
+                EXPECT_GT(sub_reader->num_data_pages(), 4);
+            }
+        }
+
+        // the predicate which can't be rewritten doesn't prune any page, but doesn't break the others either
+        EXPECT_EQ(ranges.to_string(), zone_map_ranges({a_lt_100, b_as_int}, CompoundNodeType::AND).to_string());
+        EXPECT_EQ(num_rows, zone_map_ranges({b_as_int}, CompoundNodeType::AND).span_size());
+
+        // disjoint sub-columns
+        EXPECT_EQ(0, zone_map_ranges({a_ge_900, c_lt_100}, CompoundNodeType::AND).span_size());
+        EXPECT_EQ(0, zone_map_ranges({a_lt_100, a_ge_900}, CompoundNodeType::AND).span_size());
+    }
+
+    // page zone map, OR
+    {
+        auto ranges = zone_map_ranges({a_lt_100, a_ge_900}, CompoundNodeType::OR);
+        EXPECT_TRUE(contains_row(ranges, 0));
+        EXPECT_TRUE(contains_row(ranges, num_rows - 1));
+        EXPECT_FALSE(contains_row(ranges, 500));
+
+        ranges = zone_map_ranges({a_ge_900, c_lt_100}, CompoundNodeType::OR);
+        EXPECT_TRUE(contains_row(ranges, 0));
+        EXPECT_TRUE(contains_row(ranges, num_rows - 1));
+        EXPECT_FALSE(contains_row(ranges, 500));
+
+        // any row may satisfy the predicate which can't be checked
+        EXPECT_EQ(num_rows, zone_map_ranges({a_lt_100, b_as_int}, CompoundNodeType::OR).span_size());
+    }
+
+    // bloom filter
+    {
+        ASSERT_TRUE(iter->has_json_flat_bloom_filter_index());
+        for (const auto* pred : {b_eq_x0500, a_eq_500}) {
+            SparseRange<> ranges(0, num_rows);
+            ASSERT_OK(iter->get_row_ranges_by_bloom_filter({pred}, &ranges));
+            EXPECT_TRUE(contains_row(ranges, 500));
+            EXPECT_LT(ranges.span_size(), num_rows);
+        }
+
+        // DOUBLE sub-columns have no bloom filter, and nothing is filtered
+        ASSIGN_OR_ABORT(auto c_eq_1, make_pred("get_json_double", "$.c", TExprOpcode::EQ, float_literal(1.5)));
+        SparseRange<> ranges(0, num_rows);
+        ASSERT_OK(iter->get_row_ranges_by_bloom_filter({c_eq_1}, &ranges));
+        EXPECT_EQ(num_rows, ranges.span_size());
+
+        // predicates on different sub-columns are not checked, since their relation is unknown here
+        ASSERT_OK(iter->get_row_ranges_by_bloom_filter({b_eq_x0500, a_eq_500}, &ranges));
+        EXPECT_EQ(num_rows, ranges.span_size());
+    }
+}
+
 } // namespace starrocks
@@ -163,6 +163,50 @@ TEST_F(SegmentReaderWriterTest, estimate_segment_size) {
     ASSERT_NE(segment_size, 0);
 }
 
+TEST_F(SegmentReaderWriterTest, parse_footer_with_tail) {
+    std::shared_ptr<TabletSchema> tablet_schema =
+            TabletSchemaHelper::create_tablet_schema({create_int_key_pb(1), create_int_value_pb(2)}, 1);
+
+    std::string fname = kSegmentDir + "/parse_footer_with_tail";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(fname));
+    SegmentWriterOptions opts;
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    size_t nrows = 1000;
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, nrows);
+    for (size_t rid = 0; rid < nrows; ++rid) {
+        auto& cols = chunk->columns();
+        for (int cid = 0; cid < tablet_schema->num_columns(); ++cid) {
+            cols[cid]->append_datum(DefaultIntGenerator(rid, cid, 0));
+        }
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size, index_size, footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+    file_size = _fs->get_file_size(fname).value();
+
+    ASSIGN_OR_ABORT(auto rfile, _fs->new_random_access_file(fname));
+    SegmentFooterPB footer;
+    size_t hint = 64 * 1024;
+    std::string tail;
+    uint64_t tail_offset = 0;
+    ASSIGN_OR_ABORT(auto footer_size, Segment::parse_segment_footer(rfile.get(), &footer, &hint, nullptr, &tail,
+                                                                    &tail_offset));
+    ASSERT_EQ(file_size, tail_offset + tail.size() + 12);
+    ASSERT_LE(footer_size, file_size);
+    ASSERT_EQ(nrows, footer.num_rows());
+
+    // the short key index page is within the tail and matches the file content
+    PagePointer sk_page(footer.short_key_index_page());
+    ASSERT_GE(sk_page.offset, tail_offset);
+    ASSERT_LE(sk_page.offset + sk_page.size, tail_offset + tail.size());
+    std::string page(sk_page.size, '\0');
+    ASSERT_OK(rfile->read_at_fully(sk_page.offset, page.data(), page.size()));
+    ASSERT_EQ(page, tail.substr(sk_page.offset - tail_offset, sk_page.size));
+}
+
 TEST_F(SegmentReaderWriterTest, TestBloomFilterIndexUniqueModel) {
     std::shared_ptr<TabletSchema> schema =
             TabletSchemaHelper::create_tablet_schema({create_int_key_pb(1), create_int_key_pb(2), create_int_key_pb(3),
@@ -24,7 +24,9 @@
 #include "runtime/mem_tracker.h"
 #include "storage/chunk_helper.h"
 #include "storage/empty_iterator.h"
+#include "storage/local_tablet_reader.h"
 #include "storage/olap_common.h"
+#include "storage/row_cache.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset_column_update_state.h"
@@ -38,6 +40,7 @@
 #include "storage/union_iterator.h"
 #include "storage/update_manager.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -1154,6 +1157,71 @@ TEST_P(RowsetColumnPartialUpdateTest, partial_update_multi_segment_and_column_ba
     final_check(tablet, rowsets);
 }
 
+TEST_P(RowsetColumnPartialUpdateTest, test_row_cache_across_partial_update) {
+    auto old_capacity = config::primary_key_row_cache_capacity;
+    config::primary_key_row_cache_capacity = 64 * 1024 * 1024;
+    DeferOp restore_capacity([&] { config::primary_key_row_cache_capacity = old_capacity; });
+    auto* row_cache = StorageEngine::instance()->update_manager()->row_cache();
+
+    const int N = 100;
+    auto tablet = create_tablet(rand(), rand());
+    std::vector<int64_t> keys(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = i;
+    }
+    std::vector<RowsetSharedPtr> rowsets;
+    rowsets.emplace_back(create_rowset(tablet, keys));
+    int64_t version = 1;
+    commit_rowsets(tablet, rowsets, version);
+
+    auto key_chunk = ChunkHelper::new_chunk(ChunkHelper::convert_schema(tablet->tablet_schema(), {0}), N);
+    for (int64_t key : keys) {
+        key_chunk->get_column_by_index(0)->append_datum(Datum(key));
+    }
+    auto multi_get = [&](const std::function<bool(int64_t, int16_t, int32_t)>& check_fn) {
+        LocalTabletReader reader;
+        ASSERT_OK(reader.init(tablet, version));
+        auto value_chunk = ChunkHelper::new_chunk(ChunkHelper::convert_schema(tablet->tablet_schema(), {1, 2}), N);
+        std::vector<bool> found;
+        ASSERT_OK(reader.multi_get(*key_chunk, {"v1", "v2"}, found, *value_chunk));
+        ASSERT_OK(reader.close());
+        ASSERT_EQ(N, value_chunk->num_rows());
+        for (int i = 0; i < N; i++) {
+            ASSERT_TRUE(found[i]);
+            ASSERT_TRUE(check_fn(keys[i], value_chunk->get_column_by_index(0)->get(i).get_int16(),
+                                 value_chunk->get_column_by_index(1)->get(i).get_int32()));
+        }
+    };
+    auto check_origin = [](int64_t k1, int16_t v1, int32_t v2) {
+        return (int16_t)(k1 % 100 + 1) == v1 && (int32_t)(k1 % 1000 + 2) == v2;
+    };
+
+    // wait for the apply of version.
+    ASSERT_TRUE(check_tablet(tablet, version, N, check_origin));
+    // the second read is served by the rows cached by the first one.
+    multi_get(check_origin);
+    uint64_t hit_count = row_cache->hit_count();
+    multi_get(check_origin);
+    ASSERT_EQ(hit_count + N, row_cache->hit_count());
+
+    // the partial update of v1 changes values without touching primary index, the cached rows must not be used.
+    std::vector<int32_t> column_indexes = {0, 1};
+    auto v1_func = [](int64_t k1) { return (int16_t)(k1 % 100 + 3); };
+    auto v2_func = [](int64_t k1) { return (int32_t)(k1 % 1000 + 4); };
+    auto partial_schema = TabletSchema::create(tablet->tablet_schema(), column_indexes);
+    auto partial_rowset = create_partial_rowset(tablet, keys, column_indexes, v1_func, v2_func, partial_schema, 1);
+    ASSERT_OK(tablet->rowset_commit(++version, partial_rowset, 10000));
+    auto check_updated = [](int64_t k1, int16_t v1, int32_t v2) {
+        return (int16_t)(k1 % 100 + 3) == v1 && (int32_t)(k1 % 1000 + 2) == v2;
+    };
+    ASSERT_TRUE(check_tablet(tablet, version, N, check_updated));
+    hit_count = row_cache->hit_count();
+    multi_get(check_updated);
+    ASSERT_EQ(hit_count, row_cache->hit_count());
+    multi_get(check_updated);
+    ASSERT_EQ(hit_count + N, row_cache->hit_count());
+}
+
 INSTANTIATE_TEST_SUITE_P(RowsetColumnPartialUpdateTest, RowsetColumnPartialUpdateTest,
                          ::testing::Values(1, 1024, 104857600));
 
@@ -1461,6 +1461,63 @@ TEST_F(SizeTieredCompactionPolicyTest, test_large_dup_base_rowset) {
     }
 }
 
+TEST_F(SizeTieredCompactionPolicyTest, test_dup_segment_reuse_compaction) {
+    LOG(INFO) << "test_dup_segment_reuse_compaction";
+    create_tablet_schema(DUP_KEYS);
+
+    TabletMetaSharedPtr tablet_meta = std::make_shared<TabletMeta>();
+    create_tablet_meta(tablet_meta.get());
+    tablet_meta->set_enable_shortcut_compaction(true);
+
+    // keys keep increasing across versions, so no two segments overlap
+    write_new_version(tablet_meta, 1);
+    write_new_version(tablet_meta, 1);
+    write_new_version(tablet_meta, 1);
+    write_new_version(tablet_meta, 1);
+
+    TabletSharedPtr tablet =
+            Tablet::create_tablet_from_meta(tablet_meta, starrocks::StorageEngine::instance()->get_stores()[0]);
+    ASSERT_OK(tablet->init());
+    init_compaction_context(tablet);
+    ASSERT_EQ(4, tablet->version_count());
+
+    auto old_min_bytes = config::compaction_segment_reuse_min_bytes;
+    config::compaction_segment_reuse_min_bytes = 0;
+    DeferOp defer([&]() { config::compaction_segment_reuse_min_bytes = old_min_bytes; });
+
+    ASSERT_TRUE(tablet->need_compaction());
+    auto task = tablet->create_compaction_task();
+    ASSERT_NE(nullptr, task);
+    size_t input_rows = 0;
+    size_t input_segments = 0;
+    for (const auto& rowset : task->input_rowsets()) {
+        input_rows += rowset->num_rows();
+        input_segments += rowset->num_segments();
+    }
+    task->run();
+    ASSERT_EQ(COMPACTION_SUCCESS, task->compaction_task_state());
+    ASSERT_FALSE(task->is_shortcut_compaction());
+    ASSERT_EQ(input_segments, task->reused_segments_num());
+
+    std::vector<RowsetSharedPtr> rowsets;
+    ASSERT_OK(tablet->capture_consistent_rowsets(Version(0, tablet->max_version().second), &rowsets));
+    size_t total_rows = 0;
+    for (const auto& rowset : rowsets) {
+        total_rows += rowset->num_rows();
+    }
+    size_t other_rows = 0;
+    for (const auto& rowset : rowsets) {
+        if (rowset->version() == task->output_version()) {
+            ASSERT_FALSE(rowset->rowset_meta()->is_segments_overlapping());
+            ASSERT_EQ(input_rows, rowset->num_rows());
+            ASSERT_EQ(input_segments, rowset->num_segments());
+        } else {
+            other_rows += rowset->num_rows();
+        }
+    }
+    ASSERT_EQ(input_rows + other_rows, total_rows);
+}
+
 TEST_F(SizeTieredCompactionPolicyTest, test_large_dup_base_rowset_force_compact) {
     LOG(INFO) << "test_large_dup_base_rowset_force_compact";
     create_tablet_schema(DUP_KEYS);
@@ -912,6 +912,65 @@ TEST_F(TabletUpdatesTest, apply_with_pk_dump) {
     config::l0_max_mem_usage = old_config;
 }
 
+TEST_F(TabletUpdatesTest, load_primary_index_from_snapshot) {
+    const int N = 1000;
+    auto old_enable = config::enable_primary_index_snapshot;
+    auto old_interval = config::primary_index_snapshot_interval_sec;
+    auto old_min_rows = config::primary_index_snapshot_min_rows;
+    DeferOp unset_config([&] {
+        config::enable_primary_index_snapshot = old_enable;
+        config::primary_index_snapshot_interval_sec = old_interval;
+        config::primary_index_snapshot_min_rows = old_min_rows;
+    });
+    config::enable_primary_index_snapshot = true;
+    config::primary_index_snapshot_interval_sec = 0;
+    config::primary_index_snapshot_min_rows = 0;
+    _tablet = create_tablet(rand(), rand());
+
+    // Insert [0, N), the snapshot is saved at this version
+    std::vector<int64_t> keys(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = i;
+    }
+    ASSERT_TRUE(_tablet->rowset_commit(2, create_rowset(_tablet, keys)).ok());
+    ASSERT_EQ(N, read_tablet(_tablet, 2));
+    // the snapshot is dumped after the version is visible and written in background, wait for both
+    { std::unique_lock l(*_tablet->updates()->get_index_lock()); }
+    StorageEngine::instance()->update_manager()->pindex_snapshot_thread_pool()->wait();
+    ASSERT_OK(FileSystem::Default()->path_exists(_tablet->schema_hash_path() + "/index.mem.snapshot"));
+
+    // Delete [0, N/2) and upsert [N - 100, N + 100) after the snapshot
+    config::primary_index_snapshot_interval_sec = 3600;
+    Int64Column deletes;
+    deletes.append_numbers(keys.data(), sizeof(int64_t) * N / 2);
+    ASSERT_TRUE(_tablet->rowset_commit(3, create_rowset(_tablet, {}, &deletes)).ok());
+    std::vector<int64_t> upserts;
+    for (int i = N - 100; i < N + 100; i++) {
+        upserts.push_back(i);
+    }
+    ASSERT_TRUE(_tablet->rowset_commit(4, create_rowset(_tablet, upserts)).ok());
+    ASSERT_EQ(N / 2 + 100, read_tablet(_tablet, 4));
+    { std::unique_lock l(*_tablet->updates()->get_index_lock()); }
+
+    PrimaryIndex snapshot_index;
+    ASSERT_OK(snapshot_index.load(_tablet.get()));
+    config::enable_primary_index_snapshot = false;
+    PrimaryIndex rebuilt_index;
+    ASSERT_OK(rebuilt_index.load(_tablet.get()));
+    ASSERT_EQ(N / 2 + 100, snapshot_index.size());
+    ASSERT_EQ(rebuilt_index.size(), snapshot_index.size());
+
+    Int64Column pks;
+    for (int64_t i = 0; i < N + 100; i++) {
+        pks.append(i);
+    }
+    std::vector<uint64_t> snapshot_rowids(pks.size());
+    std::vector<uint64_t> rebuilt_rowids(pks.size());
+    ASSERT_OK(snapshot_index.get(pks, &snapshot_rowids));
+    ASSERT_OK(rebuilt_index.get(pks, &rebuilt_rowids));
+    ASSERT_EQ(rebuilt_rowids, snapshot_rowids);
+}
+
 void TabletUpdatesTest::test_condition_update_apply(bool enable_persistent_index) {
     const int N = 100;
     _tablet = create_tablet(rand(), rand());
@@ -0,0 +1,59 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/count_min_sketch.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_map>
+
+namespace starrocks {
+
+TEST(CountMinSketchTest, test_estimate) {
+    CountMinSketch sketch;
+    std::mt19937 rng(0);
+    std::unordered_map<uint32_t, uint32_t> counts;
+    const uint32_t heavy_key = 12345;
+    for (int i = 0; i < 100000; ++i) {
+        uint32_t hash = i % 4 == 0 ? heavy_key : rng();
+        counts[hash]++;
+        ASSERT_EQ(sketch.estimate(hash) + 1, sketch.add(hash));
+    }
+    ASSERT_EQ(100000, sketch.total());
+
+    // Never underestimate.
+    for (const auto& [hash, count] : counts) {
+        ASSERT_GE(sketch.estimate(hash), count);
+    }
+    ASSERT_EQ(25000, sketch.estimate(heavy_key));
+    // The rare keys stay far below the heavy one.
+    ASSERT_LT(sketch.estimate(heavy_key + 1), 100);
+}
+
+TEST(CountMinSketchTest, test_decay) {
+    CountMinSketch sketch(8);
+    for (int i = 0; i < 100; ++i) {
+        sketch.add(1);
+    }
+    sketch.decay();
+    ASSERT_EQ(50, sketch.estimate(1));
+    ASSERT_EQ(50, sketch.total());
+
+    sketch.clear();
+    ASSERT_EQ(0, sketch.estimate(1));
+    ASSERT_EQ(0, sketch.total());
+}
+
+} // namespace starrocks
@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/numa_util.h"
+
+#include <gtest/gtest.h>
+#include <sched.h>
+
+#include <thread>
+
+namespace starrocks {
+
+// NOLINTNEXTLINE
+TEST(NumaUtilTest, test_unbind_restores_process_affinity) {
+    // Run in a new thread, to not leave the test thread bound.
+    std::thread thread([] {
+        cpu_set_t process_cpu_set;
+        ASSERT_EQ(0, sched_getaffinity(0, sizeof(process_cpu_set), &process_cpu_set));
+
+        // Unbinding a thread that is not bound does nothing.
+        ASSERT_TRUE(NumaUtil::unbind_current_thread().ok());
+        ASSERT_EQ(-1, NumaUtil::current_thread_node());
+
+        Status status = NumaUtil::bind_current_thread(0);
+        if (!status.ok()) {
+            // No allowed core in node 0, e.g. in a restricted cpuset.
+            ASSERT_TRUE(status.is_not_supported()) << status;
+            return;
+        }
+        ASSERT_EQ(0, NumaUtil::current_thread_node());
+
+        ASSERT_TRUE(NumaUtil::unbind_current_thread().ok());
+        ASSERT_EQ(-1, NumaUtil::current_thread_node());
+        cpu_set_t cpu_set;
+        ASSERT_EQ(0, sched_getaffinity(0, sizeof(cpu_set), &cpu_set));
+        ASSERT_TRUE(CPU_EQUAL(&process_cpu_set, &cpu_set));
+    });
+    thread.join();
+}
+
+} // namespace starrocks
@@ -362,6 +362,12 @@ public class FunctionSet {
     public static final String PERCENTILE_HASH = "percentile_hash";
     public static final String PERCENTILE_UNION = "percentile_union";
 
+    // DataSketches functions:
+    public static final String DS_KLL_SKETCH = "ds_kll_sketch";
+    public static final String DS_KLL_SKETCH_UNION = "ds_kll_sketch_union";
+    public static final String DS_THETA_SKETCH = "ds_theta_sketch";
+    public static final String DS_THETA_SKETCH_UNION = "ds_theta_sketch_union";
+
     // Condition functions:
     public static final String COALESCE = "coalesce";
     public static final String IF = "if";
@@ -1027,6 +1033,12 @@ public class FunctionSet {
                     Lists.newArrayList(t), Type.BIGINT, Type.VARCHAR,
                     true, false, true));
 
+            // DS_THETA_SKETCH
+            // build a serialized DataSketches Theta sketch, which supports union/intersect/a_not_b
+            addBuiltin(AggregateFunction.createBuiltin(DS_THETA_SKETCH,
+                    Lists.newArrayList(t), Type.VARBINARY, Type.VARBINARY,
+                    true, false, false));
+
             // HLL_RAW
             addBuiltin(AggregateFunction.createBuiltin(HLL_RAW,
                     Lists.newArrayList(t), Type.HLL, Type.VARBINARY,
@@ -1071,6 +1083,9 @@ public class FunctionSet {
         // Percentile
         registerBuiltinPercentileAggFunction();
 
+        // DataSketches
+        registerBuiltinDataSketchesAggFunction();
+
         // HLL_UNION_AGG
         addBuiltin(AggregateFunction.createBuiltin(HLL_UNION_AGG,
                 Lists.newArrayList(Type.HLL), Type.BIGINT, Type.HLL,
@@ -1380,6 +1395,18 @@ public class FunctionSet {
         }
     }
 
+    private void registerBuiltinDataSketchesAggFunction() {
+        addBuiltin(AggregateFunction.createBuiltin(DS_KLL_SKETCH,
+                Lists.newArrayList(Type.DOUBLE), Type.VARBINARY, Type.VARBINARY,
+                false, false, false));
+        addBuiltin(AggregateFunction.createBuiltin(DS_KLL_SKETCH_UNION,
+                Lists.newArrayList(Type.VARBINARY), Type.VARBINARY, Type.VARBINARY,
+                false, false, false));
+        addBuiltin(AggregateFunction.createBuiltin(DS_THETA_SKETCH_UNION,
+                Lists.newArrayList(Type.VARBINARY), Type.VARBINARY, Type.VARBINARY,
+                true, false, false));
+    }
+
     private void registerBuiltinPercentileAggFunction() {
         // PercentileApprox
         addBuiltin(AggregateFunction.createBuiltin(PERCENTILE_APPROX,
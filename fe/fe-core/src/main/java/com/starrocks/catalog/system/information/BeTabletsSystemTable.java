@@ -49,6 +49,7 @@ public class BeTabletsSystemTable {
                         .column("INDEX_DISK", ScalarType.createType(PrimitiveType.BIGINT))
                         .column("MEDIUM_TYPE", ScalarType.createVarchar(NAME_CHAR_LEN))
                         .column("NUM_SEGMENT", ScalarType.createType(PrimitiveType.BIGINT))
+                        .column("READ_AMP_SCORE", ScalarType.createType(PrimitiveType.DOUBLE))
                         .build(), TSchemaTableType.SCH_BE_TABLETS);
     }
 }
@@ -90,6 +90,8 @@ public class AggregationNode extends PlanNode {
 
     private boolean useSortAgg = false;
     private boolean usePerBucketOptimize = false;
+    // Only set when the output is merged by another aggregation on the same grouping keys.
+    private boolean localShuffleSpreadHeavyKeys = false;
 
     private boolean withLocalShuffle = false;
 
@@ -168,6 +170,10 @@ public class AggregationNode extends PlanNode {
         this.usePerBucketOptimize = usePerBucketOptimize;
     }
 
+    public void setLocalShuffleSpreadHeavyKeys(boolean localShuffleSpreadHeavyKeys) {
+        this.localShuffleSpreadHeavyKeys = localShuffleSpreadHeavyKeys;
+    }
+
     public void disablePhysicalPropertyOptimize() {
         setUseSortAgg(false);
         setUsePerBucketOptimize(false);
@@ -235,6 +241,7 @@ public class AggregationNode extends PlanNode {
         }
         msg.agg_node.setUse_sort_agg(useSortAgg);
         msg.agg_node.setUse_per_bucket_optimize(usePerBucketOptimize);
+        msg.agg_node.setLocal_shuffle_spread_heavy_keys(localShuffleSpreadHeavyKeys);
 
         List<Expr> groupingExprs = aggInfo.getGroupingExprs();
         if (groupingExprs != null) {
@@ -1107,6 +1107,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // if spillable_operator_mask & 4 != 0, agg distinct operator can spill
     // if spillable_operator_mask & 8 != 0, sort operator can spill
     // if spillable_operator_mask & 16 != 0, nest loop join operator can spill
+    // if spillable_operator_mask & 32 != 0, analytic operator can spill, only the columns not used to evaluate
+    //     window functions are spilled
     // ...
     // default value is -1, means all operators can spill
     @VariableMgr.VarAttr(name = SPILLABLE_OPERATOR_MASK, flag = VariableMgr.INVISIBLE)
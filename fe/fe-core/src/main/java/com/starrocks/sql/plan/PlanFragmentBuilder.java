@@ -2107,6 +2107,10 @@ public class PlanFragmentBuilder {
                 aggregationNode.unsetNeedsFinalize();
                 aggregationNode.setIsPreagg(node.canUseStreamingPreAgg());
                 aggregationNode.setIntermediateTuple();
+                // The split local agg is merged by the global or distinct-global agg on the same grouping keys,
+                // except the first phase of three/four-phase agg whose second phase is pruned, which is followed
+                // by an update agg on part of the keys.
+                aggregationNode.setLocalShuffleSpreadHeavyKeys(!node.isMergedLocalAgg());
                 if (!partitionExpressions.isEmpty()) {
                     inputFragment.setOutputPartition(DataPartition.hashPartitioned(partitionExpressions));
                 }
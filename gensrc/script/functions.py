@@ -671,6 +671,17 @@ vectorized_functions = [
     [80040, 'hll_serialize', True, False, 'VARCHAR', ['HLL'], 'HyperloglogFunctions::hll_serialize'],
     [80041, 'hll_deserialize', True, False, 'HLL', ['VARCHAR'], 'HyperloglogFunctions::hll_deserialize'],
 
+    # datasketches function
+    [80100, 'ds_kll_quantile', True, False, 'DOUBLE', ['VARBINARY', 'DOUBLE'], 'DataSketchesFunctions::ds_kll_quantile'],
+    [80101, 'ds_kll_rank', True, False, 'DOUBLE', ['VARBINARY', 'DOUBLE'], 'DataSketchesFunctions::ds_kll_rank'],
+    [80110, 'ds_theta_estimate', True, False, 'BIGINT', ['VARBINARY'], 'DataSketchesFunctions::ds_theta_estimate'],
+    [80111, 'ds_theta_union', True, False, 'VARBINARY', ['VARBINARY', 'VARBINARY'],
+     'DataSketchesFunctions::ds_theta_union'],
+    [80112, 'ds_theta_intersect', True, False, 'VARBINARY', ['VARBINARY', 'VARBINARY'],
+     'DataSketchesFunctions::ds_theta_intersect'],
+    [80113, 'ds_theta_a_not_b', True, False, 'VARBINARY', ['VARBINARY', 'VARBINARY'],
+     'DataSketchesFunctions::ds_theta_a_not_b'],
+
     # bitmap function
     [90010, 'to_bitmap', False, False, 'BITMAP', ['VARCHAR'], 'BitmapFunctions::to_bitmap<TYPE_VARCHAR>'],
     [90011, 'to_bitmap', False, False, 'BITMAP', ['BOOLEAN'], 'BitmapFunctions::to_bitmap<TYPE_BOOLEAN>'],
@@ -85,6 +85,7 @@ ${license}
 #include "exprs/encryption_functions.h"
 #include "exprs/geo_functions.h"
 #include "exprs/percentile_functions.h"
+#include "exprs/ds_sketch_functions.h"
 #include "exprs/grouping_sets_functions.h"
 #include "exprs/es_functions.h"
 #include "exprs/utility_functions.h"
@@ -113,6 +113,7 @@ enum TSpillableOperatorType {
   AGG_DISTINCT = 2;
   SORT = 3;
   NL_JOIN = 4;
+  ANALYTIC = 5;
 }
 
 enum TTabletInternalParallelMode {
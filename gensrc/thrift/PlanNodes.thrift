@@ -778,6 +778,10 @@ struct TAggregationNode {
 
   // enable runtime limit, pipelines share one limit
   29: optional bool enable_pipeline_share_limit = false
+
+  // The output of this aggregation is merged by another aggregation on the same grouping keys,
+  // so the rows of one key could be spread across the drivers by the local shuffle.
+  30: optional bool local_shuffle_spread_heavy_keys = false
 }
 
 struct TRepeatNode {